@@ -0,0 +1,324 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlatHashMap.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Forward iterator over the elements of a \c FlatHashMap .
+ *
+ * It is invalidated by any insertion that makes the map grow, but not by erasing other elements.
+ *
+ * @tparam T element type, \c const for constant iterators.
+ */
+template <typename T>
+class FlatHashMapIterator
+{
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    //! Create an iterator that points nowhere.
+    FlatHashMapIterator() = default;
+
+    //! Create an iterator pointing to \c slot , or to the next element if \c slot is free.
+    FlatHashMapIterator(
+            const std::int8_t* control,
+            T* slot,
+            const std::int8_t* control_end) noexcept;
+
+    //! Convert a mutable iterator into a constant one.
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value &&
+            !std::is_same<U, T>::value>::type>
+    FlatHashMapIterator(
+            const FlatHashMapIterator<U>& other) noexcept;
+
+    reference operator *() const noexcept;
+
+    pointer operator ->() const noexcept;
+
+    FlatHashMapIterator& operator ++() noexcept;
+
+    FlatHashMapIterator operator ++(
+            int) noexcept;
+
+    bool operator ==(
+            const FlatHashMapIterator& other) const noexcept;
+
+    bool operator !=(
+            const FlatHashMapIterator& other) const noexcept;
+
+protected:
+
+    template <typename U>
+    friend class FlatHashMapIterator;
+
+    template <typename K, typename V, typename H, typename E>
+    friend class FlatHashMap;
+
+    //! Move forward until an element or the end is reached.
+    void skip_free_() noexcept;
+
+    //! Control byte of the current slot.
+    const std::int8_t* control_ = nullptr;
+
+    //! Current slot.
+    T* slot_ = nullptr;
+
+    //! Control byte after the last slot.
+    const std::int8_t* control_end_ = nullptr;
+};
+
+/**
+ * @brief Hash map with open addressing, that stores its elements in one flat array of slots.
+ *
+ * Unlike \c std::map or \c std::unordered_map , there is no allocation per element, and looking for a key
+ * does not follow pointers:
+ * - Each slot has a control byte: empty, deleted, or the 7 low bits of the hash of its key.
+ * - Slots are probed in groups of \c GROUP_SIZE , comparing every control byte of the group at once
+ *   (with SSE2 where available), so only keys whose 7 bits match are compared.
+ * - The capacity is a power of 2 and the map grows when 7/8 of the slots are used.
+ *
+ * Elements are not sorted, and the order of iteration changes when the map grows.
+ * It implements the subset of the \c std::unordered_map interface used by \c SafeDatabase ,
+ * so it could be used as its \c Container .
+ *
+ * This class is not thread safe.
+ *
+ * @tparam Key type of the keys.
+ * @tparam Value type of the values.
+ * @tparam Hash hash function of the keys. Its result is mixed, so weak hashes (as identity) are fine.
+ * @tparam KeyEqual function to compare keys.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap
+{
+public:
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using iterator = FlatHashMapIterator<value_type>;
+    using const_iterator = FlatHashMapIterator<const value_type>;
+
+    //! Number of slots probed at once.
+    static constexpr size_type GROUP_SIZE = 16;
+
+    /**
+     * @brief Create an empty map.
+     *
+     * @param capacity number of elements to reserve space for.
+     * @param hash hash function of the keys.
+     * @param equal function to compare keys.
+     */
+    FlatHashMap(
+            size_type capacity = 0,
+            Hash hash = Hash(),
+            KeyEqual equal = KeyEqual());
+
+    FlatHashMap(
+            const FlatHashMap& other);
+
+    FlatHashMap(
+            FlatHashMap&& other) noexcept;
+
+    FlatHashMap& operator =(
+            const FlatHashMap& other);
+
+    FlatHashMap& operator =(
+            FlatHashMap&& other) noexcept;
+
+    //! Destroy every element and free the slots.
+    ~FlatHashMap();
+
+    iterator begin() noexcept;
+
+    const_iterator begin() const noexcept;
+
+    iterator end() noexcept;
+
+    const_iterator end() const noexcept;
+
+    //! Number of elements stored.
+    size_type size() const noexcept;
+
+    //! Whether there are no elements.
+    bool empty() const noexcept;
+
+    //! Number of slots.
+    size_type capacity() const noexcept;
+
+    /**
+     * @brief Insert \c value if its key is not in the map.
+     *
+     * @return iterator to the element with the key, and whether it has been inserted.
+     */
+    std::pair<iterator, bool> insert(
+            value_type&& value);
+
+    //! \c insert using copy semantics instead of movement.
+    std::pair<iterator, bool> insert(
+            const value_type& value);
+
+    //! Iterator to the element of \c key , or \c end if it is not in the map.
+    iterator find(
+            const Key& key);
+
+    //! Iterator to the element of \c key , or \c end if it is not in the map.
+    const_iterator find(
+            const Key& key) const;
+
+    //! 1 if \c key is in the map, 0 otherwise.
+    size_type count(
+            const Key& key) const;
+
+    /**
+     * @brief Value of \c key .
+     *
+     * @throw \c std::out_of_range if \c key is not in the map.
+     */
+    Value& at(
+            const Key& key);
+
+    //! Constant version of \c at .
+    const Value& at(
+            const Key& key) const;
+
+    //! Erase the element of \c key . Return the number of elements erased.
+    size_type erase(
+            const Key& key);
+
+    //! Erase the element at \c position , that must be valid. Return an iterator to the next element.
+    iterator erase(
+            const_iterator position);
+
+    //! Erase the element at \c position , that must be valid. Return an iterator to the next element.
+    iterator erase(
+            iterator position);
+
+    //! Erase every element, keeping the capacity.
+    void clear() noexcept;
+
+    //! Grow so \c count elements could be stored without growing again.
+    void reserve(
+            size_type count);
+
+    //! Exchange the content with \c other .
+    void swap(
+            FlatHashMap& other) noexcept;
+
+protected:
+
+    //! Control byte of a slot never used. Lookups stop at groups with an empty slot.
+    static constexpr std::int8_t EMPTY = -128;
+
+    //! Control byte of a slot whose element was erased.
+    static constexpr std::int8_t DELETED = -2;
+
+    //! Hash of \c key mixed, so every bit depends on every bit of the original hash.
+    std::size_t hash_(
+            const Key& key) const;
+
+    //! Bitmask of the slots of \c group whose control byte is \c value .
+    static std::uint32_t match_(
+            const std::int8_t* group,
+            std::int8_t value) noexcept;
+
+    //! Bitmask of the slots of \c group that are empty or deleted.
+    static std::uint32_t match_free_(
+            const std::int8_t* group) noexcept;
+
+    //! Position of the lowest bit set in \c mask , that must not be 0.
+    static unsigned int lowest_bit_(
+            std::uint32_t mask) noexcept;
+
+    //! Slot of \c key , or \c capacity_ if it is not in the map.
+    size_type find_index_(
+            const Key& key,
+            std::size_t hash) const;
+
+    //! First empty or deleted slot in the probe sequence of \c hash .
+    size_type find_free_index_(
+            std::size_t hash) const noexcept;
+
+    //! Insert an element whose key is not in the map.
+    template <typename V>
+    std::pair<iterator, bool> insert_(
+            V&& value);
+
+    //! Destroy the element of slot \c index .
+    void erase_index_(
+            size_type index) noexcept;
+
+    //! Move every element to a new array of \c capacity slots.
+    void rehash_(
+            size_type capacity);
+
+    //! Smallest valid capacity to store \c count elements.
+    static size_type capacity_for_(
+            size_type count) noexcept;
+
+    iterator iterator_at_(
+            size_type index) noexcept;
+
+    const_iterator iterator_at_(
+            size_type index) const noexcept;
+
+    //! Control bytes, aligned to \c GROUP_SIZE . nullptr while capacity is 0.
+    std::int8_t* control_ = nullptr;
+
+    //! Slots, constructed only where the control byte is not empty or deleted.
+    value_type* slots_ = nullptr;
+
+    //! Number of slots, 0 or a power of 2 multiple of \c GROUP_SIZE .
+    size_type capacity_ = 0;
+
+    //! Number of elements.
+    size_type size_ = 0;
+
+    //! Number of deleted slots, that also count for the load factor.
+    size_type deleted_ = 0;
+
+    //! Hash function of the keys.
+    Hash hash_function_;
+
+    //! Function to compare keys.
+    KeyEqual equal_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/impl/FlatHashMap.ipp>
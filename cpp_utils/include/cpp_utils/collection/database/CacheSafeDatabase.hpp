@@ -0,0 +1,329 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Configuration of a \c CacheSafeDatabase .
+struct CacheConfiguration
+{
+    //! Time to live of the entries added without a specific one, in milliseconds. 0 means they never expire.
+    Duration_ms default_ttl = 0;
+
+    //! Maximum number of entries. 0 means no limit.
+    std::size_t max_entries = 0;
+
+    //! Maximum bytes of the entries, as measured by the size function of the cache. 0 means no limit.
+    std::size_t max_bytes = 0;
+
+    //! Time covered by each slot of the timing wheel, in milliseconds. Expired entries are removed in this steps.
+    Duration_ms wheel_resolution = 100;
+
+    //! Number of slots of the timing wheel. Entries that expire further than one turn wait for the next turns.
+    std::size_t wheel_slots = 512;
+};
+
+//! Access and eviction metrics of a \c CacheSafeDatabase .
+struct CacheStatistics
+{
+    //! Number of reads that found a valid entry.
+    uint64_t hits = 0;
+    //! Number of reads that did not find the key, or found it expired.
+    uint64_t misses = 0;
+    //! Number of entries removed to keep the cache under its limits.
+    uint64_t evictions = 0;
+    //! Number of entries removed because their time to live passed.
+    uint64_t expirations = 0;
+};
+
+/**
+ * This class implements a thread safe cache of values indexed by key, with expiration and bounded size.
+ *
+ * It behaves as a \c SafeDatabase , but:
+ * - Each entry has a time to live, after which it is not read anymore.
+ *   Expired entries are removed through a timing wheel: each entry is linked in the slot of its expiration,
+ *   and advancing the wheel only visits the slots passed, so expiring is amortized O(1) per entry
+ *   instead of scanning the whole cache.
+ *   The wheel advances in each write and in \c expire .
+ * - When adding an entry would exceed \c max_entries or \c max_bytes , entries are evicted in approximate
+ *   least recently used order (CLOCK): each read marks its entry as referenced (an atomic flag),
+ *   and eviction sweeps the entries, sparing once each one referenced since the last sweep.
+ *   So reads only take the shared lock.
+ * - Hits and misses are counted in per thread shards, each in its own cache line, and only added up
+ *   in \c statistics , so concurrent reads do not write a shared counter.
+ *
+ * It does not implement \c IDatabase , as entries could expire while being iterated.
+ *
+ * @tparam \c Key type to use as key/index of map.
+ * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Hash hash function of the keys.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class CacheSafeDatabase
+{
+public:
+
+    //! Bytes taken by an entry, to honor \c max_bytes .
+    using SizeFunction = std::function<std::size_t(const Key& key, const Value& value)>;
+
+    //! Time to live argument that takes \c default_ttl of the configuration.
+    static constexpr Duration_ms DEFAULT_TTL = std::numeric_limits<Duration_ms>::max();
+
+    /**
+     * @brief Create an empty cache.
+     *
+     * @param configuration limits and expiration of the cache.
+     * @param size_of bytes taken by each entry. If not set, \c sizeof(Key)+sizeof(Value) .
+     *
+     * @throw ConfigurationException if the wheel resolution or number of slots is 0.
+     */
+    CacheSafeDatabase(
+            const CacheConfiguration& configuration = CacheConfiguration(),
+            SizeFunction size_of = nullptr);
+
+    /**
+     * @brief Add a new entry, if the key is not in the cache (or it has expired).
+     *
+     * Other entries could be evicted to make room for it.
+     * An entry larger than \c max_bytes is stored alone.
+     *
+     * @param ttl time to live in milliseconds. 0 means it never expires.
+     *
+     * @return whether it has been added.
+     */
+    bool add(
+            Key&& key,
+            Value&& value,
+            Duration_ms ttl = DEFAULT_TTL);
+
+    //! \c add using copy semantics instead of movement.
+    bool add(
+            const Key& key,
+            const Value& value,
+            Duration_ms ttl = DEFAULT_TTL);
+
+    /**
+     * @brief Add a new entry, or replace the one of its key restarting its time to live.
+     *
+     * @return whether the key was not in the cache (or it had expired).
+     */
+    bool add_or_modify(
+            Key&& key,
+            Value&& value,
+            Duration_ms ttl = DEFAULT_TTL);
+
+    //! \c add_or_modify using copy semantics instead of movement.
+    bool add_or_modify(
+            const Key& key,
+            const Value& value,
+            Duration_ms ttl = DEFAULT_TTL);
+
+    //! Remove the entry of \c key . Return whether it was in the cache (even if expired).
+    bool erase(
+            const Key& key);
+
+    //! Whether there is a valid entry of \c key . It does not count as an access.
+    bool is(
+            const Key& key) const;
+
+    /**
+     * @brief Return a copy of the value of \c key , marking it as recently used.
+     *
+     * @throw \c std::out_of_range if key not in cache or expired.
+     */
+    Value at(
+            const Key& key) const;
+
+    /**
+     * @brief Call \c visitor with the value of \c key , marking it as recently used.
+     *
+     * The value is visited with the cache shared locked: \c visitor must not access the cache.
+     *
+     * @return whether there was a valid entry of \c key .
+     */
+    bool read(
+            const Key& key,
+            const std::function<void(const Value&)>& visitor) const;
+
+    //! Number of entries stored, including those expired and not removed yet.
+    unsigned int size() const noexcept;
+
+    //! Bytes of the entries stored, as measured by the size function.
+    std::size_t bytes() const noexcept;
+
+    /**
+     * @brief Advance the timing wheel, removing the expired entries.
+     *
+     * Writes already do it, so it only needs to be called to release memory while nothing is written.
+     *
+     * @return number of entries removed.
+     */
+    unsigned int expire();
+
+    //! Access and eviction metrics so far.
+    CacheStatistics statistics() const noexcept;
+
+protected:
+
+    using Clock = std::chrono::steady_clock;
+
+    //! Entry stored in the cache, linked in the CLOCK ring and in a slot of the timing wheel.
+    struct Entry
+    {
+        Entry(
+                Value&& value)
+            : value(std::move(value))
+        {
+        }
+
+        //! Value stored.
+        Value value;
+
+        //! Key of the entry, stored in the map.
+        const Key* key = nullptr;
+
+        //! Bytes taken by the entry.
+        std::size_t bytes = 0;
+
+        //! Time from which it is expired. \c Clock::time_point::max() if it never expires.
+        Clock::time_point expiration;
+
+        //! Tick of the wheel in which it is removed.
+        uint64_t expiration_tick = 0;
+
+        //! Previous entry in its wheel slot. nullptr if first.
+        Entry* wheel_previous = nullptr;
+
+        //! Next entry in its wheel slot. nullptr if last.
+        Entry* wheel_next = nullptr;
+
+        //! Position in \c clock_ .
+        std::size_t clock_index = 0;
+
+        //! Whether it has been read since the CLOCK hand passed over it.
+        mutable std::atomic<bool> referenced {true};
+    };
+
+    using Map = std::unordered_map<Key, Entry, Hash>;
+
+    //! Number of shards of the hit and miss counters.
+    static constexpr std::size_t COUNTER_SHARDS = 16;
+
+    //! Hit and miss counters of the threads that map to this shard, in its own cache line.
+    struct alignas(64) CounterShard
+    {
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+    };
+
+    //! Shard of the hit and miss counters of the calling thread.
+    CounterShard& counter_shard_() const noexcept;
+
+    //! Entry of \c key if it is valid at \c now , or nullptr.
+    const Entry* valid_entry_(
+            const Key& key,
+            Clock::time_point now) const;
+
+    //! Mark \c entry as recently used.
+    static void reference_(
+            const Entry& entry) noexcept;
+
+    //! Insert an entry whose key is not in the cache, evicting others if needed.
+    void insert_(
+            Key&& key,
+            Value&& value,
+            Duration_ms ttl,
+            Clock::time_point now);
+
+    //! Remove \c entry from the map, the CLOCK ring and the timing wheel.
+    void remove_(
+            Entry* entry);
+
+    //! Evict one entry, the first not referenced from the CLOCK hand.
+    void evict_();
+
+    //! Remove the entries expired until \c now . Return the number of entries removed.
+    unsigned int advance_(
+            Clock::time_point now);
+
+    //! Tick of the timing wheel that contains \c time , rounded up.
+    uint64_t tick_(
+            Clock::time_point time) const;
+
+    //! Link \c entry to the wheel slot of its expiration.
+    void link_(
+            Entry* entry);
+
+    //! Unlink \c entry from its wheel slot.
+    void unlink_(
+            Entry* entry);
+
+    //! Configuration given.
+    const CacheConfiguration configuration_;
+
+    //! Bytes taken by each entry.
+    SizeFunction size_of_;
+
+    //! Entries stored. Node based, so entries are not moved.
+    Map entries_;
+
+    //! Entries in the CLOCK ring, in no particular order.
+    std::vector<Entry*> clock_;
+
+    //! Position of the CLOCK hand in \c clock_ .
+    std::size_t clock_hand_;
+
+    //! First entry of each slot of the timing wheel.
+    std::vector<Entry*> wheel_;
+
+    //! Time of tick 0 of the timing wheel.
+    const Clock::time_point origin_;
+
+    //! Last tick of the wheel whose slot has been processed.
+    uint64_t current_tick_;
+
+    //! Sum of the bytes of the entries.
+    std::atomic<std::size_t> bytes_;
+
+    //! Hits and misses so far. Reads update the shard of their thread with the cache shared locked.
+    mutable std::array<CounterShard, COUNTER_SHARDS> counters_;
+
+    //! Metrics so far, updated with the cache locked.
+    std::atomic<uint64_t> evictions_;
+    std::atomic<uint64_t> expirations_;
+
+    //! Guard access to every attribute.
+    mutable std::shared_timed_mutex mutex_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/CacheSafeDatabase.ipp>
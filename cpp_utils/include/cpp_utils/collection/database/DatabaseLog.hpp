@@ -0,0 +1,274 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DatabaseLog.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+//! Operation stored in a record of a \c DatabaseLog .
+enum class DatabaseLogOperation : uint8_t
+{
+    put = 0,    //! Key added or modified, with its new value
+    erase = 1,  //! Key erased, without value
+};
+
+//! Configuration of a \c DatabaseLog .
+struct PersistenceConfiguration
+{
+    //! Directory where the log and snapshot files are stored. It is created if it does not exist.
+    std::string directory;
+
+    //! Whether each group commit is flushed to the storage device (fsync) before the writes return.
+    bool sync = true;
+
+    //! Size in bytes of the log that triggers a compaction into a new snapshot. 0 disables automatic compaction.
+    uint64_t compaction_threshold = 64 * 1024 * 1024;
+};
+
+//! Write and recovery metrics of a \c DatabaseLog .
+struct PersistenceStatistics
+{
+    //! Number of records appended to the log.
+    uint64_t logged_records = 0;
+    //! Number of bytes of the keys and values in the records appended.
+    uint64_t logical_bytes = 0;
+    //! Number of bytes written to log files (including record headers).
+    uint64_t log_bytes = 0;
+    //! Number of writes to log files. Each one commits every record appended since the previous one.
+    uint64_t commits = 0;
+
+    //! Number of snapshots written.
+    uint64_t snapshots = 0;
+    //! Number of bytes written to snapshot files.
+    uint64_t snapshot_bytes = 0;
+
+    //! Number of entries loaded from the snapshot at recovery.
+    uint64_t recovered_entries = 0;
+    //! Number of log records replayed at recovery.
+    uint64_t replayed_records = 0;
+    //! Number of bytes of torn or corrupt records discarded from the log at recovery.
+    uint64_t discarded_bytes = 0;
+    //! Time spent loading the snapshot and replaying the log.
+    std::chrono::nanoseconds recovery_time {0};
+
+    //! Bytes written to disk (log and snapshots) per byte of keys and values written. 0 if nothing has been logged.
+    CPP_UTILS_DllAPI double write_amplification() const noexcept;
+};
+
+/**
+ * @brief Append-only log of database writes, compacted into snapshots.
+ *
+ * Records are opaque payloads built with \c begin_record and \c end_key : an operation, a serialized key,
+ * and a serialized value for \c put records.
+ * Each record is stored with its size and a CRC-32 of its payload, so a record torn by a crash is detected.
+ *
+ * Files in \c directory :
+ * - \c log.<N> : records appended in generation N.
+ * - \c snapshot : every entry of the database at the beginning of a generation, in the same record format.
+ *   It is written to a temporary file and renamed, so it is always complete.
+ *
+ * Writes follow a group commit protocol: \c append buffers a record, and \c commit waits until it is in the log.
+ * The first thread that commits writes (and syncs) every record buffered so far in one operation, while the
+ * others wait for it, so concurrent writers share the cost of each write.
+ *
+ * To compact the log, \c rotate starts a new generation while the database is not modified, and the
+ * database content at that point is written with \c write_snapshot , that removes the logs of older generations.
+ * \c recover loads the snapshot (memory-mapped where available) and replays only the logs since it.
+ *
+ * This class is thread safe, but records must be appended in the order they are applied to the database.
+ */
+class DatabaseLog
+{
+public:
+
+    //! Function called with each record recovered.
+    using RecordVisitor = std::function<void (
+                DatabaseLogOperation operation,
+                const uint8_t* key,
+                std::size_t key_size,
+                const uint8_t* value,
+                std::size_t value_size)>;
+
+    /**
+     * @brief Create a log over \c configuration.directory , creating it if needed.
+     *
+     * @throw ConfigurationException if the directory is empty.
+     * @throw InitializationException if the directory could not be created.
+     */
+    CPP_UTILS_DllAPI DatabaseLog(
+            const PersistenceConfiguration& configuration);
+
+    //! Commit every record appended and close the log.
+    CPP_UTILS_DllAPI ~DatabaseLog();
+
+    /**
+     * @brief Load the snapshot and replay the logs since it, and open the log to append new records.
+     *
+     * A torn or corrupt record at the end of the last log is discarded, and the log truncated before it.
+     * It must be called once, before appending any record.
+     *
+     * @param visitor function called with each entry of the snapshot (as \c put ) and each record of the logs.
+     *
+     * @throw InitializationException if the snapshot or any log but the last one is corrupt,
+     * or a file could not be opened.
+     */
+    CPP_UTILS_DllAPI void recover(
+            const RecordVisitor& visitor);
+
+    /**
+     * @brief Start the payload of a record at the end of \c payload .
+     *
+     * The key must be serialized at the end of \c payload next, followed by \c end_key ,
+     * and then the value if \c operation is \c put .
+     *
+     * @return position to give to \c end_key .
+     */
+    CPP_UTILS_DllAPI static std::size_t begin_record(
+            std::vector<uint8_t>& payload,
+            DatabaseLogOperation operation);
+
+    //! Mark the end of the key serialized after \c begin_record .
+    CPP_UTILS_DllAPI static void end_key(
+            std::vector<uint8_t>& payload,
+            std::size_t position);
+
+    //! Append \c payload to \c buffer with its size and checksum, as it is stored in files.
+    CPP_UTILS_DllAPI static void frame(
+            std::vector<uint8_t>& buffer,
+            const std::vector<uint8_t>& payload);
+
+    /**
+     * @brief Buffer a record to be written in the next commit.
+     *
+     * @return sequence number of the record, to give to \c commit .
+     */
+    CPP_UTILS_DllAPI uint64_t append(
+            const std::vector<uint8_t>& payload);
+
+    /**
+     * @brief Wait until the record \c sequence (and every one before it) is written in the log.
+     *
+     * If no other thread is writing, this thread writes every record buffered.
+     * 0 returns immediately.
+     *
+     * @throw InconsistencyException if the log could not be written.
+     * Records are kept buffered, and written again by the next commit.
+     */
+    CPP_UTILS_DllAPI void commit(
+            uint64_t sequence);
+
+    //! Bytes in the log of the current generation, including records not committed yet.
+    CPP_UTILS_DllAPI uint64_t log_size() const;
+
+    /**
+     * @brief Commit every record appended and start a new generation.
+     *
+     * @pre No record is appended concurrently, so the database content at this point
+     * is exactly the one recovered from the logs of previous generations.
+     *
+     * @return new generation, to give to \c write_snapshot .
+     */
+    CPP_UTILS_DllAPI uint64_t rotate();
+
+    /**
+     * @brief Replace the snapshot and remove the logs before \c generation .
+     *
+     * @param generation generation returned by \c rotate when the content was taken.
+     * @param entries every entry of the database, each one a \c put payload added with \c frame .
+     * @param count number of entries.
+     *
+     * @throw InconsistencyException if the snapshot could not be written.
+     */
+    CPP_UTILS_DllAPI void write_snapshot(
+            uint64_t generation,
+            const std::vector<uint8_t>& entries,
+            uint64_t count);
+
+    //! Write and recovery metrics so far.
+    CPP_UTILS_DllAPI PersistenceStatistics statistics() const;
+
+    //! CRC-32 (IEEE 802.3) of \c size bytes starting in \c data .
+    CPP_UTILS_DllAPI static uint32_t crc32(
+            const uint8_t* data,
+            std::size_t size) noexcept;
+
+protected:
+
+    //! Path of the log of \c generation .
+    std::string log_path_(
+            uint64_t generation) const;
+
+    //! Path of the snapshot.
+    std::string snapshot_path_() const;
+
+    //! Open the log of \c generation_ to append records.
+    void open_log_();
+
+    //! Commit records until \c sequence . \c lock must own \c mutex_ .
+    void commit_nts_(
+            std::unique_lock<std::mutex>& lock,
+            uint64_t sequence);
+
+    //! Configuration given.
+    const PersistenceConfiguration configuration_;
+
+    //! Generation of the log records are appended to.
+    uint64_t generation_;
+
+    //! Descriptor of the log of \c generation_ . -1 if it is not open.
+    int log_fd_;
+
+    //! Bytes written to the log of \c generation_ .
+    uint64_t log_written_;
+
+    //! Records appended and not written yet, framed.
+    std::vector<uint8_t> buffer_;
+
+    //! Sequence number of the last record appended.
+    uint64_t appended_;
+
+    //! Sequence number of the last record written.
+    uint64_t committed_;
+
+    //! Whether a thread is writing records out of \c mutex_ .
+    bool writing_;
+
+    //! Metrics so far.
+    PersistenceStatistics statistics_;
+
+    //! Guard every attribute.
+    mutable std::mutex mutex_;
+
+    //! Notified when records are committed.
+    std::condition_variable committed_cv_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
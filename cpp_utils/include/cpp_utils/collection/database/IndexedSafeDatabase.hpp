@@ -0,0 +1,307 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <cpp_utils/collection/database/SafeDatabase.hpp>
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Interface of a secondary index of an \c IndexedSafeDatabase , to keep it updated.
+ *
+ * It is not thread safe: it is only accessed with the database locked.
+ */
+template <typename Key, typename Value>
+class IDatabaseIndex
+{
+public:
+
+    virtual ~IDatabaseIndex() = default;
+
+    //! Index the element \c key with \c value .
+    virtual void insert(
+            const Key& key,
+            const Value& value) = 0;
+
+    //! Remove the element \c key with \c value from the index.
+    virtual void erase(
+            const Key& key,
+            const Value& value) = 0;
+};
+
+/**
+ * @brief Secondary index of an \c IndexedSafeDatabase , sorted by the index key extracted from each element.
+ *
+ * Each element is indexed once, by the result of the extractor. Several elements could have the same index key.
+ * Index entries are stored in a sorted set of pairs (index key, key), so looking for an index key or a range
+ * is O(log n), and updating an element is O(log n) whatever the number of elements with its index key.
+ *
+ * @tparam IndexKey type extracted from each element. It must be less than comparable, as \c Key .
+ */
+template <typename Key, typename Value, typename IndexKey>
+class DatabaseIndex : public IDatabaseIndex<Key, Value>
+{
+public:
+
+    //! Function that extracts the index key of an element. It must always return the same for the same element.
+    using Extractor = std::function<IndexKey(const Key& key, const Value& value)>;
+
+    //! Type of the index keys.
+    using index_key_type = IndexKey;
+
+    //! Entry of the index.
+    using Entry = std::pair<IndexKey, Key>;
+
+    //! Order the entries, and compare them with an index key alone.
+    struct Compare
+    {
+        using is_transparent = void;
+
+        bool operator ()(
+                const Entry& lhs,
+                const Entry& rhs) const
+        {
+            return lhs < rhs;
+        }
+
+        bool operator ()(
+                const Entry& lhs,
+                const IndexKey& rhs) const
+        {
+            return lhs.first < rhs;
+        }
+
+        bool operator ()(
+                const IndexKey& lhs,
+                const Entry& rhs) const
+        {
+            return lhs < rhs.first;
+        }
+    };
+
+    using const_iterator = typename std::set<Entry, Compare>::const_iterator;
+
+    //! Create an empty index.
+    DatabaseIndex(
+            Extractor extractor);
+
+    //! Override \c insert \c IDatabaseIndex method.
+    void insert(
+            const Key& key,
+            const Value& value) override;
+
+    //! Override \c erase \c IDatabaseIndex method.
+    void erase(
+            const Key& key,
+            const Value& value) override;
+
+    //! Entries with index key \c index_key .
+    std::pair<const_iterator, const_iterator> equal_range(
+            const IndexKey& index_key) const;
+
+    //! Entries with index key in [ \c from , \c to ).
+    std::pair<const_iterator, const_iterator> range(
+            const IndexKey& from,
+            const IndexKey& to) const;
+
+    //! Number of entries.
+    std::size_t size() const noexcept;
+
+protected:
+
+    //! Function that extracts the index key of an element.
+    Extractor extractor_;
+
+    //! Entries sorted by index key, and then by key.
+    std::set<Entry, Compare> entries_;
+};
+
+/**
+ * This class implements a \c SafeDatabase with secondary indexes, to look for elements by something else
+ * than their key without scanning the whole database.
+ *
+ * Each index is declared with \c add_index and a function that extracts its index key from each element.
+ * Every write (add, modify, erase, and their batch and predicate versions) updates every index with the database
+ * unique locked, so indexes are always consistent with the content.
+ * Indexes are queried with \c find_by , \c count_by and \c for_each_by , with the database shared locked.
+ * Queries only accept index handles returned by \c add_index of the same database, and throw
+ * \c PreconditionNotMet otherwise.
+ *
+ * @tparam \c Key type to use as key/index of map. It must be less than comparable.
+ * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Container map used internally.
+ */
+template <typename Key, typename Value, typename Container = std::map<Key, Value>>
+class IndexedSafeDatabase : public SafeDatabase<Key, Value, Container>
+{
+public:
+
+    //! Handle of an index, to query it.
+    template <typename IndexKey>
+    using Index = std::shared_ptr<const DatabaseIndex<Key, Value, IndexKey>>;
+
+    //! Index key type of an index, not deduced from the arguments of queries (only from the index).
+    template <typename IndexKey>
+    using IndexKeyOf = typename DatabaseIndex<Key, Value, IndexKey>::index_key_type;
+
+    /**
+     * @brief Declare a new secondary index, and index every element already stored.
+     *
+     * @param extractor function that returns the index key of an element.
+     *
+     * @return handle to query the index in this database.
+     */
+    template <typename IndexKey>
+    Index<IndexKey> add_index(
+            typename DatabaseIndex<Key, Value, IndexKey>::Extractor extractor);
+
+    // Copy versions of parent, that call the move versions overridden here
+    using SafeDatabase<Key, Value, Container>::add;
+    using SafeDatabase<Key, Value, Container>::add_or_modify;
+
+    //! Override \c add of \c SafeDatabase updating the indexes.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify of \c SafeDatabase updating the indexes.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify of \c SafeDatabase updating the indexes.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase of \c SafeDatabase updating the indexes.
+    bool erase(
+            const Key& key) override;
+
+    //! \c add_batch of \c SafeDatabase updating the indexes.
+    unsigned int add_batch(
+            std::vector<std::pair<Key, Value>>&& values) override;
+
+    //! \c erase_if of \c SafeDatabase updating the indexes.
+    unsigned int erase_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+    //! \c modify_if of \c SafeDatabase updating the indexes.
+    unsigned int modify_if(
+            const std::function<bool(const Key&, const Value&)>& predicate,
+            const std::function<void(const Key&, Value&)>& modifier) override;
+
+    //! \c extract_if of \c SafeDatabase updating the indexes.
+    std::vector<std::pair<Key, Value>> extract_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+    /**
+     * @brief Copy of the elements whose index key is \c index_key , sorted by key.
+     *
+     * @param index handle returned by \c add_index of this database.
+     */
+    template <typename IndexKey>
+    std::vector<std::pair<Key, Value>> find_by(
+            const Index<IndexKey>& index,
+            const IndexKeyOf<IndexKey>& index_key) const;
+
+    /**
+     * @brief Copy of the elements whose index key is in [ \c from , \c to ), sorted by index key and key.
+     *
+     * @param index handle returned by \c add_index of this database.
+     */
+    template <typename IndexKey>
+    std::vector<std::pair<Key, Value>> find_by(
+            const Index<IndexKey>& index,
+            const IndexKeyOf<IndexKey>& from,
+            const IndexKeyOf<IndexKey>& to) const;
+
+    //! Number of elements whose index key is \c index_key .
+    template <typename IndexKey>
+    unsigned int count_by(
+            const Index<IndexKey>& index,
+            const IndexKeyOf<IndexKey>& index_key) const;
+
+    /**
+     * @brief Call \c visitor with each element whose index key is \c index_key , without copying them.
+     *
+     * Elements are visited with the database shared locked: \c visitor must not modify the database.
+     */
+    template <typename IndexKey>
+    void for_each_by(
+            const Index<IndexKey>& index,
+            const IndexKeyOf<IndexKey>& index_key,
+            const std::function<void(const Key&, const Value&)>& visitor) const;
+
+protected:
+
+    /**
+     * @brief Add an element to every index.
+     *
+     * @pre The database is unique locked.
+     */
+    void index_(
+            const Key& key,
+            const Value& value);
+
+    /**
+     * @brief Remove an element from every index.
+     *
+     * @pre The database is unique locked.
+     */
+    void unindex_(
+            const Key& key,
+            const Value& value);
+
+    /**
+     * @brief Check that \c index was created by this database.
+     *
+     * @pre The database is locked.
+     *
+     * @throw \c PreconditionNotMet if \c index is not one of \c indexes_ .
+     */
+    void check_index_(
+            const IDatabaseIndex<Key, Value>* index) const;
+
+    /**
+     * @brief Call \c visitor with each element of the index entries in [ \c first , \c last ).
+     *
+     * Entries whose key is not in the database are skipped.
+     */
+    template <typename Iterator>
+    void visit_(
+            Iterator first,
+            Iterator last,
+            const std::function<void(const Key&, const Value&)>& visitor) const;
+
+    //! Indexes declared. Guarded by the database lock.
+    std::vector<std::shared_ptr<IDatabaseIndex<Key, Value>>> indexes_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/IndexedSafeDatabase.ipp>
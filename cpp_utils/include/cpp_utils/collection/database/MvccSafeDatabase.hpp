@@ -0,0 +1,279 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace utils {
+
+template <typename Key, typename Value>
+class MvccSafeDatabase;
+
+/**
+ * @brief Consistent view of a \c MvccSafeDatabase at one version.
+ *
+ * It sees every write committed before it was opened, and none after, however long it is kept.
+ * While it exists, the database keeps the versions it needs.
+ * Reading it does not block writers for longer than reading a few elements (see \c MvccSafeDatabase ).
+ *
+ * It is movable but not copyable. The database must outlive it.
+ */
+template <typename Key, typename Value>
+class MvccSnapshot
+{
+public:
+
+    //! Release the version, so the database could collect the versions only this snapshot needed.
+    ~MvccSnapshot();
+
+    MvccSnapshot(
+            MvccSnapshot&& other) noexcept;
+
+    MvccSnapshot& operator =(
+            MvccSnapshot&& other) noexcept;
+
+    MvccSnapshot(
+            const MvccSnapshot&) = delete;
+
+    MvccSnapshot& operator =(
+            const MvccSnapshot&) = delete;
+
+    //! Version of the database seen.
+    uint64_t version() const noexcept;
+
+    //! Whether \c key had a value at this version.
+    bool is(
+            const Key& key) const;
+
+    //! Value of \c key at this version, or nullptr if it had none.
+    std::shared_ptr<const Value> get(
+            const Key& key) const;
+
+    /**
+     * @brief Copy of the value of \c key at this version.
+     *
+     * @throw \c std::out_of_range if \c key had no value at this version.
+     */
+    Value at(
+            const Key& key) const;
+
+    /**
+     * @brief Call \c visitor with each element at this version, sorted by key.
+     *
+     * The database is only locked while collecting each batch of elements, not while visiting them,
+     * so \c visitor could take any time and access the database.
+     */
+    void for_each(
+            const std::function<void(const Key&, const Value&)>& visitor) const;
+
+    //! Number of elements at this version. It visits every element.
+    unsigned int size() const;
+
+protected:
+
+    friend class MvccSafeDatabase<Key, Value>;
+
+    //! Create a snapshot of \c database at \c version , already registered in it.
+    MvccSnapshot(
+            const MvccSafeDatabase<Key, Value>* database,
+            uint64_t version);
+
+    //! Database seen. nullptr once moved.
+    const MvccSafeDatabase<Key, Value>* database_;
+
+    //! Version seen.
+    uint64_t version_;
+};
+
+/**
+ * This class implements a thread safe map of values indexed by key, with multi-version concurrency control.
+ *
+ * Each key stores a chain of versions: each write adds a new version of the key, tagged with a number
+ * that grows with every write (an erase adds a version without value).
+ * \c snapshot opens a \c MvccSnapshot at the current version, that reads the newest version of each key
+ * not newer than its own.
+ * So long scans of a snapshot are consistent, but they do not hold the lock of the database: they collect
+ * elements in batches of \c SCAN_BATCH , taking the shared lock only while collecting each batch.
+ * Writers are only blocked while one batch is collected.
+ *
+ * Versions that no snapshot could see are collected:
+ * - Each write collects the old versions of the key it writes.
+ * - When a snapshot is released, every key is swept if the old versions stored are at least
+ *   as many as the elements, so sweeping is amortized.
+ * - \c collect_garbage sweeps every key at any time.
+ *
+ * Values are stored in \c std::shared_ptr , so snapshots visit them without copies nor locks.
+ *
+ * @tparam \c Key type to use as key/index of map. It must be copyable and less than comparable.
+ * @tparam \c Value type to use as internal value stored on map.
+ */
+template <typename Key, typename Value>
+class MvccSafeDatabase
+{
+public:
+
+    //! Maximum number of elements collected by a snapshot scan with the database locked.
+    static constexpr std::size_t SCAN_BATCH = 64;
+
+    //! Create an empty database, at version 0.
+    MvccSafeDatabase() = default;
+
+    //! Add a new element if \c key has no value. Return whether it has been added.
+    bool add(
+            Key&& key,
+            Value&& value);
+
+    //! \c add using copy semantics instead of movement.
+    bool add(
+            const Key& key,
+            const Value& value);
+
+    //! Modify the value of \c key , if it has one. Return whether it has been modified.
+    bool modify(
+            const Key& key,
+            Value&& value);
+
+    //! Add \c key or modify its value. Return whether it has been added.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value);
+
+    //! \c add_or_modify using copy semantics instead of movement.
+    bool add_or_modify(
+            const Key& key,
+            const Value& value);
+
+    //! Erase the value of \c key , if it has one. Return whether it has been erased.
+    bool erase(
+            const Key& key);
+
+    //! Whether \c key has a value now.
+    bool is(
+            const Key& key) const;
+
+    /**
+     * @brief Copy of the current value of \c key .
+     *
+     * @throw \c std::out_of_range if \c key has no value.
+     */
+    Value at(
+            const Key& key) const;
+
+    //! Number of elements now.
+    unsigned int size() const noexcept;
+
+    //! Version of the last write. 0 if nothing has been written.
+    uint64_t version() const noexcept;
+
+    //! Open a snapshot at the current version.
+    MvccSnapshot<Key, Value> snapshot() const;
+
+    //! Remove every version that no snapshot could see. Return the number of versions removed.
+    unsigned int collect_garbage();
+
+    //! Number of versions stored, including old versions and erasures kept for snapshots.
+    unsigned int version_count() const noexcept;
+
+protected:
+
+    friend class MvccSnapshot<Key, Value>;
+
+    //! Version of a key: its number, and its value or nullptr if it was erased.
+    using Version = std::pair<uint64_t, std::shared_ptr<const Value>>;
+
+    //! Versions of a key, from oldest to newest.
+    using Chain = std::vector<Version>;
+
+    //! Value of the newest version of \c chain not newer than \c version . nullptr if none or erased.
+    static const std::shared_ptr<const Value>& visible_(
+            const Chain& chain,
+            uint64_t version) noexcept;
+
+    //! Value of \c key seen at \c version . Database must not be locked.
+    std::shared_ptr<const Value> get_(
+            const Key& key,
+            uint64_t version) const;
+
+    //! Visit the elements seen at \c version in batches. Database must not be locked.
+    void for_each_(
+            uint64_t version,
+            const std::function<void(const Key&, const Value&)>& visitor) const;
+
+    //! Add a version of \c it with \c value ( nullptr to erase it), and collect its old versions.
+    void write_(
+            typename std::map<Key, Chain>::iterator it,
+            std::shared_ptr<const Value> value);
+
+    /**
+     * @brief Remove the versions of \c chain that no snapshot could see.
+     *
+     * A version is kept if it is the newest, or if it is the newest not newer than some open snapshot.
+     * So a long scan only keeps one old version of each key, however many writes it lasts.
+     *
+     * @pre \c snapshots_mutex_ is locked.
+     *
+     * @return number of versions removed.
+     */
+    std::size_t prune_(
+            Chain& chain) const;
+
+    //! Remove every version that no snapshot could see. Database must be unique locked.
+    unsigned int collect_garbage_nts_() const;
+
+    //! Unregister a snapshot at \c version , and collect old versions if they are many.
+    void release_(
+            uint64_t version) const;
+
+    /**
+     * @brief Versions of each key. Keys whose versions are all collected are removed.
+     *
+     * Mutable, as releasing a snapshot could collect old versions without changing the content.
+     */
+    mutable std::map<Key, Chain> data_;
+
+    //! Version of the last write.
+    uint64_t version_ = 0;
+
+    //! Number of keys with a value now.
+    std::size_t live_ = 0;
+
+    //! Number of versions stored.
+    mutable std::size_t stored_ = 0;
+
+    //! Guard \c data_ and the counters.
+    mutable std::shared_timed_mutex mutex_;
+
+    //! Version of each snapshot open.
+    mutable std::multiset<uint64_t> snapshots_;
+
+    //! Guard \c snapshots_ . Taken with \c mutex_ locked, never the other way around.
+    mutable std::mutex snapshots_mutex_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/MvccSafeDatabase.ipp>
@@ -0,0 +1,223 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/SafeDatabase.hpp>
+#include <cpp_utils/wait/DBQueueWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Kind of change notified by \c ObservableSafeDatabase .
+enum class DatabaseChangeKind
+{
+    added,      //! New key added
+    modified,   //! Value of an existing key modified
+    erased,     //! Key erased
+};
+
+//! Change done in an \c ObservableSafeDatabase .
+template <typename Key, typename Value>
+struct DatabaseChange
+{
+    //! Kind of change.
+    DatabaseChangeKind kind;
+
+    //! Key changed.
+    Key key;
+
+    //! Value after the change, or the value erased for \c erased changes.
+    Value value;
+};
+
+//! How an \c ObservableSafeDatabase delivers changes to its listeners.
+enum class DatabaseNotificationMode
+{
+    synchronous,    //! By the thread that writes, after the database is unlocked
+    asynchronous,   //! By an internal worker thread, through a bounded queue of batches
+};
+
+/**
+ * This class implements a \c SafeDatabase that notifies its changes to registered listeners.
+ *
+ * Each write (add, modify, erase, and their batch and predicate versions) records its changes while the database
+ * is locked, so they are delivered in the same order they are committed.
+ * Changes are delivered in batches: every change recorded and not delivered yet is delivered in one call to each
+ * listener, so a batch operation is always delivered in one batch, and concurrent writes could be merged.
+ *
+ * Depending on \c DatabaseNotificationMode :
+ * - \c synchronous : the writer delivers the pending changes after unlocking the database and before returning.
+ * - \c asynchronous : the writer pushes the pending changes to a queue of at most \c queue_size batches,
+ *   drained by an internal thread. When the queue is full, changes are kept pending and delivered with the next
+ *   batch, so writers never block waiting for listeners and no change is lost.
+ *
+ * Changes are only recorded while there are listeners, so the values are not copied otherwise.
+ * Changes pending when the database is destroyed are not delivered.
+ *
+ * @tparam \c Key type to use as key/index of map.
+ * @tparam \c Value type to use as internal value stored on map. Must be copyable.
+ * @tparam \c Container map used internally.
+ *
+ * @warning Listeners are called with the database unlocked, so they could read it.
+ * But they must not modify it nor (un)subscribe, as delivering is serialized.
+ */
+template <typename Key, typename Value, typename Container = std::map<Key, Value>>
+class ObservableSafeDatabase : public SafeDatabase<Key, Value, Container>
+{
+public:
+
+    //! Function called with each batch of changes.
+    using Listener = std::function<void (const std::vector<DatabaseChange<Key, Value>>& changes)>;
+
+    //! Identifier of a listener, to unsubscribe it.
+    using ListenerId = unsigned int;
+
+    //! Default maximum number of batches waiting to be delivered in asynchronous mode.
+    static constexpr unsigned int DEFAULT_QUEUE_SIZE = 16;
+
+    /**
+     * @brief Create an empty database.
+     *
+     * @param mode how changes are delivered.
+     * @param queue_size maximum number of batches waiting to be delivered in asynchronous mode. 0 is taken as 1.
+     */
+    ObservableSafeDatabase(
+            DatabaseNotificationMode mode = DatabaseNotificationMode::synchronous,
+            unsigned int queue_size = DEFAULT_QUEUE_SIZE);
+
+    //! Stop the worker thread, if any.
+    ~ObservableSafeDatabase();
+
+    /**
+     * @brief Register a listener that will receive every change from now on.
+     *
+     * @return identifier of the listener, to unsubscribe it.
+     */
+    ListenerId subscribe(
+            Listener listener);
+
+    /**
+     * @brief Stop notifying a listener.
+     *
+     * @return whether the listener was registered.
+     */
+    bool unsubscribe(
+            ListenerId id);
+
+    // Copy versions of parent, that call the move versions overridden here
+    using SafeDatabase<Key, Value, Container>::add;
+    using SafeDatabase<Key, Value, Container>::add_or_modify;
+
+    //! Override \c add of \c SafeDatabase notifying the change.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify of \c SafeDatabase notifying the change.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify of \c SafeDatabase notifying the change.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase of \c SafeDatabase notifying the change.
+    bool erase(
+            const Key& key) override;
+
+    //! \c add_batch of \c SafeDatabase notifying every change in one batch.
+    unsigned int add_batch(
+            std::vector<std::pair<Key, Value>>&& values) override;
+
+    //! \c erase_if of \c SafeDatabase notifying every change in one batch.
+    unsigned int erase_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+    //! \c modify_if of \c SafeDatabase notifying every change in one batch.
+    unsigned int modify_if(
+            const std::function<bool(const Key&, const Value&)>& predicate,
+            const std::function<void(const Key&, Value&)>& modifier) override;
+
+    //! \c extract_if of \c SafeDatabase notifying every change in one batch.
+    std::vector<std::pair<Key, Value>> extract_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+protected:
+
+    /**
+     * @brief Record a change to be delivered.
+     *
+     * @pre The database is unique locked, so changes are recorded in commit order.
+     */
+    void record_(
+            DatabaseChangeKind kind,
+            const Key& key,
+            const Value& value);
+
+    //! Deliver the changes pending, or push them to the queue in asynchronous mode.
+    void flush_();
+
+    //! Call every listener with \c changes .
+    void deliver_(
+            const std::vector<DatabaseChange<Key, Value>>& changes);
+
+    //! Routine of the worker thread in asynchronous mode.
+    void worker_routine_();
+
+    //! How changes are delivered.
+    const DatabaseNotificationMode mode_;
+
+    //! Maximum number of batches in \c queue_ .
+    const unsigned int queue_size_;
+
+    //! Whether there are listeners, so changes must be recorded.
+    std::atomic<bool> observed_;
+
+    //! Changes recorded and not delivered nor queued yet.
+    std::vector<DatabaseChange<Key, Value>> pending_;
+
+    //! Guard \c pending_ . Taken with the database locked.
+    std::mutex pending_mutex_;
+
+    //! Listeners registered.
+    std::map<ListenerId, Listener> listeners_;
+
+    //! Identifier of the next listener.
+    ListenerId next_listener_id_;
+
+    //! Serialize deliveries, and guard \c listeners_ .
+    std::mutex dispatch_mutex_;
+
+    //! Batches waiting to be delivered in asynchronous mode.
+    event::DBQueueWaitHandler<std::vector<DatabaseChange<Key, Value>>> queue_;
+
+    //! Thread that drains \c queue_ in asynchronous mode.
+    std::thread worker_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/ObservableSafeDatabase.ipp>
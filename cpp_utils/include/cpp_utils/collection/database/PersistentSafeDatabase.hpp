@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/DatabaseLog.hpp>
+#include <cpp_utils/collection/database/SafeDatabase.hpp>
+#include <cpp_utils/serialization/Codec.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * This class implements a \c SafeDatabase whose content survives restarts, stored in a \c DatabaseLog .
+ *
+ * Each write (add, modify, erase, and their batch and predicate versions) appends its records to the log
+ * while the database is locked, so they are logged in the same order they are committed.
+ * Then, with the database unlocked, the writer waits for its records to be written (group commit),
+ * so a write is durable once it returns, and concurrent writers share each write to disk.
+ * Readers do not wait: they could see a write that is not durable yet.
+ *
+ * When the log grows over \c compaction_threshold bytes, an internal thread compacts it: the database content
+ * is serialized (with writers blocked, but not readers) and written to a snapshot, and the old logs are removed.
+ * At creation, the snapshot is loaded and only the log written since it is replayed.
+ *
+ * Keys and values are stored with the \c Codec given.
+ *
+ * FAILURES
+ * Every write throws \c InconsistencyException if its records could not be written to the log.
+ * The change is applied in memory before committing it, so it stays applied and visible to readers
+ * even if the write throws: the exception only means that it is not durable yet.
+ * Its records stay buffered in the log, and they are written with the next successful commit of any writer
+ * (or at destruction), so the log keeps the same order as the memory content.
+ * A caller that gets this exception must not undo nor repeat the write.
+ *
+ * @tparam \c Key type to use as key/index of map.
+ * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Container map used internally.
+ */
+template <typename Key, typename Value, typename Container = std::map<Key, Value>>
+class PersistentSafeDatabase : public SafeDatabase<Key, Value, Container>
+{
+public:
+
+    /**
+     * @brief Create a database with the content stored in \c configuration.directory , if any.
+     *
+     * @param configuration where and how the database is stored.
+     * @param key_codec functions to serialize and deserialize keys.
+     * @param value_codec functions to serialize and deserialize values.
+     *
+     * @throw ConfigurationException if the configuration or the codecs are not valid.
+     * @throw InitializationException if the stored content could not be recovered.
+     */
+    PersistentSafeDatabase(
+            const PersistenceConfiguration& configuration,
+            const Codec<Key>& key_codec,
+            const Codec<Value>& value_codec);
+
+    //! Stop the compaction thread and commit every write.
+    ~PersistentSafeDatabase();
+
+    // Copy versions of parent, that call the move versions overridden here
+    using SafeDatabase<Key, Value, Container>::add;
+    using SafeDatabase<Key, Value, Container>::add_or_modify;
+
+    //! Override \c add of \c SafeDatabase logging the change.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify of \c SafeDatabase logging the change.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify of \c SafeDatabase logging the change.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase of \c SafeDatabase logging the change.
+    bool erase(
+            const Key& key) override;
+
+    //! \c add_batch of \c SafeDatabase logging every change in one commit.
+    unsigned int add_batch(
+            std::vector<std::pair<Key, Value>>&& values) override;
+
+    //! \c erase_if of \c SafeDatabase logging every change in one commit.
+    unsigned int erase_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+    //! \c modify_if of \c SafeDatabase logging every change in one commit.
+    unsigned int modify_if(
+            const std::function<bool(const Key&, const Value&)>& predicate,
+            const std::function<void(const Key&, Value&)>& modifier) override;
+
+    //! \c extract_if of \c SafeDatabase logging every change in one commit.
+    std::vector<std::pair<Key, Value>> extract_if(
+            const std::function<bool(const Key&, const Value&)>& predicate) override;
+
+    /**
+     * @brief Write the current content to a snapshot and remove the log written until now.
+     *
+     * It is called by the internal thread when the log grows over \c compaction_threshold ,
+     * but it could be called at any time.
+     *
+     * @throw InconsistencyException if the snapshot could not be written.
+     */
+    void compact();
+
+    //! Write and recovery metrics of the log so far.
+    PersistenceStatistics statistics() const;
+
+protected:
+
+    /**
+     * @brief Append a record of the change of \c key to the log.
+     *
+     * @param value new value, or nullptr if \c key is erased.
+     *
+     * @pre The database is unique locked, so changes are logged in commit order.
+     *
+     * @return sequence number of the record, to commit it.
+     */
+    uint64_t append_(
+            const Key& key,
+            const Value* value);
+
+    //! Encode the change of \c key at the end of \c payload .
+    void encode_(
+            std::vector<uint8_t>& payload,
+            const Key& key,
+            const Value* value) const;
+
+    /**
+     * @brief Wait for the records until \c sequence to be written, and request a compaction if the log is too large.
+     *
+     * @throw InconsistencyException if the log could not be written. The records stay buffered to be retried.
+     */
+    void commit_(
+            uint64_t sequence);
+
+    //! Apply a record recovered from the log.
+    void apply_(
+            DatabaseLogOperation operation,
+            const uint8_t* key,
+            std::size_t key_size,
+            const uint8_t* value,
+            std::size_t value_size);
+
+    //! Routine of the compaction thread.
+    void compaction_routine_();
+
+    //! Functions to serialize and deserialize keys.
+    const Codec<Key> key_codec_;
+
+    //! Functions to serialize and deserialize values.
+    const Codec<Value> value_codec_;
+
+    //! Size of the log that triggers a compaction. 0 to never compact automatically.
+    const uint64_t compaction_threshold_;
+
+    //! Log where changes are stored.
+    DatabaseLog log_;
+
+    //! Buffer to encode records, reused. Guarded by the database lock.
+    std::vector<uint8_t> payload_;
+
+    //! Serialize compactions.
+    std::mutex compaction_mutex_;
+
+    //! Whether the log has grown over \c compaction_threshold_ .
+    bool compaction_requested_;
+
+    //! Whether the compaction thread must finish.
+    bool stop_;
+
+    //! Guard \c compaction_requested_ and \c stop_ .
+    std::mutex compaction_request_mutex_;
+
+    //! Notify the compaction thread.
+    std::condition_variable compaction_cv_;
+
+    //! Thread that compacts the log in background.
+    std::thread compaction_thread_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/PersistentSafeDatabase.ipp>
@@ -15,14 +15,20 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <new>
 #include <type_traits>
 #include <shared_mutex>
+#include <utility>
+#include <vector>
 
+#include <cpp_utils/collection/FlatHashMap.hpp>
 #include <cpp_utils/collection/database/IModificableDatabase.hpp>
+#include <cpp_utils/exception/UnsupportedException.hpp>
 
 namespace eprosima {
 namespace utils {
@@ -30,42 +36,76 @@ namespace utils {
 /**
  * @brief Iterator over \c SafeDatabase .
  *
- * This iterator keep the database shared locked until it is destroyed.
+ * This iterator keep the database shared locked until it (and every copy of it) is destroyed.
+ * Copies share the same lock, so copying an iterator does not lock the database again.
  * Thus, the database cannot change (add, modify, erase) while the iterator exists.
  * However, other iterators and read methods could still be used while iterator exists.
  *
  * @attention this iterator blocks access to database, so keep it alive as less as possible.
+ * Use \c SafeDatabase::read or \c SafeDatabase::for_each to access values under a scoped lock instead.
  *
  * @tparam \c Key key type of the SafeDatabase.
  * @tparam \c Value internal value type of the SafeDatabase.
+ * @tparam \c Container internal container type of the SafeDatabase.
+ *
+ * The end iterator returned by \c SafeDatabase::end holds no lock, and it is equal to any iterator
+ * that has reached the end of the database. So \c end() could be called in every iteration of a loop.
  *
  * @warning while using this iterator a shared mutex is locked.
  * This shared mutex works differently between Linux and Windows. In windows a unique lock call blocks every other
  * future shared lock, and it keeps the mutex locked until the shared that have it release it.
- * Thus, if using these iterators in a loop, be careful of setting end() (or stop condition variable) before the
- * loop and not in every iteration.
+ * Thus, do not call methods that lock the database while the same thread keeps an iterator (other than \c end ).
  */
-template <typename Key, typename Value>
-class SafeDatabaseIterator : public std::map<Key, Value>::const_iterator
+template <typename Key, typename Value, typename Container = std::map<Key, Value>>
+class SafeDatabaseIterator : public Container::const_iterator
 {
 public:
 
+    //! Create an end iterator, that does not lock the database.
+    SafeDatabaseIterator() = default;
+
+    //! Create an iterator pointing to \c it , whose container ends in \c end , that shared locks \c mutex .
     SafeDatabaseIterator(
-            typename std::map<Key, Value>::const_iterator it,
+            typename Container::const_iterator it,
+            typename Container::const_iterator end,
             std::shared_timed_mutex& mutex);
 
-    ~SafeDatabaseIterator();
+    /**
+     * @brief Create an iterator pointing to \c it , whose container ends in \c end , that keeps \c lock .
+     *
+     * It allows to take the lock before getting \c it , so the position cannot change meanwhile.
+     */
+    SafeDatabaseIterator(
+            typename Container::const_iterator it,
+            typename Container::const_iterator end,
+            std::shared_lock<std::shared_timed_mutex>&& lock);
+
+    //! Whether both point to the same element, or both are at the end of the database.
+    bool operator ==(
+            const SafeDatabaseIterator& other) const noexcept;
+
+    bool operator !=(
+            const SafeDatabaseIterator& other) const noexcept;
 
 private:
 
-    std::shared_timed_mutex& mutex_;
+    //! Whether this is at the end of its container. End iterators without lock always are.
+    bool is_end_() const noexcept;
+
+    //! End of the container, got with the lock taken. Unused in end iterators without lock.
+    typename Container::const_iterator end_;
+
+    //! Shared lock of the database, shared by every copy of this iterator and released with the last one.
+    std::shared_ptr<std::shared_lock<std::shared_timed_mutex>> lock_;
 };
 
 /**
  * This class implements the Interface \c IModificableDatabase in a thread safe way.
  *
  * This represents a map of keys and values giving the methods require by IDatabase including modify and erase.
- * It uses an internal std::map to store the data.
+ * It uses an internal \c Container to store the data, \c std::map by default.
+ * \c FlatHashMap could be used instead (see \c FlatSafeDatabase ) when keys do not need to be iterated in order,
+ * avoiding one allocation per element and the pointer chasing of each lookup.
  *
  * The iteration over the internal values is thread safe.
  * This means that while there is an alive iterator, the database could not change it state (add, modify, erase).
@@ -78,9 +118,11 @@ private:
  *
  * @tparam \c Key type to use as key/index of map.
  * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Container map used internally. It must provide \c find , \c insert , \c erase , \c at , \c size ,
+ * \c begin and \c end as \c std::map does.
  */
-template <typename Key, typename Value>
-class SafeDatabase : public IModificableDatabase<Key, Value, SafeDatabaseIterator<Key, Value>>
+template <typename Key, typename Value, typename Container = std::map<Key, Value>>
+class SafeDatabase : public IModificableDatabase<Key, Value, SafeDatabaseIterator<Key, Value, Container>>
 {
 public:
 
@@ -108,14 +150,14 @@ public:
             const Key& key) const override;
 
     //! Override \c find \c IDatabase method.
-    SafeDatabaseIterator<Key, Value> find(
+    SafeDatabaseIterator<Key, Value, Container> find(
             const Key& key) const override;
 
     //! Override \c begin \c IDatabase method.
-    SafeDatabaseIterator<Key, Value> begin() const override;
+    SafeDatabaseIterator<Key, Value, Container> begin() const override;
 
-    //! Override \c end \c IDatabase method.
-    SafeDatabaseIterator<Key, Value> end() const override;
+    //! Override \c end \c IDatabase method. It does not lock the database (see \c SafeDatabaseIterator ).
+    SafeDatabaseIterator<Key, Value, Container> end() const override;
 
     /**
      * @brief Add using copy semantics instead of movement.
@@ -160,25 +202,151 @@ public:
             const Key& key,
             const Value& value);
 
+    /**
+     * @brief Call \c visitor with the value of \c key , without copying it.
+     *
+     * The database is shared locked only while \c visitor runs.
+     *
+     * @param key index of the value to look for.
+     * @param visitor function called with the value, if \c key is in the database.
+     *
+     * @return whether \c key is in the database.
+     *
+     * @warning \c visitor must not modify this database, as it is called with the database locked.
+     */
+    bool read(
+            const Key& key,
+            const std::function<void(const Value&)>& visitor) const;
+
+    /**
+     * @brief Call \c visitor with every element, without copying them.
+     *
+     * The database is shared locked once while every element is visited.
+     *
+     * @param visitor function called with each key and value.
+     *
+     * @warning \c visitor must not modify this database, as it is called with the database locked.
+     */
+    void for_each(
+            const std::function<void(const Key&, const Value&)>& visitor) const;
+
+    /**
+     * @brief Add every element of \c values locking the database only once.
+     *
+     * Elements whose key is already in the database (or repeated in \c values ) are not added.
+     *
+     * @param values elements to add, moved into the database.
+     *
+     * @return number of elements added.
+     */
+    virtual unsigned int add_batch(
+            std::vector<std::pair<Key, Value>>&& values);
+
+    /**
+     * @brief Erase every element that fulfills \c predicate locking the database only once.
+     *
+     * @param predicate function called with each element, that returns true to erase it.
+     *
+     * @return number of elements erased.
+     *
+     * @warning \c predicate must not access this database, as it is called with the database locked.
+     */
+    virtual unsigned int erase_if(
+            const std::function<bool(const Key&, const Value&)>& predicate);
+
+    /**
+     * @brief Modify every element that fulfills \c predicate locking the database only once.
+     *
+     * @param predicate function called with each element, that returns true to modify it.
+     * @param modifier function called with each element that fulfills \c predicate , to modify its value.
+     *
+     * @return number of elements modified.
+     *
+     * @warning \c predicate and \c modifier must not access this database, as they are called with the database locked.
+     */
+    virtual unsigned int modify_if(
+            const std::function<bool(const Key&, const Value&)>& predicate,
+            const std::function<void(const Key&, Value&)>& modifier);
+
+    /**
+     * @brief Erase every element that fulfills \c predicate and return them, locking the database only once.
+     *
+     * Values are moved out of the database. Keys are moved too if the container supports node extraction,
+     * and copied otherwise.
+     *
+     * @param predicate function called with each element, that returns true to extract it.
+     *
+     * @return elements extracted.
+     *
+     * @throw \c UnsupportedException if an element must be extracted and its key could not be copied nor moved.
+     *
+     * @warning \c predicate must not access this database, as it is called with the database locked.
+     */
+    virtual std::vector<std::pair<Key, Value>> extract_if(
+            const std::function<bool(const Key&, const Value&)>& predicate);
+
 protected:
 
     /**
-     * @brief The data is stored internally in this std map.
+     * @brief Move the element pointed by \c it to \c extracted , erase it and return the next element.
+     *
+     * Containers with node extraction (as \c std::map ) move the key, so it does not need to be copyable.
+     */
+    template <typename C = Container>
+    auto extract_element_(
+            typename C::iterator it,
+            std::vector<std::pair<Key, Value>>& extracted,
+            int)
+    -> decltype(std::declval<C&>().extract(it), typename C::iterator());
+
+    //! \c extract_element_ for containers without node extraction, that copies the key.
+    template <typename C = Container>
+    typename C::iterator extract_element_(
+            typename C::iterator it,
+            std::vector<std::pair<Key, Value>>& extracted,
+            long);
+
+    //! Copy the key of \c it and move its value to \c extracted , erase it and return the next element.
+    typename Container::iterator extract_copying_key_(
+            typename Container::iterator it,
+            std::vector<std::pair<Key, Value>>& extracted,
+            std::true_type /* copyable key */);
+
+    /**
+     * @brief Key could not be copied nor moved out of the container.
+     *
+     * @throw \c UnsupportedException always.
+     */
+    typename Container::iterator extract_copying_key_(
+            typename Container::iterator it,
+            std::vector<std::pair<Key, Value>>& extracted,
+            std::false_type /* copyable key */);
+
+    /**
+     * @brief The data is stored internally in this map.
      *
      * This is guarded by \c mutex_ .
      * To iterate the map from outside, it uses a custom iterator that locks write access while exist.
      */
-    std::map<Key, Value> internal_db_;
+    Container internal_db_;
 
     /**
      * @brief Guard access to internal map.
      *
      * It shares lock for read methods (iterate, find, is, at, size)
-     * It uses unique lock for write methods (add, modify, erase)
+     * It uses unique lock for write methods (add, modify, erase, and their batch and predicate versions)
      */
     mutable std::shared_timed_mutex mutex_;
 };
 
+/**
+ * @brief \c SafeDatabase that stores its data in a \c FlatHashMap .
+ *
+ * Elements are not iterated in order of key.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+using FlatSafeDatabase = SafeDatabase<Key, Value, FlatHashMap<Key, Value, Hash>>;
+
 } /* namespace utils */
 } /* namespace eprosima */
 
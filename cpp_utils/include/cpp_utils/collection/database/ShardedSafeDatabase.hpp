@@ -0,0 +1,265 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <cpp_utils/collection/database/IModificableDatabase.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Partition of a \c ShardedSafeDatabase , with its own data and lock.
+ *
+ * It is aligned to a cache line so locking a shard does not invalidate the cache of its neighbours.
+ */
+template <typename Key, typename Value>
+struct alignas(64) DatabaseShard
+{
+    //! Data of the keys that belong to this shard.
+    std::map<Key, Value> data;
+
+    //! Guard access to \c data .
+    mutable std::shared_timed_mutex mutex;
+};
+
+/**
+ * @brief Iterator over \c ShardedSafeDatabase .
+ *
+ * This iterator keeps shared locked the shards it could visit until it (and every copy of it) is destroyed:
+ * every shard for \c begin , and only the shard of the key for \c find .
+ * Thus, those shards cannot change (add, modify, erase) while the iterator exists.
+ * However, other iterators and read methods could still be used while iterator exists.
+ *
+ * An iterator from \c find only visits the elements of its shard, and then reaches \c end .
+ *
+ * @attention this iterator blocks access to database, so keep it alive as less as possible.
+ *
+ * @warning read \c SafeDatabaseIterator warning about shared mutex behaviour in Windows.
+ */
+template <typename Key, typename Value>
+class ShardedSafeDatabaseIterator
+{
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const std::pair<const Key, Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    //! Create an end iterator, that locks nothing.
+    ShardedSafeDatabaseIterator() = default;
+
+    /**
+     * @brief Create an iterator over every shard, locking them.
+     *
+     * It points to the first element of the first shard with elements, or to end if all are empty.
+     */
+    ShardedSafeDatabaseIterator(
+            const std::vector<DatabaseShard<Key, Value>>* shards);
+
+    /**
+     * @brief Create an iterator over shard \c shard , locking it.
+     *
+     * It points to the element of \c key , or to end if it is not in the shard.
+     */
+    ShardedSafeDatabaseIterator(
+            const std::vector<DatabaseShard<Key, Value>>* shards,
+            std::size_t shard,
+            const Key& key);
+
+    reference operator *() const;
+
+    pointer operator ->() const;
+
+    ShardedSafeDatabaseIterator& operator ++();
+
+    ShardedSafeDatabaseIterator operator ++(
+            int);
+
+    bool operator ==(
+            const ShardedSafeDatabaseIterator& other) const noexcept;
+
+    bool operator !=(
+            const ShardedSafeDatabaseIterator& other) const noexcept;
+
+protected:
+
+    //! Shared locks of the shards visited, released when the last copy of the iterator is destroyed.
+    class ShardsLock
+    {
+    public:
+
+        ShardsLock(
+                const std::vector<DatabaseShard<Key, Value>>* shards,
+                std::size_t first_shard,
+                std::size_t last_shard);
+
+        ~ShardsLock();
+
+    protected:
+
+        const std::vector<DatabaseShard<Key, Value>>* shards_;
+        std::size_t first_shard_;
+        std::size_t last_shard_;
+    };
+
+    //! Move to the next shard with elements if the current one has been consumed.
+    void skip_empty_shards_();
+
+    //! Shards of the database. nullptr for end iterator.
+    const std::vector<DatabaseShard<Key, Value>>* shards_ = nullptr;
+
+    //! Current shard.
+    std::size_t shard_ = 0;
+
+    //! Shard after the last one visited.
+    std::size_t last_shard_ = 0;
+
+    //! Current element in current shard.
+    typename std::map<Key, Value>::const_iterator it_;
+
+    //! Locks shared by every copy of this iterator.
+    std::shared_ptr<ShardsLock> lock_;
+};
+
+/**
+ * This class implements the Interface \c IModificableDatabase in a thread safe way, partitioning the keys
+ * in independently locked shards.
+ *
+ * It behaves as \c SafeDatabase , but each key belongs to one of \c shards std::map selected by \c Hash ,
+ * each one guarded by its own shared mutex.
+ * Thus, operations over keys of different shards do not block each other.
+ *
+ * The elements are iterated shard by shard, so they are not sorted by key.
+ * \c size adds the size of every shard, locking them one by one, so it is not an atomic snapshot
+ * if other threads are modifying the database.
+ *
+ * @tparam \c Key type to use as key/index of map.
+ * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Hash hash function to select the shard of a key.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedSafeDatabase : public IModificableDatabase<Key, Value, ShardedSafeDatabaseIterator<Key, Value>>
+{
+public:
+
+    //! Default number of shards.
+    static constexpr std::size_t DEFAULT_SHARDS = 16;
+
+    /**
+     * @brief Create a new ShardedSafeDatabase.
+     *
+     * @param shards number of shards. 0 is taken as 1.
+     * @param hash hash function to select the shard of a key.
+     */
+    ShardedSafeDatabase(
+            std::size_t shards = DEFAULT_SHARDS,
+            Hash hash = Hash());
+
+    //! Override \c add \c IDatabase method.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify \c IModificableDatabase method.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify \c IModificableDatabase method.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase \c IModificableDatabase method.
+    bool erase(
+            const Key& key) override;
+
+    //! Override \c is \c IDatabase method.
+    bool is(
+            const Key& key) const override;
+
+    //! Override \c find \c IDatabase method. It only locks the shard of \c key .
+    ShardedSafeDatabaseIterator<Key, Value> find(
+            const Key& key) const override;
+
+    //! Override \c begin \c IDatabase method. It locks every shard.
+    ShardedSafeDatabaseIterator<Key, Value> begin() const override;
+
+    //! Override \c end \c IDatabase method. It does not lock.
+    ShardedSafeDatabaseIterator<Key, Value> end() const override;
+
+    //! \c add using copy semantics instead of movement.
+    bool add(
+            const Key& key,
+            const Value& value);
+
+    /**
+     * @brief Return a copy of the value indexed by \c key .
+     *
+     * @param key index of the value to look for.
+     *
+     * @return copy of the internal value if exist.
+     * @throw \c std::out_of_range if key not in database.
+     */
+    Value at(
+            const Key& key) const;
+
+    //! Number of keys stored.
+    unsigned int size() const noexcept;
+
+    //! \c add_or_modify using copy semantics instead of movement.
+    bool add_or_modify(
+            const Key& key,
+            const Value& value);
+
+    //! Number of shards.
+    std::size_t shard_count() const noexcept;
+
+protected:
+
+    //! Index of the shard of \c key .
+    std::size_t shard_index_(
+            const Key& key) const;
+
+    //! Shard of \c key .
+    DatabaseShard<Key, Value>& shard_(
+            const Key& key) const;
+
+    //! Hash function to select the shard of a key.
+    Hash hash_;
+
+    /**
+     * @brief Shards of the database.
+     *
+     * The vector is not modified after construction, only the data of each shard guarded by its own mutex.
+     */
+    mutable std::vector<DatabaseShard<Key, Value>> shards_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/ShardedSafeDatabase.ipp>
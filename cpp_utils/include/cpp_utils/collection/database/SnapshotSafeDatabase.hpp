@@ -0,0 +1,223 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/collection/database/IModificableDatabase.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Immutable version of the data of a \c SnapshotSafeDatabase .
+ *
+ * It is owned by a \c std::shared_ptr , so readers that need it for longer than a hazard pointer could take
+ * a reference to it.
+ */
+template <typename Key, typename Value>
+struct DatabaseSnapshot : public std::enable_shared_from_this<DatabaseSnapshot<Key, Value>>
+{
+    //! Data of this version. Not modified once published.
+    std::map<Key, Value> data;
+};
+
+/**
+ * @brief Iterator over a snapshot of \c SnapshotSafeDatabase .
+ *
+ * This iterator keeps alive the snapshot that was current when it was created, and iterates it.
+ * It does not lock the database, so writers are not blocked while it exists, but it does not see their changes.
+ *
+ * A default constructed iterator is an end iterator, equal to any iterator that has reached the end.
+ */
+template <typename Key, typename Value>
+class SnapshotSafeDatabaseIterator
+{
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const std::pair<const Key, Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    //! Create an end iterator.
+    SnapshotSafeDatabaseIterator() = default;
+
+    //! Create an iterator over \c snapshot pointing to \c it , or an end iterator if \c it is the end.
+    SnapshotSafeDatabaseIterator(
+            std::shared_ptr<const DatabaseSnapshot<Key, Value>> snapshot,
+            typename std::map<Key, Value>::const_iterator it);
+
+    reference operator *() const;
+
+    pointer operator ->() const;
+
+    SnapshotSafeDatabaseIterator& operator ++();
+
+    SnapshotSafeDatabaseIterator operator ++(
+            int);
+
+    bool operator ==(
+            const SnapshotSafeDatabaseIterator& other) const noexcept;
+
+    bool operator !=(
+            const SnapshotSafeDatabaseIterator& other) const noexcept;
+
+protected:
+
+    //! Release the snapshot if the end has been reached.
+    void check_end_();
+
+    //! Snapshot iterated. nullptr for end iterator.
+    std::shared_ptr<const DatabaseSnapshot<Key, Value>> snapshot_;
+
+    //! Current element in the snapshot.
+    typename std::map<Key, Value>::const_iterator it_;
+};
+
+/**
+ * This class implements the Interface \c IModificableDatabase in a thread safe way, with lock-free reads.
+ *
+ * The data is an immutable \c std::map published through an atomic pointer:
+ * - Readers ( \c is , \c at , \c size ) load the current snapshot protected by a \c HazardPointer ,
+ *   without locking nor writing any shared memory.
+ * - \c find and \c begin return iterators that keep alive the current snapshot, so iterating never blocks writers.
+ * - Writers are serialized with a mutex. Each one copies the current map, modifies the copy, and publishes it.
+ *   Old snapshots are retired and destroyed once no hazard pointer protects them.
+ *
+ * Every write copies the whole map, so this database is meant for data read often and written rarely
+ * (e.g. discovery or configuration databases). Use \c SafeDatabase or \c ShardedSafeDatabase otherwise.
+ *
+ * @tparam \c Key type to use as key/index of map.
+ * @tparam \c Value type to use as internal value stored on map. Must be copyable.
+ *
+ * @warning The database must not be destroyed while other threads are reading it.
+ */
+template <typename Key, typename Value>
+class SnapshotSafeDatabase : public IModificableDatabase<Key, Value, SnapshotSafeDatabaseIterator<Key, Value>>
+{
+public:
+
+    //! Create an empty database.
+    SnapshotSafeDatabase();
+
+    //! Override \c add \c IDatabase method.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify \c IModificableDatabase method.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify \c IModificableDatabase method.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase \c IModificableDatabase method.
+    bool erase(
+            const Key& key) override;
+
+    //! Override \c is \c IDatabase method. It does not lock.
+    bool is(
+            const Key& key) const override;
+
+    //! Override \c find \c IDatabase method. The iterator keeps the current snapshot alive.
+    SnapshotSafeDatabaseIterator<Key, Value> find(
+            const Key& key) const override;
+
+    //! Override \c begin \c IDatabase method. The iterator keeps the current snapshot alive.
+    SnapshotSafeDatabaseIterator<Key, Value> begin() const override;
+
+    //! Override \c end \c IDatabase method.
+    SnapshotSafeDatabaseIterator<Key, Value> end() const override;
+
+    //! \c add using copy semantics instead of movement.
+    bool add(
+            const Key& key,
+            const Value& value);
+
+    /**
+     * @brief Return a copy of the value indexed by \c key . It does not lock.
+     *
+     * @param key index of the value to look for.
+     *
+     * @return copy of the internal value if exist.
+     * @throw \c std::out_of_range if key not in database.
+     */
+    Value at(
+            const Key& key) const;
+
+    //! Number of keys stored. It does not lock.
+    unsigned int size() const noexcept;
+
+    //! \c add_or_modify using copy semantics instead of movement.
+    bool add_or_modify(
+            const Key& key,
+            const Value& value);
+
+    //! Current snapshot of the data, that will not change even if the database is modified.
+    std::shared_ptr<const std::map<Key, Value>> snapshot() const;
+
+    //! Number of old snapshots waiting for readers to release them.
+    unsigned int retired_count() const;
+
+protected:
+
+    //! Shared reference to the current snapshot, taken under a hazard pointer.
+    std::shared_ptr<const DatabaseSnapshot<Key, Value>> acquire_() const;
+
+    /**
+     * @brief Publish \c snapshot as the current one and retire the previous.
+     *
+     * @pre \c write_mutex_ is locked.
+     */
+    void publish_(
+            std::shared_ptr<DatabaseSnapshot<Key, Value>> snapshot);
+
+    /**
+     * @brief Destroy retired snapshots not protected by any hazard pointer.
+     *
+     * @pre \c write_mutex_ is locked.
+     */
+    void reclaim_();
+
+    //! Snapshot read by readers.
+    std::atomic<const DatabaseSnapshot<Key, Value>*> current_;
+
+    //! Owner of \c current_ . Only accessed by writers.
+    std::shared_ptr<const DatabaseSnapshot<Key, Value>> current_owner_;
+
+    //! Replaced snapshots that could still be read.
+    std::vector<std::shared_ptr<const DatabaseSnapshot<Key, Value>>> retired_;
+
+    //! Serialize writers.
+    mutable std::mutex write_mutex_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/SnapshotSafeDatabase.ipp>
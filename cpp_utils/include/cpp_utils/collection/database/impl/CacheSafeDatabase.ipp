@@ -0,0 +1,451 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+
+namespace eprosima {
+namespace utils {
+
+template <typename Key, typename Value, typename Hash>
+constexpr Duration_ms CacheSafeDatabase<Key, Value, Hash>::DEFAULT_TTL;
+
+template <typename Key, typename Value, typename Hash>
+constexpr std::size_t CacheSafeDatabase<Key, Value, Hash>::COUNTER_SHARDS;
+
+template <typename Key, typename Value, typename Hash>
+CacheSafeDatabase<Key, Value, Hash>::CacheSafeDatabase(
+        const CacheConfiguration& configuration /* = CacheConfiguration() */,
+        SizeFunction size_of /* = nullptr */)
+    : configuration_(configuration)
+    , size_of_(std::move(size_of))
+    , clock_hand_(0)
+    , wheel_(configuration.wheel_slots, nullptr)
+    , origin_(Clock::now())
+    , current_tick_(0)
+    , bytes_(0)
+    , evictions_(0)
+    , expirations_(0)
+{
+    if (configuration_.wheel_resolution == 0 || configuration_.wheel_slots == 0)
+    {
+        throw utils::ConfigurationException("CacheSafeDatabase requires a timing wheel with slots and resolution.");
+    }
+
+    if (!size_of_)
+    {
+        size_of_ = [](const Key&, const Value&)
+                {
+                    return sizeof(Key) + sizeof(Value);
+                };
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::add(
+        Key&& key,
+        Value&& value,
+        Duration_ms ttl /* = DEFAULT_TTL */)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    Clock::time_point now = Clock::now();
+    advance_(now);
+
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        if (it->second.expiration > now)
+        {
+            return false;
+        }
+
+        // Expired, but not removed by the wheel yet
+        remove_(&it->second);
+        expirations_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    insert_(std::move(key), std::move(value), ttl, now);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::add(
+        const Key& key,
+        const Value& value,
+        Duration_ms ttl /* = DEFAULT_TTL */)
+{
+    Key key_copy = key;
+    Value value_copy = value;
+    return add(std::move(key_copy), std::move(value_copy), ttl);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::add_or_modify(
+        Key&& key,
+        Value&& value,
+        Duration_ms ttl /* = DEFAULT_TTL */)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    Clock::time_point now = Clock::now();
+    advance_(now);
+
+    bool added = true;
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        added = it->second.expiration <= now;
+        if (added)
+        {
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Replace it, as its size and expiration change
+        remove_(&it->second);
+    }
+
+    insert_(std::move(key), std::move(value), ttl, now);
+    return added;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::add_or_modify(
+        const Key& key,
+        const Value& value,
+        Duration_ms ttl /* = DEFAULT_TTL */)
+{
+    Key key_copy = key;
+    Value value_copy = value;
+    return add_or_modify(std::move(key_copy), std::move(value_copy), ttl);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::erase(
+        const Key& key)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    advance_(Clock::now());
+
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+    {
+        return false;
+    }
+
+    remove_(&it->second);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::is(
+        const Key& key) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    return valid_entry_(key, Clock::now()) != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value CacheSafeDatabase<Key, Value, Hash>::at(
+        const Key& key) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    const Entry* entry = valid_entry_(key, Clock::now());
+    if (entry == nullptr)
+    {
+        counter_shard_().misses.fetch_add(1, std::memory_order_relaxed);
+        throw std::out_of_range("Key not in cache or expired.");
+    }
+
+    counter_shard_().hits.fetch_add(1, std::memory_order_relaxed);
+    reference_(*entry);
+    return entry->value;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CacheSafeDatabase<Key, Value, Hash>::read(
+        const Key& key,
+        const std::function<void(const Value&)>& visitor) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    const Entry* entry = valid_entry_(key, Clock::now());
+    if (entry == nullptr)
+    {
+        counter_shard_().misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    counter_shard_().hits.fetch_add(1, std::memory_order_relaxed);
+    reference_(*entry);
+    visitor(entry->value);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int CacheSafeDatabase<Key, Value, Hash>::size() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    return static_cast<unsigned int>(entries_.size());
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t CacheSafeDatabase<Key, Value, Hash>::bytes() const noexcept
+{
+    return bytes_.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int CacheSafeDatabase<Key, Value, Hash>::expire()
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    return advance_(Clock::now());
+}
+
+template <typename Key, typename Value, typename Hash>
+CacheStatistics CacheSafeDatabase<Key, Value, Hash>::statistics() const noexcept
+{
+    CacheStatistics statistics;
+    for (const CounterShard& shard : counters_)
+    {
+        statistics.hits += shard.hits.load(std::memory_order_relaxed);
+        statistics.misses += shard.misses.load(std::memory_order_relaxed);
+    }
+    statistics.evictions = evictions_.load(std::memory_order_relaxed);
+    statistics.expirations = expirations_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename CacheSafeDatabase<Key, Value, Hash>::CounterShard& CacheSafeDatabase<Key, Value, Hash>::counter_shard_()
+const noexcept
+{
+    // Each thread always uses the same shard, so its counters stay in its cache
+    static thread_local const std::size_t shard =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) % COUNTER_SHARDS;
+    return counters_[shard];
+}
+
+template <typename Key, typename Value, typename Hash>
+const typename CacheSafeDatabase<Key, Value, Hash>::Entry* CacheSafeDatabase<Key, Value, Hash>::valid_entry_(
+        const Key& key,
+        Clock::time_point now) const
+{
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.expiration <= now)
+    {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::reference_(
+        const Entry& entry) noexcept
+{
+    // Avoid writing the cache line of entries read often
+    if (!entry.referenced.load(std::memory_order_relaxed))
+    {
+        entry.referenced.store(true, std::memory_order_relaxed);
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::insert_(
+        Key&& key,
+        Value&& value,
+        Duration_ms ttl,
+        Clock::time_point now)
+{
+    std::size_t entry_bytes = size_of_(key, value);
+
+    // Make room before inserting, so the new entry is never evicted
+    while (!entries_.empty() &&
+            ((configuration_.max_entries > 0 && entries_.size() >= configuration_.max_entries) ||
+            (configuration_.max_bytes > 0 && bytes_.load(std::memory_order_relaxed) + entry_bytes >
+            configuration_.max_bytes)))
+    {
+        evict_();
+    }
+
+    auto it = entries_.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::move(value))).first;
+
+    Entry* entry = &it->second;
+    entry->key = &it->first;
+    entry->bytes = entry_bytes;
+    bytes_.fetch_add(entry_bytes, std::memory_order_relaxed);
+
+    entry->clock_index = clock_.size();
+    clock_.push_back(entry);
+
+    if (ttl == DEFAULT_TTL)
+    {
+        ttl = configuration_.default_ttl;
+    }
+
+    if (ttl == 0)
+    {
+        entry->expiration = Clock::time_point::max();
+    }
+    else
+    {
+        entry->expiration = now + std::chrono::milliseconds(ttl);
+        link_(entry);
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::remove_(
+        Entry* entry)
+{
+    if (entry->expiration != Clock::time_point::max())
+    {
+        unlink_(entry);
+    }
+
+    // Move the last entry of the ring to its position
+    Entry* last = clock_.back();
+    clock_[entry->clock_index] = last;
+    last->clock_index = entry->clock_index;
+    clock_.pop_back();
+
+    bytes_.fetch_sub(entry->bytes, std::memory_order_relaxed);
+    entries_.erase(entries_.find(*entry->key));
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::evict_()
+{
+    // Each referenced entry is spared once, so this ends in at most two turns
+    while (true)
+    {
+        if (clock_hand_ >= clock_.size())
+        {
+            clock_hand_ = 0;
+        }
+
+        Entry* entry = clock_[clock_hand_];
+        if (entry->referenced.exchange(false, std::memory_order_relaxed))
+        {
+            clock_hand_++;
+            continue;
+        }
+
+        // The hand stays, pointing now to the entry moved to this position
+        remove_(entry);
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int CacheSafeDatabase<Key, Value, Hash>::advance_(
+        Clock::time_point now)
+{
+    // Only ticks already finished, so entries are never removed before their expiration
+    uint64_t now_tick = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - origin_).count()) /
+            configuration_.wheel_resolution;
+    if (now_tick <= current_tick_)
+    {
+        return 0;
+    }
+
+    // Every slot is visited at most once, however long since the last advance
+    uint64_t ticks = std::min<uint64_t>(now_tick - current_tick_, wheel_.size());
+    unsigned int expired = 0;
+    for (uint64_t tick = now_tick - ticks + 1; tick <= now_tick; ++tick)
+    {
+        Entry* entry = wheel_[tick % wheel_.size()];
+        while (entry != nullptr)
+        {
+            Entry* next = entry->wheel_next;
+            if (entry->expiration_tick <= now_tick)
+            {
+                // Otherwise it expires in a later turn of the wheel
+                remove_(entry);
+                expired++;
+            }
+            entry = next;
+        }
+    }
+
+    current_tick_ = now_tick;
+    expirations_.fetch_add(expired, std::memory_order_relaxed);
+    return expired;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t CacheSafeDatabase<Key, Value, Hash>::tick_(
+        Clock::time_point time) const
+{
+    uint64_t elapsed = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(time - origin_).count());
+    return (elapsed + configuration_.wheel_resolution - 1) / configuration_.wheel_resolution;
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::link_(
+        Entry* entry)
+{
+    // Slots up to the current tick are already processed
+    entry->expiration_tick = std::max(tick_(entry->expiration), current_tick_ + 1);
+
+    Entry*& head = wheel_[entry->expiration_tick % wheel_.size()];
+    entry->wheel_previous = nullptr;
+    entry->wheel_next = head;
+    if (head != nullptr)
+    {
+        head->wheel_previous = entry;
+    }
+    head = entry;
+}
+
+template <typename Key, typename Value, typename Hash>
+void CacheSafeDatabase<Key, Value, Hash>::unlink_(
+        Entry* entry)
+{
+    if (entry->wheel_previous != nullptr)
+    {
+        entry->wheel_previous->wheel_next = entry->wheel_next;
+    }
+    else
+    {
+        wheel_[entry->expiration_tick % wheel_.size()] = entry->wheel_next;
+    }
+
+    if (entry->wheel_next != nullptr)
+    {
+        entry->wheel_next->wheel_previous = entry->wheel_previous;
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
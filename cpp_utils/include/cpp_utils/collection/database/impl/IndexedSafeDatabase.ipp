@@ -0,0 +1,367 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <iterator>
+#include <shared_mutex>
+#include <utility>
+
+namespace eprosima {
+namespace utils {
+
+/////
+// DatabaseIndex
+
+template <typename Key, typename Value, typename IndexKey>
+DatabaseIndex<Key, Value, IndexKey>::DatabaseIndex(
+        Extractor extractor)
+    : extractor_(std::move(extractor))
+{
+}
+
+template <typename Key, typename Value, typename IndexKey>
+void DatabaseIndex<Key, Value, IndexKey>::insert(
+        const Key& key,
+        const Value& value)
+{
+    entries_.emplace(extractor_(key, value), key);
+}
+
+template <typename Key, typename Value, typename IndexKey>
+void DatabaseIndex<Key, Value, IndexKey>::erase(
+        const Key& key,
+        const Value& value)
+{
+    entries_.erase(Entry(extractor_(key, value), key));
+}
+
+template <typename Key, typename Value, typename IndexKey>
+std::pair<typename DatabaseIndex<Key, Value, IndexKey>::const_iterator,
+        typename DatabaseIndex<Key, Value, IndexKey>::const_iterator> DatabaseIndex<Key, Value, IndexKey>::equal_range(
+        const IndexKey& index_key) const
+{
+    return entries_.equal_range(index_key);
+}
+
+template <typename Key, typename Value, typename IndexKey>
+std::pair<typename DatabaseIndex<Key, Value, IndexKey>::const_iterator,
+        typename DatabaseIndex<Key, Value, IndexKey>::const_iterator> DatabaseIndex<Key, Value, IndexKey>::range(
+        const IndexKey& from,
+        const IndexKey& to) const
+{
+    if (!(from < to))
+    {
+        return {entries_.end(), entries_.end()};
+    }
+    return {entries_.lower_bound(from), entries_.lower_bound(to)};
+}
+
+template <typename Key, typename Value, typename IndexKey>
+std::size_t DatabaseIndex<Key, Value, IndexKey>::size() const noexcept
+{
+    return entries_.size();
+}
+
+/////
+// IndexedSafeDatabase
+
+template <typename Key, typename Value, typename Container>
+template <typename IndexKey>
+typename IndexedSafeDatabase<Key, Value, Container>::template Index<IndexKey> IndexedSafeDatabase<Key, Value,
+        Container>::add_index(
+        typename DatabaseIndex<Key, Value, IndexKey>::Extractor extractor)
+{
+    auto index = std::make_shared<DatabaseIndex<Key, Value, IndexKey>>(std::move(extractor));
+
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    for (const auto& it : this->internal_db_)
+    {
+        index->insert(it.first, it.second);
+    }
+    indexes_.push_back(index);
+
+    return index;
+}
+
+template <typename Key, typename Value, typename Container>
+bool IndexedSafeDatabase<Key, Value, Container>::add(
+        Key&& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    auto res = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+    if (res.second)
+    {
+        index_(res.first->first, res.first->second);
+    }
+    return res.second;
+}
+
+template <typename Key, typename Value, typename Container>
+bool IndexedSafeDatabase<Key, Value, Container>::modify(
+        const Key& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    auto it = this->internal_db_.find(key);
+    if (it == this->internal_db_.end())
+    {
+        return false;
+    }
+
+    unindex_(it->first, it->second);
+    it->second = std::move(value);
+    index_(it->first, it->second);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+bool IndexedSafeDatabase<Key, Value, Container>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    auto it = this->internal_db_.find(key);
+    bool added = it == this->internal_db_.end();
+    if (added)
+    {
+        // Add new value
+        it = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value))).first;
+    }
+    else
+    {
+        // Modify already existent value
+        unindex_(it->first, it->second);
+        it->second = std::move(value);
+    }
+    index_(it->first, it->second);
+
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+bool IndexedSafeDatabase<Key, Value, Container>::erase(
+        const Key& key)
+{
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    auto it = this->internal_db_.find(key);
+    if (it == this->internal_db_.end())
+    {
+        return false;
+    }
+
+    unindex_(it->first, it->second);
+    this->internal_db_.erase(it);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int IndexedSafeDatabase<Key, Value, Container>::add_batch(
+        std::vector<std::pair<Key, Value>>&& values)
+{
+    std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+    unsigned int added = 0;
+    for (auto& value : values)
+    {
+        auto res = this->internal_db_.insert(std::pair<Key, Value>(std::move(value.first), std::move(value.second)));
+        if (res.second)
+        {
+            index_(res.first->first, res.first->second);
+            added++;
+        }
+    }
+
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int IndexedSafeDatabase<Key, Value, Container>::erase_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    // Parent calls the predicate with the database locked, right before erasing the element
+    return SafeDatabase<Key, Value, Container>::erase_if(
+        [this, &predicate](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            unindex_(key, value);
+            return true;
+        });
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int IndexedSafeDatabase<Key, Value, Container>::modify_if(
+        const std::function<bool(const Key&, const Value&)>& predicate,
+        const std::function<void(const Key&, Value&)>& modifier)
+{
+    return SafeDatabase<Key, Value, Container>::modify_if(
+        predicate,
+        [this, &modifier](const Key& key, Value& value)
+        {
+            unindex_(key, value);
+            modifier(key, value);
+            index_(key, value);
+        });
+}
+
+template <typename Key, typename Value, typename Container>
+std::vector<std::pair<Key, Value>> IndexedSafeDatabase<Key, Value, Container>::extract_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    return SafeDatabase<Key, Value, Container>::extract_if(
+        [this, &predicate](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            unindex_(key, value);
+            return true;
+        });
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename IndexKey>
+std::vector<std::pair<Key, Value>> IndexedSafeDatabase<Key, Value, Container>::find_by(
+        const Index<IndexKey>& index,
+        const IndexKeyOf<IndexKey>& index_key) const
+{
+    std::vector<std::pair<Key, Value>> result;
+
+    std::shared_lock<std::shared_timed_mutex> _(this->mutex_);
+    check_index_(index.get());
+
+    auto range = index->equal_range(index_key);
+    visit_(range.first, range.second, [&result](const Key& key, const Value& value)
+            {
+                result.emplace_back(key, value);
+            });
+
+    return result;
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename IndexKey>
+std::vector<std::pair<Key, Value>> IndexedSafeDatabase<Key, Value, Container>::find_by(
+        const Index<IndexKey>& index,
+        const IndexKeyOf<IndexKey>& from,
+        const IndexKeyOf<IndexKey>& to) const
+{
+    std::vector<std::pair<Key, Value>> result;
+
+    std::shared_lock<std::shared_timed_mutex> _(this->mutex_);
+    check_index_(index.get());
+
+    auto range = index->range(from, to);
+    visit_(range.first, range.second, [&result](const Key& key, const Value& value)
+            {
+                result.emplace_back(key, value);
+            });
+
+    return result;
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename IndexKey>
+unsigned int IndexedSafeDatabase<Key, Value, Container>::count_by(
+        const Index<IndexKey>& index,
+        const IndexKeyOf<IndexKey>& index_key) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(this->mutex_);
+    check_index_(index.get());
+
+    auto range = index->equal_range(index_key);
+    return static_cast<unsigned int>(std::distance(range.first, range.second));
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename IndexKey>
+void IndexedSafeDatabase<Key, Value, Container>::for_each_by(
+        const Index<IndexKey>& index,
+        const IndexKeyOf<IndexKey>& index_key,
+        const std::function<void(const Key&, const Value&)>& visitor) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(this->mutex_);
+    check_index_(index.get());
+
+    auto range = index->equal_range(index_key);
+    visit_(range.first, range.second, visitor);
+}
+
+template <typename Key, typename Value, typename Container>
+void IndexedSafeDatabase<Key, Value, Container>::index_(
+        const Key& key,
+        const Value& value)
+{
+    for (auto& index : indexes_)
+    {
+        index->insert(key, value);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void IndexedSafeDatabase<Key, Value, Container>::unindex_(
+        const Key& key,
+        const Value& value)
+{
+    for (auto& index : indexes_)
+    {
+        index->erase(key, value);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void IndexedSafeDatabase<Key, Value, Container>::check_index_(
+        const IDatabaseIndex<Key, Value>* index) const
+{
+    for (const auto& own_index : indexes_)
+    {
+        if (own_index.get() == index)
+        {
+            return;
+        }
+    }
+
+    throw PreconditionNotMet("Index was not created by this database.");
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename Iterator>
+void IndexedSafeDatabase<Key, Value, Container>::visit_(
+        Iterator first,
+        Iterator last,
+        const std::function<void(const Key&, const Value&)>& visitor) const
+{
+    for (; first != last; ++first)
+    {
+        // Every key indexed should be in the database, as indexes are updated with every write
+        auto it = this->internal_db_.find(first->second);
+        if (it != this->internal_db_.end())
+        {
+            visitor(it->first, it->second);
+        }
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,465 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <iterator>
+#include <stdexcept>
+
+namespace eprosima {
+namespace utils {
+
+/////
+// MvccSnapshot
+
+template <typename Key, typename Value>
+MvccSnapshot<Key, Value>::MvccSnapshot(
+        const MvccSafeDatabase<Key, Value>* database,
+        uint64_t version)
+    : database_(database)
+    , version_(version)
+{
+}
+
+template <typename Key, typename Value>
+MvccSnapshot<Key, Value>::~MvccSnapshot()
+{
+    if (database_)
+    {
+        database_->release_(version_);
+    }
+}
+
+template <typename Key, typename Value>
+MvccSnapshot<Key, Value>::MvccSnapshot(
+        MvccSnapshot&& other) noexcept
+    : database_(other.database_)
+    , version_(other.version_)
+{
+    other.database_ = nullptr;
+}
+
+template <typename Key, typename Value>
+MvccSnapshot<Key, Value>& MvccSnapshot<Key, Value>::operator =(
+        MvccSnapshot&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (database_)
+        {
+            database_->release_(version_);
+        }
+        database_ = other.database_;
+        version_ = other.version_;
+        other.database_ = nullptr;
+    }
+    return *this;
+}
+
+template <typename Key, typename Value>
+uint64_t MvccSnapshot<Key, Value>::version() const noexcept
+{
+    return version_;
+}
+
+template <typename Key, typename Value>
+bool MvccSnapshot<Key, Value>::is(
+        const Key& key) const
+{
+    return database_->get_(key, version_) != nullptr;
+}
+
+template <typename Key, typename Value>
+std::shared_ptr<const Value> MvccSnapshot<Key, Value>::get(
+        const Key& key) const
+{
+    return database_->get_(key, version_);
+}
+
+template <typename Key, typename Value>
+Value MvccSnapshot<Key, Value>::at(
+        const Key& key) const
+{
+    auto value = database_->get_(key, version_);
+    if (!value)
+    {
+        throw std::out_of_range("MvccSnapshot::at: key not present at this version");
+    }
+    return *value;
+}
+
+template <typename Key, typename Value>
+void MvccSnapshot<Key, Value>::for_each(
+        const std::function<void(const Key&, const Value&)>& visitor) const
+{
+    database_->for_each_(version_, visitor);
+}
+
+template <typename Key, typename Value>
+unsigned int MvccSnapshot<Key, Value>::size() const
+{
+    unsigned int result = 0;
+    database_->for_each_(version_, [&result](const Key&, const Value&)
+            {
+                result++;
+            });
+    return result;
+}
+
+/////
+// MvccSafeDatabase
+
+template <typename Key, typename Value>
+constexpr std::size_t MvccSafeDatabase<Key, Value>::SCAN_BATCH;
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::add(
+        Key&& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end())
+    {
+        it = data_.emplace(std::move(key), Chain()).first;
+    }
+    else if (it->second.back().second)
+    {
+        return false;
+    }
+
+    write_(it, std::make_shared<const Value>(std::move(value)));
+    live_++;
+    return true;
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::add(
+        const Key& key,
+        const Value& value)
+{
+    return add(Key(key), Value(value));
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::modify(
+        const Key& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end() || !it->second.back().second)
+    {
+        return false;
+    }
+
+    write_(it, std::make_shared<const Value>(std::move(value)));
+    return true;
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end())
+    {
+        it = data_.emplace(std::move(key), Chain()).first;
+    }
+    bool added = it->second.empty() || !it->second.back().second;
+
+    write_(it, std::make_shared<const Value>(std::move(value)));
+    if (added)
+    {
+        live_++;
+    }
+    return added;
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::add_or_modify(
+        const Key& key,
+        const Value& value)
+{
+    return add_or_modify(Key(key), Value(value));
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::erase(
+        const Key& key)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end() || !it->second.back().second)
+    {
+        return false;
+    }
+
+    live_--;
+    write_(it, nullptr);
+    return true;
+}
+
+template <typename Key, typename Value>
+bool MvccSafeDatabase<Key, Value>::is(
+        const Key& key) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    return it != data_.end() && it->second.back().second;
+}
+
+template <typename Key, typename Value>
+Value MvccSafeDatabase<Key, Value>::at(
+        const Key& key) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end() || !it->second.back().second)
+    {
+        throw std::out_of_range("MvccSafeDatabase::at: key not present");
+    }
+    return *it->second.back().second;
+}
+
+template <typename Key, typename Value>
+unsigned int MvccSafeDatabase<Key, Value>::size() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    return static_cast<unsigned int>(live_);
+}
+
+template <typename Key, typename Value>
+uint64_t MvccSafeDatabase<Key, Value>::version() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    return version_;
+}
+
+template <typename Key, typename Value>
+MvccSnapshot<Key, Value> MvccSafeDatabase<Key, Value>::snapshot() const
+{
+    // Registered with the database locked, so no write is half done and no garbage is being collected
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+    std::lock_guard<std::mutex> __(snapshots_mutex_);
+
+    snapshots_.insert(version_);
+    return MvccSnapshot<Key, Value>(this, version_);
+}
+
+template <typename Key, typename Value>
+unsigned int MvccSafeDatabase<Key, Value>::collect_garbage()
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    return collect_garbage_nts_();
+}
+
+template <typename Key, typename Value>
+unsigned int MvccSafeDatabase<Key, Value>::version_count() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    return static_cast<unsigned int>(stored_);
+}
+
+template <typename Key, typename Value>
+const std::shared_ptr<const Value>& MvccSafeDatabase<Key, Value>::visible_(
+        const Chain& chain,
+        uint64_t version) noexcept
+{
+    static const std::shared_ptr<const Value> none;
+
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+    {
+        if (it->first <= version)
+        {
+            return it->second;
+        }
+    }
+    return none;
+}
+
+template <typename Key, typename Value>
+std::shared_ptr<const Value> MvccSafeDatabase<Key, Value>::get_(
+        const Key& key,
+        uint64_t version) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = data_.find(key);
+    if (it == data_.end())
+    {
+        return nullptr;
+    }
+    return visible_(it->second, version);
+}
+
+template <typename Key, typename Value>
+void MvccSafeDatabase<Key, Value>::for_each_(
+        uint64_t version,
+        const std::function<void(const Key&, const Value&)>& visitor) const
+{
+    std::vector<std::pair<Key, std::shared_ptr<const Value>>> batch;
+    batch.reserve(SCAN_BATCH);
+
+    // Last key scanned, to resume after it. Keys could be added or removed between batches
+    std::unique_ptr<Key> last;
+    bool finished = false;
+
+    while (!finished)
+    {
+        batch.clear();
+
+        {
+            std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+            auto it = last ? data_.upper_bound(*last) : data_.begin();
+            for (std::size_t scanned = 0; it != data_.end() && scanned < SCAN_BATCH; ++it, ++scanned)
+            {
+                const auto& value = visible_(it->second, version);
+                if (value)
+                {
+                    batch.emplace_back(it->first, value);
+                }
+                if (last)
+                {
+                    *last = it->first;
+                }
+                else
+                {
+                    last.reset(new Key(it->first));
+                }
+            }
+            finished = it == data_.end();
+        }
+
+        // Values are immutable and kept alive by the batch, so they are visited without the lock
+        for (const auto& it : batch)
+        {
+            visitor(it.first, *it.second);
+        }
+    }
+}
+
+template <typename Key, typename Value>
+void MvccSafeDatabase<Key, Value>::write_(
+        typename std::map<Key, Chain>::iterator it,
+        std::shared_ptr<const Value> value)
+{
+    it->second.emplace_back(++version_, std::move(value));
+    stored_++;
+
+    {
+        std::lock_guard<std::mutex> _(snapshots_mutex_);
+        stored_ -= prune_(it->second);
+    }
+
+    if (it->second.empty())
+    {
+        data_.erase(it);
+    }
+}
+
+template <typename Key, typename Value>
+std::size_t MvccSafeDatabase<Key, Value>::prune_(
+        Chain& chain) const
+{
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < chain.size(); ++i)
+    {
+        bool newest = i + 1 == chain.size();
+
+        // Seen by a snapshot opened at this version or later, but before the next one
+        auto snapshot = snapshots_.lower_bound(chain[i].first);
+        bool seen = snapshot != snapshots_.end() && (newest || *snapshot < chain[i + 1].first);
+
+        // An erasure with no older version kept is the same as no version at all
+        bool erasure = !chain[i].second && kept == 0;
+
+        if ((newest || seen) && !erasure)
+        {
+            if (kept != i)
+            {
+                chain[kept] = std::move(chain[i]);
+            }
+            kept++;
+        }
+    }
+
+    std::size_t removed = chain.size() - kept;
+    chain.resize(kept);
+    return removed;
+}
+
+template <typename Key, typename Value>
+unsigned int MvccSafeDatabase<Key, Value>::collect_garbage_nts_() const
+{
+    std::lock_guard<std::mutex> _(snapshots_mutex_);
+
+    std::size_t removed = 0;
+    for (auto it = data_.begin(); it != data_.end();)
+    {
+        removed += prune_(it->second);
+        if (it->second.empty())
+        {
+            it = data_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    stored_ -= removed;
+    return static_cast<unsigned int>(removed);
+}
+
+template <typename Key, typename Value>
+void MvccSafeDatabase<Key, Value>::release_(
+        uint64_t version) const
+{
+    {
+        std::lock_guard<std::mutex> _(snapshots_mutex_);
+
+        snapshots_.erase(snapshots_.find(version));
+        if (snapshots_.count(version) > 0)
+        {
+            // Another snapshot still needs the same versions
+            return;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    // Sweep only when old versions are at least as many as the elements, so it is amortized by the writes
+    std::size_t old_versions = stored_ - live_;
+    if (old_versions > 0 && old_versions >= live_)
+    {
+        collect_garbage_nts_();
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,356 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <shared_mutex>
+#include <utility>
+
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+
+template <typename Key, typename Value, typename Container>
+constexpr unsigned int ObservableSafeDatabase<Key, Value, Container>::DEFAULT_QUEUE_SIZE;
+
+template <typename Key, typename Value, typename Container>
+ObservableSafeDatabase<Key, Value, Container>::ObservableSafeDatabase(
+        DatabaseNotificationMode mode /* = DatabaseNotificationMode::synchronous */,
+        unsigned int queue_size /* = DEFAULT_QUEUE_SIZE */)
+    : mode_(mode)
+    , queue_size_(std::max(queue_size, 1u))
+    , observed_(false)
+    , next_listener_id_(0)
+{
+    if (mode_ == DatabaseNotificationMode::asynchronous)
+    {
+        worker_ = std::thread(&ObservableSafeDatabase::worker_routine_, this);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+ObservableSafeDatabase<Key, Value, Container>::~ObservableSafeDatabase()
+{
+    if (worker_.joinable())
+    {
+        queue_.disable();
+        worker_.join();
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+typename ObservableSafeDatabase<Key, Value, Container>::ListenerId ObservableSafeDatabase<Key, Value,
+        Container>::subscribe(
+        Listener listener)
+{
+    std::lock_guard<std::mutex> _(dispatch_mutex_);
+
+    ListenerId id = next_listener_id_++;
+    listeners_.emplace(id, std::move(listener));
+    observed_.store(true);
+
+    return id;
+}
+
+template <typename Key, typename Value, typename Container>
+bool ObservableSafeDatabase<Key, Value, Container>::unsubscribe(
+        ListenerId id)
+{
+    std::lock_guard<std::mutex> _(dispatch_mutex_);
+
+    if (listeners_.erase(id) == 0)
+    {
+        return false;
+    }
+
+    if (listeners_.empty())
+    {
+        // Nobody will receive the changes pending
+        observed_.store(false);
+        std::lock_guard<std::mutex> pending_lock(pending_mutex_);
+        pending_.clear();
+    }
+
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+bool ObservableSafeDatabase<Key, Value, Container>::add(
+        Key&& key,
+        Value&& value)
+{
+    bool added;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto res = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+        added = res.second;
+        if (added)
+        {
+            record_(DatabaseChangeKind::added, res.first->first, res.first->second);
+        }
+    }
+
+    flush_();
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+bool ObservableSafeDatabase<Key, Value, Container>::modify(
+        const Key& key,
+        Value&& value)
+{
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        if (it == this->internal_db_.end())
+        {
+            return false;
+        }
+
+        it->second = std::move(value);
+        record_(DatabaseChangeKind::modified, it->first, it->second);
+    }
+
+    flush_();
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+bool ObservableSafeDatabase<Key, Value, Container>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    bool added;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        added = it == this->internal_db_.end();
+        if (added)
+        {
+            // Add new value
+            it = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value))).first;
+        }
+        else
+        {
+            // Modify already existent value
+            it->second = std::move(value);
+        }
+        record_(added ? DatabaseChangeKind::added : DatabaseChangeKind::modified, it->first, it->second);
+    }
+
+    flush_();
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+bool ObservableSafeDatabase<Key, Value, Container>::erase(
+        const Key& key)
+{
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        if (it == this->internal_db_.end())
+        {
+            return false;
+        }
+
+        record_(DatabaseChangeKind::erased, it->first, it->second);
+        this->internal_db_.erase(it);
+    }
+
+    flush_();
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int ObservableSafeDatabase<Key, Value, Container>::add_batch(
+        std::vector<std::pair<Key, Value>>&& values)
+{
+    unsigned int added = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        for (auto& value : values)
+        {
+            auto res =
+                    this->internal_db_.insert(std::pair<Key, Value>(std::move(value.first), std::move(value.second)));
+            if (res.second)
+            {
+                record_(DatabaseChangeKind::added, res.first->first, res.first->second);
+                added++;
+            }
+        }
+    }
+
+    flush_();
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int ObservableSafeDatabase<Key, Value, Container>::erase_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    // Parent calls the predicate with the database locked, so changes are recorded in order
+    unsigned int erased = SafeDatabase<Key, Value, Container>::erase_if(
+        [this, &predicate](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            record_(DatabaseChangeKind::erased, key, value);
+            return true;
+        });
+
+    flush_();
+    return erased;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int ObservableSafeDatabase<Key, Value, Container>::modify_if(
+        const std::function<bool(const Key&, const Value&)>& predicate,
+        const std::function<void(const Key&, Value&)>& modifier)
+{
+    unsigned int modified = SafeDatabase<Key, Value, Container>::modify_if(
+        predicate,
+        [this, &modifier](const Key& key, Value& value)
+        {
+            modifier(key, value);
+            record_(DatabaseChangeKind::modified, key, value);
+        });
+
+    flush_();
+    return modified;
+}
+
+template <typename Key, typename Value, typename Container>
+std::vector<std::pair<Key, Value>> ObservableSafeDatabase<Key, Value, Container>::extract_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    auto extracted = SafeDatabase<Key, Value, Container>::extract_if(
+        [this, &predicate](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            record_(DatabaseChangeKind::erased, key, value);
+            return true;
+        });
+
+    flush_();
+    return extracted;
+}
+
+template <typename Key, typename Value, typename Container>
+void ObservableSafeDatabase<Key, Value, Container>::record_(
+        DatabaseChangeKind kind,
+        const Key& key,
+        const Value& value)
+{
+    if (!observed_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> _(pending_mutex_);
+    pending_.push_back(DatabaseChange<Key, Value>{kind, key, value});
+}
+
+template <typename Key, typename Value, typename Container>
+void ObservableSafeDatabase<Key, Value, Container>::flush_()
+{
+    if (!observed_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (mode_ == DatabaseNotificationMode::synchronous)
+    {
+        // Keep delivering serialized, so batches arrive in the order they were taken
+        std::lock_guard<std::mutex> _(dispatch_mutex_);
+
+        std::vector<DatabaseChange<Key, Value>> changes;
+        {
+            std::lock_guard<std::mutex> pending_lock(pending_mutex_);
+            changes.swap(pending_);
+        }
+
+        if (!changes.empty())
+        {
+            deliver_(changes);
+        }
+    }
+    else
+    {
+        // Produce with the pending mutex taken, so batches are queued in the order they were taken
+        std::lock_guard<std::mutex> _(pending_mutex_);
+
+        if (pending_.empty() || queue_.elements_ready_to_consume() >= queue_size_)
+        {
+            // If the queue is full, the worker will take these changes after delivering the next batch
+            return;
+        }
+
+        std::vector<DatabaseChange<Key, Value>> changes;
+        changes.swap(pending_);
+        queue_.produce(std::move(changes));
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void ObservableSafeDatabase<Key, Value, Container>::deliver_(
+        const std::vector<DatabaseChange<Key, Value>>& changes)
+{
+    logDebug(OBSERVABLE_SAFE_DATABASE, "Delivering " << changes.size() << " changes to " << listeners_.size()
+                                                     << " listeners.");
+
+    for (const auto& it : listeners_)
+    {
+        it.second(changes);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void ObservableSafeDatabase<Key, Value, Container>::worker_routine_()
+{
+    try
+    {
+        while (true)
+        {
+            std::vector<DatabaseChange<Key, Value>> changes = queue_.consume();
+            {
+                std::lock_guard<std::mutex> _(dispatch_mutex_);
+                deliver_(changes);
+            }
+
+            // Take the changes left pending while the queue was full
+            flush_();
+        }
+    }
+    catch (const utils::DisabledException&)
+    {
+        logDebug(OBSERVABLE_SAFE_DATABASE, "Stopping notification worker.");
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,396 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <shared_mutex>
+#include <utility>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+
+template <typename Key, typename Value, typename Container>
+PersistentSafeDatabase<Key, Value, Container>::PersistentSafeDatabase(
+        const PersistenceConfiguration& configuration,
+        const Codec<Key>& key_codec,
+        const Codec<Value>& value_codec)
+    : key_codec_(key_codec)
+    , value_codec_(value_codec)
+    , compaction_threshold_(configuration.compaction_threshold)
+    , log_(configuration)
+    , compaction_requested_(false)
+    , stop_(false)
+{
+    if (!key_codec_.serialize || !key_codec_.deserialize || !value_codec_.serialize || !value_codec_.deserialize)
+    {
+        throw utils::ConfigurationException("PersistentSafeDatabase requires serialize and deserialize functions.");
+    }
+
+    // Nobody could access the database yet, so it is filled without locking it
+    log_.recover(
+        [this](
+            DatabaseLogOperation operation,
+            const uint8_t* key,
+            std::size_t key_size,
+            const uint8_t* value,
+            std::size_t value_size)
+        {
+            apply_(operation, key, key_size, value, value_size);
+        });
+
+    compaction_thread_ = std::thread(&PersistentSafeDatabase::compaction_routine_, this);
+}
+
+template <typename Key, typename Value, typename Container>
+PersistentSafeDatabase<Key, Value, Container>::~PersistentSafeDatabase()
+{
+    {
+        std::lock_guard<std::mutex> _(compaction_request_mutex_);
+        stop_ = true;
+    }
+    compaction_cv_.notify_one();
+    compaction_thread_.join();
+}
+
+template <typename Key, typename Value, typename Container>
+bool PersistentSafeDatabase<Key, Value, Container>::add(
+        Key&& key,
+        Value&& value)
+{
+    uint64_t sequence = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto res = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+        if (!res.second)
+        {
+            return false;
+        }
+        sequence = append_(res.first->first, &res.first->second);
+    }
+
+    commit_(sequence);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+bool PersistentSafeDatabase<Key, Value, Container>::modify(
+        const Key& key,
+        Value&& value)
+{
+    uint64_t sequence = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        if (it == this->internal_db_.end())
+        {
+            return false;
+        }
+
+        it->second = std::move(value);
+        sequence = append_(it->first, &it->second);
+    }
+
+    commit_(sequence);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+bool PersistentSafeDatabase<Key, Value, Container>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    bool added;
+    uint64_t sequence = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        added = it == this->internal_db_.end();
+        if (added)
+        {
+            // Add new value
+            it = this->internal_db_.insert(std::pair<Key, Value>(std::move(key), std::move(value))).first;
+        }
+        else
+        {
+            // Modify already existent value
+            it->second = std::move(value);
+        }
+        sequence = append_(it->first, &it->second);
+    }
+
+    commit_(sequence);
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+bool PersistentSafeDatabase<Key, Value, Container>::erase(
+        const Key& key)
+{
+    uint64_t sequence = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        auto it = this->internal_db_.find(key);
+        if (it == this->internal_db_.end())
+        {
+            return false;
+        }
+
+        sequence = append_(it->first, nullptr);
+        this->internal_db_.erase(it);
+    }
+
+    commit_(sequence);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int PersistentSafeDatabase<Key, Value, Container>::add_batch(
+        std::vector<std::pair<Key, Value>>&& values)
+{
+    unsigned int added = 0;
+    uint64_t sequence = 0;
+    {
+        std::unique_lock<std::shared_timed_mutex> _(this->mutex_);
+
+        for (auto& value : values)
+        {
+            auto res =
+                    this->internal_db_.insert(std::pair<Key, Value>(std::move(value.first), std::move(value.second)));
+            if (res.second)
+            {
+                sequence = append_(res.first->first, &res.first->second);
+                added++;
+            }
+        }
+    }
+
+    commit_(sequence);
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int PersistentSafeDatabase<Key, Value, Container>::erase_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    // Parent calls the predicate with the database locked, so changes are logged in order
+    uint64_t sequence = 0;
+    unsigned int erased = SafeDatabase<Key, Value, Container>::erase_if(
+        [this, &predicate, &sequence](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            sequence = append_(key, nullptr);
+            return true;
+        });
+
+    commit_(sequence);
+    return erased;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int PersistentSafeDatabase<Key, Value, Container>::modify_if(
+        const std::function<bool(const Key&, const Value&)>& predicate,
+        const std::function<void(const Key&, Value&)>& modifier)
+{
+    uint64_t sequence = 0;
+    unsigned int modified = SafeDatabase<Key, Value, Container>::modify_if(
+        predicate,
+        [this, &modifier, &sequence](const Key& key, Value& value)
+        {
+            modifier(key, value);
+            sequence = append_(key, &value);
+        });
+
+    commit_(sequence);
+    return modified;
+}
+
+template <typename Key, typename Value, typename Container>
+std::vector<std::pair<Key, Value>> PersistentSafeDatabase<Key, Value, Container>::extract_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    uint64_t sequence = 0;
+    auto extracted = SafeDatabase<Key, Value, Container>::extract_if(
+        [this, &predicate, &sequence](const Key& key, const Value& value)
+        {
+            if (!predicate(key, value))
+            {
+                return false;
+            }
+            sequence = append_(key, nullptr);
+            return true;
+        });
+
+    commit_(sequence);
+    return extracted;
+}
+
+template <typename Key, typename Value, typename Container>
+void PersistentSafeDatabase<Key, Value, Container>::compact()
+{
+    std::lock_guard<std::mutex> _(compaction_mutex_);
+
+    uint64_t generation;
+    uint64_t count;
+    std::vector<uint8_t> entries;
+    {
+        // Writers are blocked so the content matches the logs before the new generation, but not readers
+        std::shared_lock<std::shared_timed_mutex> lock(this->mutex_);
+
+        generation = log_.rotate();
+        count = this->internal_db_.size();
+
+        std::vector<uint8_t> payload;
+        for (const auto& it : this->internal_db_)
+        {
+            payload.clear();
+            encode_(payload, it.first, &it.second);
+            DatabaseLog::frame(entries, payload);
+        }
+    }
+
+    // Writing to disk does not block anyone
+    log_.write_snapshot(generation, entries, count);
+}
+
+template <typename Key, typename Value, typename Container>
+PersistenceStatistics PersistentSafeDatabase<Key, Value, Container>::statistics() const
+{
+    return log_.statistics();
+}
+
+template <typename Key, typename Value, typename Container>
+uint64_t PersistentSafeDatabase<Key, Value, Container>::append_(
+        const Key& key,
+        const Value* value)
+{
+    payload_.clear();
+    encode_(payload_, key, value);
+    return log_.append(payload_);
+}
+
+template <typename Key, typename Value, typename Container>
+void PersistentSafeDatabase<Key, Value, Container>::encode_(
+        std::vector<uint8_t>& payload,
+        const Key& key,
+        const Value* value) const
+{
+    std::size_t position = DatabaseLog::begin_record(
+        payload,
+        value ? DatabaseLogOperation::put : DatabaseLogOperation::erase);
+    key_codec_.serialize(key, payload);
+    DatabaseLog::end_key(payload, position);
+
+    if (value)
+    {
+        value_codec_.serialize(*value, payload);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void PersistentSafeDatabase<Key, Value, Container>::commit_(
+        uint64_t sequence)
+{
+    log_.commit(sequence);
+
+    if (compaction_threshold_ > 0 && log_.log_size() >= compaction_threshold_)
+    {
+        {
+            std::lock_guard<std::mutex> _(compaction_request_mutex_);
+            compaction_requested_ = true;
+        }
+        compaction_cv_.notify_one();
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void PersistentSafeDatabase<Key, Value, Container>::apply_(
+        DatabaseLogOperation operation,
+        const uint8_t* key,
+        std::size_t key_size,
+        const uint8_t* value,
+        std::size_t value_size)
+{
+    Key recovered_key = key_codec_.deserialize(key, key_size);
+
+    if (operation == DatabaseLogOperation::erase)
+    {
+        this->internal_db_.erase(recovered_key);
+        return;
+    }
+
+    Value recovered_value = value_codec_.deserialize(value, value_size);
+    auto it = this->internal_db_.find(recovered_key);
+    if (it == this->internal_db_.end())
+    {
+        this->internal_db_.insert(std::pair<Key, Value>(std::move(recovered_key), std::move(recovered_value)));
+    }
+    else
+    {
+        it->second = std::move(recovered_value);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+void PersistentSafeDatabase<Key, Value, Container>::compaction_routine_()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(compaction_request_mutex_);
+            compaction_cv_.wait(lock, [this]()
+                    {
+                        return stop_ || compaction_requested_;
+                    });
+
+            if (stop_)
+            {
+                logDebug(PERSISTENT_SAFE_DATABASE, "Stopping compaction thread.");
+                return;
+            }
+            compaction_requested_ = false;
+        }
+
+        if (log_.log_size() < compaction_threshold_)
+        {
+            // Already compacted after being requested
+            continue;
+        }
+
+        try
+        {
+            compact();
+        }
+        catch (const utils::Exception& e)
+        {
+            // The log keeps every change, so it is retried when the log grows again
+            logWarning(PERSISTENT_SAFE_DATABASE, "Error compacting database log: " << e.what());
+        }
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
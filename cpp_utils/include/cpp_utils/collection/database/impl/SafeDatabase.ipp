@@ -18,24 +18,56 @@ namespace eprosima {
 namespace utils {
 
 
-template <typename Key, typename Value>
-SafeDatabaseIterator<Key, Value>::SafeDatabaseIterator(
-        typename std::map<Key, Value>::const_iterator it,
+template <typename Key, typename Value, typename Container>
+SafeDatabaseIterator<Key, Value, Container>::SafeDatabaseIterator(
+        typename Container::const_iterator it,
+        typename Container::const_iterator end,
         std::shared_timed_mutex& mutex)
-    : std::map<Key, Value>::const_iterator(it)
-    , mutex_(mutex)
+    : Container::const_iterator(it)
+    , end_(end)
+    , lock_(std::make_shared<std::shared_lock<std::shared_timed_mutex>>(mutex))
 {
-    mutex_.lock_shared();
 }
 
-template <typename Key, typename Value>
-SafeDatabaseIterator<Key, Value>::~SafeDatabaseIterator()
+template <typename Key, typename Value, typename Container>
+SafeDatabaseIterator<Key, Value, Container>::SafeDatabaseIterator(
+        typename Container::const_iterator it,
+        typename Container::const_iterator end,
+        std::shared_lock<std::shared_timed_mutex>&& lock)
+    : Container::const_iterator(it)
+    , end_(end)
+    , lock_(std::make_shared<std::shared_lock<std::shared_timed_mutex>>(std::move(lock)))
 {
-    mutex_.unlock_shared();
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::add(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabaseIterator<Key, Value, Container>::operator ==(
+        const SafeDatabaseIterator& other) const noexcept
+{
+    // An end iterator without lock is equal to any iterator at the end, whatever the lock it keeps
+    if (!lock_ || !other.lock_)
+    {
+        return is_end_() && other.is_end_();
+    }
+    return static_cast<const typename Container::const_iterator&>(*this) ==
+           static_cast<const typename Container::const_iterator&>(other);
+}
+
+template <typename Key, typename Value, typename Container>
+bool SafeDatabaseIterator<Key, Value, Container>::operator !=(
+        const SafeDatabaseIterator& other) const noexcept
+{
+    return !(*this == other);
+}
+
+template <typename Key, typename Value, typename Container>
+bool SafeDatabaseIterator<Key, Value, Container>::is_end_() const noexcept
+{
+    return !lock_ || static_cast<const typename Container::const_iterator&>(*this) == end_;
+}
+
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::add(
         Key&& key,
         Value&& value)
 {
@@ -46,8 +78,8 @@ bool SafeDatabase<Key, Value>::add(
     return res.second;
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::modify(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::modify(
         const Key& key,
         Value&& value)
 {
@@ -64,8 +96,8 @@ bool SafeDatabase<Key, Value>::modify(
     return true;
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::erase(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::erase(
         const Key& key)
 {
     std::unique_lock<std::shared_timed_mutex> _(mutex_);
@@ -73,8 +105,8 @@ bool SafeDatabase<Key, Value>::erase(
     return internal_db_.erase(key) != 0;
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::is(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::is(
         const Key& key) const
 {
     std::shared_lock<std::shared_timed_mutex> _(mutex_);
@@ -82,37 +114,43 @@ bool SafeDatabase<Key, Value>::is(
     return internal_db_.find(key) != internal_db_.end();
 }
 
-template <typename Key, typename Value>
-SafeDatabaseIterator<Key, Value> SafeDatabase<Key, Value>::find(
+template <typename Key, typename Value, typename Container>
+SafeDatabaseIterator<Key, Value, Container> SafeDatabase<Key, Value, Container>::find(
         const Key& key) const
 {
-    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+    // The iterator keeps this same lock, so the mutex is not shared locked twice by this thread
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
 
-    return SafeDatabaseIterator<Key, Value>(internal_db_.find(key), mutex_);
+    auto it = internal_db_.find(key);
+    return SafeDatabaseIterator<Key, Value, Container>(it, internal_db_.end(), std::move(lock));
 }
 
-template <typename Key, typename Value>
-SafeDatabaseIterator<Key, Value> SafeDatabase<Key, Value>::begin() const
+template <typename Key, typename Value, typename Container>
+SafeDatabaseIterator<Key, Value, Container> SafeDatabase<Key, Value, Container>::begin() const
 {
-    return SafeDatabaseIterator<Key, Value>(internal_db_.begin(), mutex_);
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = internal_db_.begin();
+    return SafeDatabaseIterator<Key, Value, Container>(it, internal_db_.end(), std::move(lock));
 }
 
-template <typename Key, typename Value>
-SafeDatabaseIterator<Key, Value> SafeDatabase<Key, Value>::end() const
+template <typename Key, typename Value, typename Container>
+SafeDatabaseIterator<Key, Value, Container> SafeDatabase<Key, Value, Container>::end() const
 {
-    return SafeDatabaseIterator<Key, Value>(internal_db_.end(), mutex_);
+    // No lock: locking again while this thread iterates could deadlock with a waiting writer
+    return SafeDatabaseIterator<Key, Value, Container>();
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::add(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::add(
         const Key& key,
         const Value& value)
 {
     return add(std::move(Key(key)), std::move(Value(value)));
 }
 
-template <typename Key, typename Value>
-Value SafeDatabase<Key, Value>::at(
+template <typename Key, typename Value, typename Container>
+Value SafeDatabase<Key, Value, Container>::at(
         const Key& key) const
 {
     std::shared_lock<std::shared_timed_mutex> _(mutex_);
@@ -120,16 +158,16 @@ Value SafeDatabase<Key, Value>::at(
     return internal_db_.at(key);
 }
 
-template <typename Key, typename Value>
-unsigned int SafeDatabase<Key, Value>::size() const noexcept
+template <typename Key, typename Value, typename Container>
+unsigned int SafeDatabase<Key, Value, Container>::size() const noexcept
 {
     std::shared_lock<std::shared_timed_mutex> _(mutex_);
 
     return internal_db_.size();
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::add_or_modify(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::add_or_modify(
         Key&& key,
         Value&& value)
 {
@@ -150,13 +188,168 @@ bool SafeDatabase<Key, Value>::add_or_modify(
     }
 }
 
-template <typename Key, typename Value>
-bool SafeDatabase<Key, Value>::add_or_modify(
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::add_or_modify(
         const Key& key,
         const Value& value)
 {
     return add_or_modify(std::move(Key(key)), std::move(Value(value)));
 }
 
+template <typename Key, typename Value, typename Container>
+bool SafeDatabase<Key, Value, Container>::read(
+        const Key& key,
+        const std::function<void(const Value&)>& visitor) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = internal_db_.find(key);
+    if (it == internal_db_.end())
+    {
+        return false;
+    }
+
+    visitor(it->second);
+    return true;
+}
+
+template <typename Key, typename Value, typename Container>
+void SafeDatabase<Key, Value, Container>::for_each(
+        const std::function<void(const Key&, const Value&)>& visitor) const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    for (const auto& it : internal_db_)
+    {
+        visitor(it.first, it.second);
+    }
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int SafeDatabase<Key, Value, Container>::add_batch(
+        std::vector<std::pair<Key, Value>>&& values)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    unsigned int added = 0;
+    for (auto& value : values)
+    {
+        if (internal_db_.insert(std::pair<Key, Value>(std::move(value.first), std::move(value.second))).second)
+        {
+            added++;
+        }
+    }
+
+    return added;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int SafeDatabase<Key, Value, Container>::erase_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    unsigned int erased = 0;
+    for (auto it = internal_db_.begin(); it != internal_db_.end();)
+    {
+        if (predicate(it->first, it->second))
+        {
+            it = internal_db_.erase(it);
+            erased++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return erased;
+}
+
+template <typename Key, typename Value, typename Container>
+unsigned int SafeDatabase<Key, Value, Container>::modify_if(
+        const std::function<bool(const Key&, const Value&)>& predicate,
+        const std::function<void(const Key&, Value&)>& modifier)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    unsigned int modified = 0;
+    for (auto& it : internal_db_)
+    {
+        if (predicate(it.first, it.second))
+        {
+            modifier(it.first, it.second);
+            modified++;
+        }
+    }
+
+    return modified;
+}
+
+template <typename Key, typename Value, typename Container>
+std::vector<std::pair<Key, Value>> SafeDatabase<Key, Value, Container>::extract_if(
+        const std::function<bool(const Key&, const Value&)>& predicate)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    std::vector<std::pair<Key, Value>> extracted;
+    for (auto it = internal_db_.begin(); it != internal_db_.end();)
+    {
+        if (predicate(it->first, it->second))
+        {
+            it = extract_element_(it, extracted, 0);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return extracted;
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename C>
+auto SafeDatabase<Key, Value, Container>::extract_element_(
+        typename C::iterator it,
+        std::vector<std::pair<Key, Value>>& extracted,
+        int)
+-> decltype(std::declval<C&>().extract(it), typename C::iterator())
+{
+    auto next = std::next(it);
+    auto node = internal_db_.extract(it);
+    extracted.emplace_back(std::move(node.key()), std::move(node.mapped()));
+    return next;
+}
+
+template <typename Key, typename Value, typename Container>
+template <typename C>
+typename C::iterator SafeDatabase<Key, Value, Container>::extract_element_(
+        typename C::iterator it,
+        std::vector<std::pair<Key, Value>>& extracted,
+        long)
+{
+    return extract_copying_key_(it, extracted, std::is_copy_constructible<Key>());
+}
+
+template <typename Key, typename Value, typename Container>
+typename Container::iterator SafeDatabase<Key, Value, Container>::extract_copying_key_(
+        typename Container::iterator it,
+        std::vector<std::pair<Key, Value>>& extracted,
+        std::true_type /* copyable key */)
+{
+    extracted.emplace_back(it->first, std::move(it->second));
+    return internal_db_.erase(it);
+}
+
+template <typename Key, typename Value, typename Container>
+typename Container::iterator SafeDatabase<Key, Value, Container>::extract_copying_key_(
+        typename Container::iterator,
+        std::vector<std::pair<Key, Value>>&,
+        std::false_type /* copyable key */)
+{
+    throw UnsupportedException("Keys of this database could not be extracted, as they could not be copied.");
+}
+
 } /* namespace utils */
 } /* namespace eprosima */
@@ -0,0 +1,313 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace eprosima {
+namespace utils {
+
+/////
+// ShardedSafeDatabaseIterator
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardsLock::ShardsLock(
+        const std::vector<DatabaseShard<Key, Value>>* shards,
+        std::size_t first_shard,
+        std::size_t last_shard)
+    : shards_(shards)
+    , first_shard_(first_shard)
+    , last_shard_(last_shard)
+{
+    // Always locked in the same order
+    for (std::size_t i = first_shard_; i < last_shard_; ++i)
+    {
+        (*shards_)[i].mutex.lock_shared();
+    }
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardsLock::~ShardsLock()
+{
+    for (std::size_t i = first_shard_; i < last_shard_; ++i)
+    {
+        (*shards_)[i].mutex.unlock_shared();
+    }
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardedSafeDatabaseIterator(
+        const std::vector<DatabaseShard<Key, Value>>* shards)
+    : shards_(shards)
+    , shard_(0)
+    , last_shard_(shards->size())
+    , lock_(std::make_shared<ShardsLock>(shards, 0, shards->size()))
+{
+    it_ = (*shards_)[shard_].data.begin();
+    skip_empty_shards_();
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardedSafeDatabaseIterator(
+        const std::vector<DatabaseShard<Key, Value>>* shards,
+        std::size_t shard,
+        const Key& key)
+    : shards_(shards)
+    , shard_(shard)
+    , last_shard_(shard + 1)
+    , lock_(std::make_shared<ShardsLock>(shards, shard, shard + 1))
+{
+    it_ = (*shards_)[shard_].data.find(key);
+    skip_empty_shards_();
+}
+
+template <typename Key, typename Value>
+typename ShardedSafeDatabaseIterator<Key, Value>::reference ShardedSafeDatabaseIterator<Key, Value>::operator *() const
+{
+    return *it_;
+}
+
+template <typename Key, typename Value>
+typename ShardedSafeDatabaseIterator<Key, Value>::pointer ShardedSafeDatabaseIterator<Key, Value>::operator ->() const
+{
+    return &(*it_);
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>& ShardedSafeDatabaseIterator<Key, Value>::operator ++()
+{
+    ++it_;
+    skip_empty_shards_();
+    return *this;
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabaseIterator<Key, Value>::operator ++(
+        int)
+{
+    ShardedSafeDatabaseIterator<Key, Value> previous(*this);
+    ++(*this);
+    return previous;
+}
+
+template <typename Key, typename Value>
+bool ShardedSafeDatabaseIterator<Key, Value>::operator ==(
+        const ShardedSafeDatabaseIterator& other) const noexcept
+{
+    // Every end iterator is equal, whatever the shards it locks
+    if (shards_ == nullptr || other.shards_ == nullptr)
+    {
+        return shards_ == other.shards_;
+    }
+    return shard_ == other.shard_ && it_ == other.it_;
+}
+
+template <typename Key, typename Value>
+bool ShardedSafeDatabaseIterator<Key, Value>::operator !=(
+        const ShardedSafeDatabaseIterator& other) const noexcept
+{
+    return !(*this == other);
+}
+
+template <typename Key, typename Value>
+void ShardedSafeDatabaseIterator<Key, Value>::skip_empty_shards_()
+{
+    while (it_ == (*shards_)[shard_].data.end())
+    {
+        if (++shard_ == last_shard_)
+        {
+            // Become an end iterator, releasing its reference to the locks
+            shards_ = nullptr;
+            shard_ = 0;
+            last_shard_ = 0;
+            it_ = typename std::map<Key, Value>::const_iterator();
+            lock_.reset();
+            return;
+        }
+        it_ = (*shards_)[shard_].data.begin();
+    }
+}
+
+/////
+// ShardedSafeDatabase
+
+template <typename Key, typename Value, typename Hash>
+constexpr std::size_t ShardedSafeDatabase<Key, Value, Hash>::DEFAULT_SHARDS;
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabase<Key, Value, Hash>::ShardedSafeDatabase(
+        std::size_t shards /* = DEFAULT_SHARDS */,
+        Hash hash /* = Hash() */)
+    : hash_(std::move(hash))
+    , shards_(std::max<std::size_t>(shards, 1))
+{
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add(
+        Key&& key,
+        Value&& value)
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto res = shard.data.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+
+    return res.second;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::modify(
+        const Key& key,
+        Value&& value)
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto it = shard.data.find(key);
+    if (it == shard.data.end())
+    {
+        return false;
+    }
+
+    it->second = std::move(value);
+
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto it = shard.data.find(key);
+    if (it == shard.data.end())
+    {
+        // Add new value
+        shard.data.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+        return true;
+    }
+    else
+    {
+        // Modify already existent value
+        it->second = std::move(value);
+        return false;
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::erase(
+        const Key& key)
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    return shard.data.erase(key) != 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::is(
+        const Key& key) const
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::shared_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    return shard.data.find(key) != shard.data.end();
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::find(
+        const Key& key) const
+{
+    return ShardedSafeDatabaseIterator<Key, Value>(&shards_, shard_index_(key), key);
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::begin() const
+{
+    return ShardedSafeDatabaseIterator<Key, Value>(&shards_);
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::end() const
+{
+    return ShardedSafeDatabaseIterator<Key, Value>();
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add(
+        const Key& key,
+        const Value& value)
+{
+    return add(Key(key), Value(value));
+}
+
+template <typename Key, typename Value, typename Hash>
+Value ShardedSafeDatabase<Key, Value, Hash>::at(
+        const Key& key) const
+{
+    DatabaseShard<Key, Value>& shard = shard_(key);
+    std::shared_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    return shard.data.at(key);
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int ShardedSafeDatabase<Key, Value, Hash>::size() const noexcept
+{
+    std::size_t size = 0;
+    for (const auto& shard : shards_)
+    {
+        std::shared_lock<std::shared_timed_mutex> _(shard.mutex);
+        size += shard.data.size();
+    }
+    return static_cast<unsigned int>(size);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add_or_modify(
+        const Key& key,
+        const Value& value)
+{
+    return add_or_modify(Key(key), Value(value));
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t ShardedSafeDatabase<Key, Value, Hash>::shard_count() const noexcept
+{
+    return shards_.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t ShardedSafeDatabase<Key, Value, Hash>::shard_index_(
+        const Key& key) const
+{
+    return hash_(key) % shards_.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+DatabaseShard<Key, Value>& ShardedSafeDatabase<Key, Value, Hash>::shard_(
+        const Key& key) const
+{
+    return shards_[shard_index_(key)];
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
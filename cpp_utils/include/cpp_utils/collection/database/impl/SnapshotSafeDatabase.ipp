@@ -0,0 +1,318 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <cpp_utils/memory/HazardPointer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/////
+// SnapshotSafeDatabaseIterator
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value>::SnapshotSafeDatabaseIterator(
+        std::shared_ptr<const DatabaseSnapshot<Key, Value>> snapshot,
+        typename std::map<Key, Value>::const_iterator it)
+    : snapshot_(std::move(snapshot))
+    , it_(it)
+{
+    check_end_();
+}
+
+template <typename Key, typename Value>
+typename SnapshotSafeDatabaseIterator<Key, Value>::reference SnapshotSafeDatabaseIterator<Key, Value>::operator *()
+const
+{
+    return *it_;
+}
+
+template <typename Key, typename Value>
+typename SnapshotSafeDatabaseIterator<Key, Value>::pointer SnapshotSafeDatabaseIterator<Key, Value>::operator ->()
+const
+{
+    return &(*it_);
+}
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value>& SnapshotSafeDatabaseIterator<Key, Value>::operator ++()
+{
+    ++it_;
+    check_end_();
+    return *this;
+}
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value> SnapshotSafeDatabaseIterator<Key, Value>::operator ++(
+        int)
+{
+    SnapshotSafeDatabaseIterator copy(*this);
+    ++(*this);
+    return copy;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabaseIterator<Key, Value>::operator ==(
+        const SnapshotSafeDatabaseIterator& other) const noexcept
+{
+    // Every end iterator is equal, whatever the snapshot it iterated
+    if (!snapshot_ || !other.snapshot_)
+    {
+        return snapshot_ == other.snapshot_;
+    }
+    return it_ == other.it_;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabaseIterator<Key, Value>::operator !=(
+        const SnapshotSafeDatabaseIterator& other) const noexcept
+{
+    return !(*this == other);
+}
+
+template <typename Key, typename Value>
+void SnapshotSafeDatabaseIterator<Key, Value>::check_end_()
+{
+    if (snapshot_ && it_ == snapshot_->data.end())
+    {
+        // Become an end iterator, releasing its reference to the snapshot
+        snapshot_.reset();
+    }
+}
+
+/////
+// SnapshotSafeDatabase
+
+template <typename Key, typename Value>
+SnapshotSafeDatabase<Key, Value>::SnapshotSafeDatabase()
+    : current_owner_(std::make_shared<DatabaseSnapshot<Key, Value>>())
+{
+    current_.store(current_owner_.get());
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::add(
+        Key&& key,
+        Value&& value)
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+
+    if (current_owner_->data.count(key) != 0)
+    {
+        return false;
+    }
+
+    auto snapshot = std::make_shared<DatabaseSnapshot<Key, Value>>(*current_owner_);
+    snapshot->data.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+    publish_(std::move(snapshot));
+
+    return true;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::modify(
+        const Key& key,
+        Value&& value)
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+
+    if (current_owner_->data.count(key) == 0)
+    {
+        return false;
+    }
+
+    auto snapshot = std::make_shared<DatabaseSnapshot<Key, Value>>(*current_owner_);
+    snapshot->data.find(key)->second = std::move(value);
+    publish_(std::move(snapshot));
+
+    return true;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+
+    auto snapshot = std::make_shared<DatabaseSnapshot<Key, Value>>(*current_owner_);
+    auto it = snapshot->data.find(key);
+    bool added = it == snapshot->data.end();
+    if (added)
+    {
+        // Add new value
+        snapshot->data.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+    }
+    else
+    {
+        // Modify existing value
+        it->second = std::move(value);
+    }
+    publish_(std::move(snapshot));
+
+    return added;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::erase(
+        const Key& key)
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+
+    if (current_owner_->data.count(key) == 0)
+    {
+        return false;
+    }
+
+    auto snapshot = std::make_shared<DatabaseSnapshot<Key, Value>>(*current_owner_);
+    snapshot->data.erase(key);
+    publish_(std::move(snapshot));
+
+    return true;
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::is(
+        const Key& key) const
+{
+    HazardPointer hazard;
+    const DatabaseSnapshot<Key, Value>* snapshot = hazard.protect(current_);
+
+    return snapshot->data.find(key) != snapshot->data.end();
+}
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value> SnapshotSafeDatabase<Key, Value>::find(
+        const Key& key) const
+{
+    auto snapshot = acquire_();
+    auto it = snapshot->data.find(key);
+    return SnapshotSafeDatabaseIterator<Key, Value>(std::move(snapshot), it);
+}
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value> SnapshotSafeDatabase<Key, Value>::begin() const
+{
+    auto snapshot = acquire_();
+    auto it = snapshot->data.begin();
+    return SnapshotSafeDatabaseIterator<Key, Value>(std::move(snapshot), it);
+}
+
+template <typename Key, typename Value>
+SnapshotSafeDatabaseIterator<Key, Value> SnapshotSafeDatabase<Key, Value>::end() const
+{
+    return SnapshotSafeDatabaseIterator<Key, Value>();
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::add(
+        const Key& key,
+        const Value& value)
+{
+    Key key_copy = key;
+    Value value_copy = value;
+    return add(std::move(key_copy), std::move(value_copy));
+}
+
+template <typename Key, typename Value>
+Value SnapshotSafeDatabase<Key, Value>::at(
+        const Key& key) const
+{
+    HazardPointer hazard;
+    const DatabaseSnapshot<Key, Value>* snapshot = hazard.protect(current_);
+
+    return snapshot->data.at(key);
+}
+
+template <typename Key, typename Value>
+unsigned int SnapshotSafeDatabase<Key, Value>::size() const noexcept
+{
+    HazardPointer hazard;
+    const DatabaseSnapshot<Key, Value>* snapshot = hazard.protect(current_);
+
+    return static_cast<unsigned int>(snapshot->data.size());
+}
+
+template <typename Key, typename Value>
+bool SnapshotSafeDatabase<Key, Value>::add_or_modify(
+        const Key& key,
+        const Value& value)
+{
+    Key key_copy = key;
+    Value value_copy = value;
+    return add_or_modify(std::move(key_copy), std::move(value_copy));
+}
+
+template <typename Key, typename Value>
+std::shared_ptr<const std::map<Key, Value>> SnapshotSafeDatabase<Key, Value>::snapshot() const
+{
+    auto snapshot = acquire_();
+    const std::map<Key, Value>* data = &snapshot->data;
+    return std::shared_ptr<const std::map<Key, Value>>(std::move(snapshot), data);
+}
+
+template <typename Key, typename Value>
+unsigned int SnapshotSafeDatabase<Key, Value>::retired_count() const
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+
+    return static_cast<unsigned int>(retired_.size());
+}
+
+template <typename Key, typename Value>
+std::shared_ptr<const DatabaseSnapshot<Key, Value>> SnapshotSafeDatabase<Key, Value>::acquire_() const
+{
+    HazardPointer hazard;
+    const DatabaseSnapshot<Key, Value>* snapshot = hazard.protect(current_);
+
+    // The snapshot is still owned by the database or its retired list while protected
+    return snapshot->shared_from_this();
+}
+
+template <typename Key, typename Value>
+void SnapshotSafeDatabase<Key, Value>::publish_(
+        std::shared_ptr<DatabaseSnapshot<Key, Value>> snapshot)
+{
+    current_.store(snapshot.get(), std::memory_order_seq_cst);
+
+    retired_.push_back(std::move(current_owner_));
+    current_owner_ = std::move(snapshot);
+
+    reclaim_();
+}
+
+template <typename Key, typename Value>
+void SnapshotSafeDatabase<Key, Value>::reclaim_()
+{
+    std::vector<const void*> protected_pointers = HazardPointerDomain::global().protected_pointers();
+
+    // Dropping the reference does not destroy a snapshot still referenced by an iterator
+    retired_.erase(
+        std::remove_if(
+            retired_.begin(),
+            retired_.end(),
+            [&protected_pointers](const std::shared_ptr<const DatabaseSnapshot<Key, Value>>& snapshot)
+            {
+                return !std::binary_search(protected_pointers.begin(), protected_pointers.end(), snapshot.get());
+            }),
+        retired_.end());
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,637 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlatHashMap.ipp
+ */
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define CPP_UTILS_FLAT_HASH_MAP_SSE2
+#endif // if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif // if defined(_MSC_VER)
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+/////
+// FlatHashMapIterator
+
+template <typename T>
+FlatHashMapIterator<T>::FlatHashMapIterator(
+        const std::int8_t* control,
+        T* slot,
+        const std::int8_t* control_end) noexcept
+    : control_(control)
+    , slot_(slot)
+    , control_end_(control_end)
+{
+    skip_free_();
+}
+
+template <typename T>
+template <typename U, typename>
+FlatHashMapIterator<T>::FlatHashMapIterator(
+        const FlatHashMapIterator<U>& other) noexcept
+    : control_(other.control_)
+    , slot_(other.slot_)
+    , control_end_(other.control_end_)
+{
+}
+
+template <typename T>
+typename FlatHashMapIterator<T>::reference FlatHashMapIterator<T>::operator *() const noexcept
+{
+    return *slot_;
+}
+
+template <typename T>
+typename FlatHashMapIterator<T>::pointer FlatHashMapIterator<T>::operator ->() const noexcept
+{
+    return slot_;
+}
+
+template <typename T>
+FlatHashMapIterator<T>& FlatHashMapIterator<T>::operator ++() noexcept
+{
+    ++control_;
+    ++slot_;
+    skip_free_();
+    return *this;
+}
+
+template <typename T>
+FlatHashMapIterator<T> FlatHashMapIterator<T>::operator ++(
+        int) noexcept
+{
+    FlatHashMapIterator copy(*this);
+    ++(*this);
+    return copy;
+}
+
+template <typename T>
+bool FlatHashMapIterator<T>::operator ==(
+        const FlatHashMapIterator& other) const noexcept
+{
+    return control_ == other.control_;
+}
+
+template <typename T>
+bool FlatHashMapIterator<T>::operator !=(
+        const FlatHashMapIterator& other) const noexcept
+{
+    return !(*this == other);
+}
+
+template <typename T>
+void FlatHashMapIterator<T>::skip_free_() noexcept
+{
+    // Free slots have negative control bytes
+    while (control_ != control_end_ && *control_ < 0)
+    {
+        ++control_;
+        ++slot_;
+    }
+}
+
+/////
+// FlatHashMap
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+constexpr typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash,
+        KeyEqual>::GROUP_SIZE;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+constexpr std::int8_t FlatHashMap<Key, Value, Hash, KeyEqual>::EMPTY;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+constexpr std::int8_t FlatHashMap<Key, Value, Hash, KeyEqual>::DELETED;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>::FlatHashMap(
+        size_type capacity /* = 0 */,
+        Hash hash /* = Hash() */,
+        KeyEqual equal /* = KeyEqual() */)
+    : hash_function_(std::move(hash))
+    , equal_(std::move(equal))
+{
+    reserve(capacity);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>::FlatHashMap(
+        const FlatHashMap& other)
+    : FlatHashMap(0, other.hash_function_, other.equal_)
+{
+    // Delegated constructor has finished, so the destructor frees the elements copied if one copy throws
+    reserve(other.size_);
+    for (const value_type& value : other)
+    {
+        insert_(value);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>::FlatHashMap(
+        FlatHashMap&& other) noexcept
+    : hash_function_(other.hash_function_)
+    , equal_(other.equal_)
+{
+    swap(other);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>& FlatHashMap<Key, Value, Hash, KeyEqual>::operator =(
+        const FlatHashMap& other)
+{
+    if (this != &other)
+    {
+        FlatHashMap copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>& FlatHashMap<Key, Value, Hash, KeyEqual>::operator =(
+        FlatHashMap&& other) noexcept
+{
+    swap(other);
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+FlatHashMap<Key, Value, Hash, KeyEqual>::~FlatHashMap()
+{
+    clear();
+
+    if (capacity_ > 0)
+    {
+        ::operator delete(control_, std::align_val_t(GROUP_SIZE));
+        std::allocator<value_type>().deallocate(slots_, capacity_);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::begin() noexcept
+{
+    return iterator_at_(0);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::const_iterator FlatHashMap<Key, Value, Hash,
+        KeyEqual>::begin() const noexcept
+{
+    return iterator_at_(0);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::end() noexcept
+{
+    return iterator_at_(capacity_);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::const_iterator FlatHashMap<Key, Value, Hash,
+        KeyEqual>::end() const noexcept
+{
+    return iterator_at_(capacity_);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash,
+        KeyEqual>::size() const noexcept
+{
+    return size_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool FlatHashMap<Key, Value, Hash, KeyEqual>::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash,
+        KeyEqual>::capacity() const noexcept
+{
+    return capacity_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::pair<typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator, bool> FlatHashMap<Key, Value, Hash,
+        KeyEqual>::insert(
+        value_type&& value)
+{
+    return insert_(std::move(value));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::pair<typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator, bool> FlatHashMap<Key, Value, Hash,
+        KeyEqual>::insert(
+        const value_type& value)
+{
+    return insert_(value);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::find(
+        const Key& key)
+{
+    return iterator_at_(find_index_(key, hash_(key)));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::const_iterator FlatHashMap<Key, Value, Hash, KeyEqual>::find(
+        const Key& key) const
+{
+    return iterator_at_(find_index_(key, hash_(key)));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash, KeyEqual>::count(
+        const Key& key) const
+{
+    return find_index_(key, hash_(key)) != capacity_ ? 1 : 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+Value& FlatHashMap<Key, Value, Hash, KeyEqual>::at(
+        const Key& key)
+{
+    size_type index = find_index_(key, hash_(key));
+    if (index == capacity_)
+    {
+        throw std::out_of_range("FlatHashMap::at: key not found.");
+    }
+    return slots_[index].second;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const Value& FlatHashMap<Key, Value, Hash, KeyEqual>::at(
+        const Key& key) const
+{
+    size_type index = find_index_(key, hash_(key));
+    if (index == capacity_)
+    {
+        throw std::out_of_range("FlatHashMap::at: key not found.");
+    }
+    return slots_[index].second;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash, KeyEqual>::erase(
+        const Key& key)
+{
+    size_type index = find_index_(key, hash_(key));
+    if (index == capacity_)
+    {
+        return 0;
+    }
+    erase_index_(index);
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::erase(
+        const_iterator position)
+{
+    size_type index = static_cast<size_type>(position.control_ - control_);
+    erase_index_(index);
+
+    // Slots are not moved when erasing, so next element is after this slot
+    return iterator_at_(index + 1);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::erase(
+        iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatHashMap<Key, Value, Hash, KeyEqual>::clear() noexcept
+{
+    for (size_type i = 0; i < capacity_ && size_ > 0; ++i)
+    {
+        if (control_[i] >= 0)
+        {
+            slots_[i].~value_type();
+            size_--;
+        }
+    }
+
+    if (capacity_ > 0)
+    {
+        std::memset(control_, EMPTY, capacity_);
+    }
+    deleted_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatHashMap<Key, Value, Hash, KeyEqual>::reserve(
+        size_type count)
+{
+    size_type capacity = capacity_for_(count);
+    if (count > 0 && capacity > capacity_)
+    {
+        rehash_(capacity);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatHashMap<Key, Value, Hash, KeyEqual>::swap(
+        FlatHashMap& other) noexcept
+{
+    std::swap(control_, other.control_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(deleted_, other.deleted_);
+    std::swap(hash_function_, other.hash_function_);
+    std::swap(equal_, other.equal_);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::size_t FlatHashMap<Key, Value, Hash, KeyEqual>::hash_(
+        const Key& key) const
+{
+    // Finalizer of MurmurHash3, so consecutive keys do not share the same group
+    std::uint64_t hash = static_cast<std::uint64_t>(hash_function_(key));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return static_cast<std::size_t>(hash);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::uint32_t FlatHashMap<Key, Value, Hash, KeyEqual>::match_(
+        const std::int8_t* group,
+        std::int8_t value) noexcept
+{
+#if defined(CPP_UTILS_FLAT_HASH_MAP_SSE2)
+    __m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), bytes)));
+#else
+    std::uint32_t mask = 0;
+    for (size_type i = 0; i < GROUP_SIZE; ++i)
+    {
+        if (group[i] == value)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif // if defined(CPP_UTILS_FLAT_HASH_MAP_SSE2)
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::uint32_t FlatHashMap<Key, Value, Hash, KeyEqual>::match_free_(
+        const std::int8_t* group) noexcept
+{
+#if defined(CPP_UTILS_FLAT_HASH_MAP_SSE2)
+    // Empty and deleted are the only negative control bytes, so their sign bit is set
+    __m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+#else
+    std::uint32_t mask = 0;
+    for (size_type i = 0; i < GROUP_SIZE; ++i)
+    {
+        if (group[i] < 0)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif // if defined(CPP_UTILS_FLAT_HASH_MAP_SSE2)
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+unsigned int FlatHashMap<Key, Value, Hash, KeyEqual>::lowest_bit_(
+        std::uint32_t mask) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    unsigned int index = 0;
+    while ((mask & 1u) == 0)
+    {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif // if defined(__GNUC__) || defined(__clang__)
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash, KeyEqual>::find_index_(
+        const Key& key,
+        std::size_t hash) const
+{
+    if (size_ == 0)
+    {
+        return capacity_;
+    }
+
+    std::int8_t fingerprint = static_cast<std::int8_t>(hash & 0x7F);
+    size_type group_mask = capacity_ / GROUP_SIZE - 1;
+    size_type group = (hash >> 7) & group_mask;
+
+    // Triangular probing visits every group when the number of groups is a power of 2
+    for (size_type probe = 1;; ++probe)
+    {
+        const std::int8_t* control = control_ + group * GROUP_SIZE;
+        for (std::uint32_t mask = match_(control, fingerprint); mask != 0; mask &= mask - 1)
+        {
+            size_type index = group * GROUP_SIZE + lowest_bit_(mask);
+            if (equal_(slots_[index].first, key))
+            {
+                return index;
+            }
+        }
+
+        // The key would have been inserted in this group if it had an empty slot
+        if (match_(control, EMPTY) != 0 || probe > group_mask)
+        {
+            return capacity_;
+        }
+        group = (group + probe) & group_mask;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash,
+        KeyEqual>::find_free_index_(
+        std::size_t hash) const noexcept
+{
+    size_type group_mask = capacity_ / GROUP_SIZE - 1;
+    size_type group = (hash >> 7) & group_mask;
+
+    // There is always a free slot, as the map grows before it is full
+    for (size_type probe = 1;; ++probe)
+    {
+        std::uint32_t mask = match_free_(control_ + group * GROUP_SIZE);
+        if (mask != 0)
+        {
+            return group * GROUP_SIZE + lowest_bit_(mask);
+        }
+        group = (group + probe) & group_mask;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename V>
+std::pair<typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator, bool> FlatHashMap<Key, Value, Hash,
+        KeyEqual>::insert_(
+        V&& value)
+{
+    std::size_t hash = hash_(value.first);
+
+    size_type index = find_index_(value.first, hash);
+    if (index != capacity_)
+    {
+        return {iterator_at_(index), false};
+    }
+
+    // Grow at 7/8 of load, counting deleted slots as they also lengthen the probe sequences
+    if ((size_ + deleted_ + 1) * 8 > capacity_ * 7)
+    {
+        // If most of the load are deleted slots, rehash in the same capacity to purge them
+        rehash_(size_ + 1 > capacity_ / 2 ? capacity_for_(capacity_ + 1) : capacity_);
+    }
+
+    index = find_free_index_(hash);
+    new (slots_ + index) value_type(std::forward<V>(value));
+
+    if (control_[index] == DELETED)
+    {
+        deleted_--;
+    }
+    control_[index] = static_cast<std::int8_t>(hash & 0x7F);
+    size_++;
+
+    return {iterator_at_(index), true};
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatHashMap<Key, Value, Hash, KeyEqual>::erase_index_(
+        size_type index) noexcept
+{
+    slots_[index].~value_type();
+    size_--;
+
+    // If the group has an empty slot, no probe sequence continues after it, so the slot could be empty again
+    if (match_(control_ + (index & ~(GROUP_SIZE - 1)), EMPTY) != 0)
+    {
+        control_[index] = EMPTY;
+    }
+    else
+    {
+        control_[index] = DELETED;
+        deleted_++;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void FlatHashMap<Key, Value, Hash, KeyEqual>::rehash_(
+        size_type capacity)
+{
+    std::int8_t* control = static_cast<std::int8_t*>(::operator new(capacity, std::align_val_t(GROUP_SIZE)));
+    value_type* slots;
+    try
+    {
+        slots = std::allocator<value_type>().allocate(capacity);
+    }
+    catch (...)
+    {
+        ::operator delete(control, std::align_val_t(GROUP_SIZE));
+        throw;
+    }
+    std::memset(control, EMPTY, capacity);
+
+    std::int8_t* old_control = control_;
+    value_type* old_slots = slots_;
+    size_type old_capacity = capacity_;
+
+    control_ = control;
+    slots_ = slots;
+    capacity_ = capacity;
+    deleted_ = 0;
+
+    // Elements are moved without checking keys, as they are already unique
+    for (size_type i = 0; i < old_capacity; ++i)
+    {
+        if (old_control[i] >= 0)
+        {
+            std::size_t hash = hash_(old_slots[i].first);
+            size_type index = find_free_index_(hash);
+            new (slots_ + index) value_type(std::move(old_slots[i]));
+            control_[index] = static_cast<std::int8_t>(hash & 0x7F);
+            old_slots[i].~value_type();
+        }
+    }
+
+    if (old_capacity > 0)
+    {
+        ::operator delete(old_control, std::align_val_t(GROUP_SIZE));
+        std::allocator<value_type>().deallocate(old_slots, old_capacity);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::size_type FlatHashMap<Key, Value, Hash, KeyEqual>::capacity_for_(
+        size_type count) noexcept
+{
+    size_type capacity = GROUP_SIZE;
+    while (count * 8 > capacity * 7)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::iterator FlatHashMap<Key, Value, Hash, KeyEqual>::iterator_at_(
+        size_type index) noexcept
+{
+    return iterator(control_ + index, slots_ + index, control_ + capacity_);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename FlatHashMap<Key, Value, Hash, KeyEqual>::const_iterator FlatHashMap<Key, Value, Hash,
+        KeyEqual>::iterator_at_(
+        size_type index) const noexcept
+{
+    return const_iterator(control_ + index, slots_ + index, control_ + capacity_);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
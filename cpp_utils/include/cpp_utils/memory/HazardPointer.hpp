@@ -0,0 +1,149 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HazardPointer.hpp
+ *
+ * This file contains the hazard pointers used for deferred reclamation of objects read without locks.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Slot where a thread publishes the pointer it is reading, so it is not destroyed meanwhile.
+ *
+ * Slots are aligned to a cache line, so each thread only writes in its own line.
+ */
+struct alignas(64) HazardSlot
+{
+    //! Pointer protected, or nullptr.
+    std::atomic<const void*> pointer {nullptr};
+
+    //! Whether a thread owns this slot.
+    std::atomic<bool> in_use {false};
+
+    //! Next slot in the domain list. Not modified once the slot is in the list.
+    HazardSlot* next {nullptr};
+};
+
+/**
+ * @brief Set of every hazard slot of the process.
+ *
+ * Slots are added to a lock-free list and never removed nor freed, but they are reused when released.
+ * The global domain is never destroyed, so hazard pointers could be used from destructors of statics and
+ * thread locals at process exit.
+ * Threads keep the slots they release in a thread local cache, so acquiring one does not touch shared memory.
+ *
+ * Writers that retire objects must only destroy them when \c is_protected returns false for them.
+ */
+class HazardPointerDomain
+{
+public:
+
+    //! Domain used by every \c HazardPointer .
+    CPP_UTILS_DllAPI static HazardPointerDomain& global() noexcept;
+
+    //! Take a free slot, or create a new one if every slot is in use.
+    CPP_UTILS_DllAPI HazardSlot* acquire_slot();
+
+    //! Clear \c slot and make it available for other threads.
+    CPP_UTILS_DllAPI void release_slot(
+            HazardSlot* slot) noexcept;
+
+    //! Whether any slot is protecting \c pointer .
+    CPP_UTILS_DllAPI bool is_protected(
+            const void* pointer) const noexcept;
+
+    //! Every pointer protected at this moment, sorted, to check many retired objects at once.
+    CPP_UTILS_DllAPI std::vector<const void*> protected_pointers() const;
+
+protected:
+
+    //! First slot of the list.
+    std::atomic<HazardSlot*> head_ {nullptr};
+};
+
+/**
+ * @brief RAII hazard pointer that protects an object read from an atomic pointer from being destroyed.
+ *
+ * USAGE
+ * The reader calls \c protect with the atomic pointer it wants to read, and can use the object returned
+ * until \c reset is called or this object is destroyed.
+ * The writer exchanges the atomic pointer with a new object, and destroys the old one only when
+ * \c HazardPointerDomain::is_protected is false for it.
+ *
+ * Acquiring a hazard pointer takes a slot from the thread local cache, so it does not write shared memory.
+ * It could be moved, keeping the object protected. When destroyed, its slot goes to the cache of the
+ * thread that destroys it, or back to the domain if that cache has already been destroyed.
+ */
+class HazardPointer
+{
+public:
+
+    //! Acquire a slot of the global domain.
+    CPP_UTILS_DllAPI HazardPointer();
+
+    //! Clear and release the slot, if it has not been moved.
+    CPP_UTILS_DllAPI ~HazardPointer();
+
+    // Slot belongs to one object
+    HazardPointer(
+            const HazardPointer&) = delete;
+    HazardPointer& operator =(
+            const HazardPointer&) = delete;
+
+    //! Take the slot of \c other , and what it protects. \c other is left without slot.
+    CPP_UTILS_DllAPI HazardPointer(
+            HazardPointer&& other) noexcept;
+
+    //! Release the slot of this, and take the one of \c other . \c other is left without slot.
+    CPP_UTILS_DllAPI HazardPointer& operator =(
+            HazardPointer&& other) noexcept;
+
+    /**
+     * @brief Load \c source and protect the object it points to.
+     *
+     * It publishes the value loaded and loads it again until both match, so the object cannot have been
+     * retired between the load and the publication.
+     *
+     * @return object protected, that could be used until \c reset or destruction.
+     *
+     * @pre This object has not been moved.
+     */
+    template <typename T>
+    T* protect(
+            const std::atomic<T*>& source) noexcept;
+
+    //! Stop protecting the current object.
+    CPP_UTILS_DllAPI void reset() noexcept;
+
+protected:
+
+    //! Slot owned by this object. nullptr once moved.
+    HazardSlot* slot_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/memory/impl/HazardPointer.ipp>
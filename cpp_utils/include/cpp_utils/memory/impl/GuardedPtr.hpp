@@ -20,11 +20,10 @@
 
 #pragma once
 
-#include <memory>
-#include <mutex>
-#include <shared_mutex>
+#include <cstddef>
 
 #include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/memory/HazardPointer.hpp>
 
 namespace eprosima {
 namespace utils {
@@ -34,11 +33,12 @@ template <class T>
 class LesseePtr;
 
 /**
- * @brief Simple Ptr object that only holds a pointer and a shared locked mutex.
+ * @brief Simple Ptr object that only holds a pointer and the hazard pointer that protects it.
  *
- * This is created from a \c LesserPtr and will release the mutex (once) when destroyed.
+ * This is created from a \c LesseePtr and will release the hazard pointer when destroyed.
+ * Creating and destroying it only writes the hazard slot of the current thread, so it scales with threads.
  *
- * @note It should always be created with a shared blocked mutex, as it will unlock mutex in destruction.
+ * @note It should always be created with a hazard pointer already protecting the pointer.
  *
  * @tparam T Type of the internal data.
  */
@@ -61,14 +61,14 @@ public:
 
     //! Move constructor
     GuardedPtr(
-            GuardedPtr&&) noexcept = default;
+            GuardedPtr&& other) noexcept;
 
-    //! Move operator not allowed
+    //! Move operator
     GuardedPtr<T>& operator =(
-            GuardedPtr<T>&& other) noexcept = default;
+            GuardedPtr<T>&& other) noexcept;
 
-    //! Unlock the shared mutex
-    ~GuardedPtr();
+    //! Release the hazard pointer (done by its destructor)
+    ~GuardedPtr() = default;
 
     ///////////////////////
     // ACCESS DATA METHODS
@@ -105,19 +105,24 @@ protected:
     /**
      * @brief Construct a new Guarded Ptr from a \c LesseePtr
      *
-     * @warning \c data_reference must be shared locked before this creation
+     * @warning \c reference must be protected by \c hazard before this creation
      *
-     * @param data_reference
+     * @param hazard hazard pointer protecting \c reference .
+     * @param reference data, or nullptr if it is not valid.
      */
     GuardedPtr(
-            std::shared_ptr<InternalPtrData<T>> data_reference) noexcept;
+            HazardPointer&& hazard,
+            T* reference) noexcept;
 
     ////////////////////////////
     // INTERNAL VARIABLES
     ////////////////////////////
 
-    //! Internal shared data protected while this object exists
-    std::shared_ptr<InternalPtrData<T>> data_reference_;
+    //! Hazard pointer that protects the data while this object exists
+    HazardPointer hazard_;
+
+    //! Internal data protected while this object exists
+    T* reference_;
 
 };
 
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include <cpp_utils/exception/ValueAccessException.hpp>
 
 namespace eprosima {
@@ -25,44 +27,58 @@ namespace utils {
 
 template<typename T>
 GuardedPtr<T>::GuardedPtr(
-        std::shared_ptr<InternalPtrData<T>> data_reference) noexcept
-    : data_reference_(data_reference)
+        HazardPointer&& hazard,
+        T* reference) noexcept
+    : hazard_(std::move(hazard))
+    , reference_(reference)
 {
     // Do nothing
 }
 
 template<typename T>
-GuardedPtr<T>::~GuardedPtr()
+GuardedPtr<T>::GuardedPtr(
+        GuardedPtr&& other) noexcept
+    : hazard_(std::move(other.hazard_))
+    , reference_(other.reference_)
+{
+    other.reference_ = nullptr;
+}
+
+template<typename T>
+GuardedPtr<T>& GuardedPtr<T>::operator =(
+        GuardedPtr<T>&& other) noexcept
 {
-    // Avoid unlocking when no data is stored (only when created from a null)
-    if (data_reference_)
+    if (this != &other)
     {
-        data_reference_->unlock_shared();
+        hazard_ = std::move(other.hazard_);
+        reference_ = other.reference_;
+        other.reference_ = nullptr;
     }
+    return *this;
 }
 
 template<typename T>
 T* GuardedPtr<T>::operator ->() const noexcept
 {
-    return data_reference_->operator ->();
+    return reference_;
 }
 
 template<typename T>
 T& GuardedPtr<T>::operator *() const noexcept
 {
-    return data_reference_->operator *();
+    return *reference_;
 }
 
 template<typename T>
 T* GuardedPtr<T>::get() const noexcept
 {
-    return data_reference_->get();
+    return reference_;
 }
 
 template<typename T>
 GuardedPtr<T>::operator bool() const noexcept
 {
-    return data_reference_ && data_reference_->operator bool();
+    return reference_ != nullptr;
 }
 
 template<class T>
@@ -0,0 +1,43 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HazardPointer.ipp
+ */
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+T* HazardPointer::protect(
+        const std::atomic<T*>& source) noexcept
+{
+    T* pointer = source.load(std::memory_order_acquire);
+    while (true)
+    {
+        // The publication must be visible before reloading, so a writer that retires it afterwards sees it
+        slot_->pointer.store(pointer, std::memory_order_seq_cst);
+        T* current = source.load(std::memory_order_seq_cst);
+        if (current == pointer)
+        {
+            return pointer;
+        }
+        pointer = current;
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
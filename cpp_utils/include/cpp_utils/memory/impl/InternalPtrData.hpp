@@ -20,11 +20,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
-#include <mutex>
-#include <shared_mutex>
+#include <type_traits>
 
 #include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/memory/HazardPointer.hpp>
 
 namespace eprosima {
 namespace utils {
@@ -39,6 +41,13 @@ class OwnerPtr;
  * This will be used in a shared pointer to share information between the pointers, and will never be nullptr.
  * Its validity is checked by checking the internal ptr is or is not nullptr.
  *
+ * The data is protected from destruction with hazard pointers: readers publish the ptr in a slot of their
+ * own thread, and the data is only deleted when no slot protects it, once the internal ptr is nullptr.
+ * So protecting the data does not write any memory shared with other threads.
+ *
+ * How the data is destroyed depends on the child class: \c DeleterInternalPtrData calls a deleter function,
+ * and \c InplaceInternalPtrData calls the destructor of the data it stores.
+ *
  * @note It could only be created with data and dereferenced from OwnerPtr.
  *
  * @tparam T Type of the internal data.
@@ -62,19 +71,21 @@ public:
     /**
      * @brief Destruct object
      *
-     * It should not happen, but in case the ptr is still valid, it will be released.
+     * Child classes release the data in their destructors, as destroying it requires them.
      */
-    ~InternalPtrData() noexcept;
+    virtual ~InternalPtrData() noexcept = default;
 
     ///////////////////////
     // INTERACTION METHODS
     ///////////////////////
 
-    //! Lock this data in a shared way
-    void lock_shared() noexcept;
-
-    //! Unlock this data in a shared way
-    void unlock_shared() noexcept;
+    /**
+     * @brief Protect the data from destruction while \c hazard protects it.
+     *
+     * @return ptr to the data, or nullptr if it is not valid anymore.
+     */
+    T* protect(
+            HazardPointer& hazard) const noexcept;
 
     ///////////////////////
     // ACCESS DATA METHODS
@@ -101,40 +112,106 @@ protected:
     //! It requires friendship to use the constructor and \c dereference method.
     friend class OwnerPtr<T>;
 
-    /**
-     * @brief Construct a new Internal Ptr Data object with a ptr to the data and a specific deleter.
-     *
-     * This could only be constructed from OwnerPtr.
-     *
-     * @param reference Pointer to the data.
-     * @param deleter Deleter to use when dereferencing the data.
-     */
+    //! Construct a new Internal Ptr Data object with a ptr to the data.
     InternalPtrData(
-            T* reference,
-            const std::function<void(T*)>& deleter) noexcept;
+            T* reference) noexcept;
 
     /**
      * @brief Delete the internal data
      *
-     * It deletes the internal ptr using the specific deleter and locking the mutex (unique lock) so
-     * it assures no other ptr is using the data at that time.
+     * It sets the internal ptr to nullptr, so no new ptr could protect it, and waits until no hazard pointer
+     * protects it (grace period) to destroy it with \c destroy_reference_ .
+     * So it assures no other ptr is using the data at that time.
      */
     void release_reference_();
 
+    //! Destroy the data once no ptr protects it.
+    virtual void destroy_reference_(
+            T* reference) = 0;
+
     ////////////////////////////
     // INTERNAL VARIABLES
     ////////////////////////////
 
-    //! Pointer to the internal data
-    T* reference_;
+    //! Pointer to the internal data. Once set to nullptr, it never changes again.
+    std::atomic<T*> reference_;
+};
+
+/**
+ * @brief \c InternalPtrData of data created outside, destroyed by a specific deleter.
+ *
+ * @tparam T Type of the internal data.
+ */
+template <class T>
+class DeleterInternalPtrData final : public InternalPtrData<T>
+{
+public:
+
+    /**
+     * @brief Construct a new Internal Ptr Data object with a ptr to the data and a specific deleter.
+     *
+     * @param reference Pointer to the data.
+     * @param deleter Deleter to use when dereferencing the data.
+     */
+    DeleterInternalPtrData(
+            T* reference,
+            const std::function<void(T*)>& deleter) noexcept;
+
+    //! Move constructor
+    DeleterInternalPtrData(
+            DeleterInternalPtrData&& other) noexcept;
+
+    //! Release the data, in case it is still valid.
+    ~DeleterInternalPtrData() noexcept;
+
+protected:
 
-    //! Mutex to guard the data while using or destroying it
-    mutable std::shared_timed_mutex shared_mutex_;
+    //! Delete the data with the deleter given.
+    void destroy_reference_(
+            T* reference) override;
 
     //! Deleter to use when dereferencing the data
     std::function<void(T*)> deleter_;
 };
 
+/**
+ * @brief \c InternalPtrData that stores the data inside itself, created by \c make_owned .
+ *
+ * Created with \c std::make_shared , the control block, this data and the object share one allocation.
+ * The object is destroyed by calling its destructor, so it does not store any deleter function.
+ * Its memory is freed when the last owner or lessee referencing it is destroyed.
+ * Guarded ptrs only hold a raw ptr to the object, protected by a hazard pointer, so they do not keep the memory:
+ * the object (and this data) is only destroyed once no hazard pointer protects it.
+ *
+ * @tparam T Type of the internal data.
+ */
+template <class T>
+class InplaceInternalPtrData final : public InternalPtrData<T>
+{
+public:
+
+    //! Construct the object inside this data with \c args .
+    template <typename ... Args>
+    InplaceInternalPtrData(
+            Args&&... args);
+
+    //! Not movable, as the data lives inside it.
+    InplaceInternalPtrData(
+            InplaceInternalPtrData&& other) = delete;
+
+    //! Release the data before its storage is destroyed.
+    ~InplaceInternalPtrData() noexcept;
+
+protected:
+
+    //! Call the destructor of the data, whose memory belongs to this object.
+    void destroy_reference_(
+            T* reference) override;
+
+    //! Storage of the data.
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+};
+
 } /* namespace utils */
 } /* namespace eprosima */
 
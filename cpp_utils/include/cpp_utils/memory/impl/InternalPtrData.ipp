@@ -18,6 +18,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <new>
+#include <thread>
+#include <utility>
+
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/exception/ValueAccessException.hpp>
 
@@ -37,33 +42,19 @@ InternalPtrData<T>::InternalPtrData() noexcept
 template<typename T>
 InternalPtrData<T>::InternalPtrData(
         InternalPtrData&& other) noexcept
-    : reference_(std::move(other.reference_))
-    , shared_mutex_(std::move(other.shared_mutex_))
-    , deleter_(std::move(other.deleter_))
+    : reference_(other.reference_.exchange(nullptr))
 {
 }
 
-template<typename T>
-InternalPtrData<T>::~InternalPtrData() noexcept
-{
-    // Release data in case it still exists
-    release_reference_();
-}
-
 ///////////////////////
 // INTERACTION METHODS
 ///////////////////////
 
 template<typename T>
-void InternalPtrData<T>::lock_shared() noexcept
+T* InternalPtrData<T>::protect(
+        HazardPointer& hazard) const noexcept
 {
-    shared_mutex_.lock_shared();
-}
-
-template<typename T>
-void InternalPtrData<T>::unlock_shared() noexcept
-{
-    shared_mutex_.unlock_shared();
+    return hazard.protect(reference_);
 }
 
 ///////////////////////
@@ -73,25 +64,25 @@ void InternalPtrData<T>::unlock_shared() noexcept
 template<typename T>
 T* InternalPtrData<T>::operator ->() const noexcept
 {
-    return reference_;
+    return reference_.load(std::memory_order_acquire);
 }
 
 template<typename T>
 T& InternalPtrData<T>::operator *() const noexcept
 {
-    return *reference_;
+    return *reference_.load(std::memory_order_acquire);
 }
 
 template<typename T>
 T* InternalPtrData<T>::get() const noexcept
 {
-    return reference_;
+    return reference_.load(std::memory_order_acquire);
 }
 
 template<typename T>
 InternalPtrData<T>::operator bool() const noexcept
 {
-    return reference_ != nullptr;
+    return reference_.load(std::memory_order_acquire) != nullptr;
 }
 
 //////////////////////////////////
@@ -100,23 +91,97 @@ InternalPtrData<T>::operator bool() const noexcept
 
 template<typename T>
 InternalPtrData<T>::InternalPtrData(
-        T* reference,
-        const std::function<void(T*)>& deleter) noexcept
+        T* reference) noexcept
     : reference_(reference)
-    , deleter_(deleter)
 {
 }
 
 template<typename T>
 void InternalPtrData<T>::release_reference_()
 {
-    shared_mutex_.lock();
-    if (reference_ != nullptr)
+    // From here, no new ptr could protect the data
+    T* reference = reference_.exchange(nullptr, std::memory_order_seq_cst);
+    if (reference == nullptr)
     {
-        deleter_(reference_);
-        reference_ = nullptr;
+        return;
     }
-    shared_mutex_.unlock();
+
+    // Wait for the ptrs that already protect it. Guarded ptrs should be short lived, so yield first
+    unsigned int attempts = 0;
+    while (HazardPointerDomain::global().is_protected(reference))
+    {
+        if (++attempts < 64)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    destroy_reference_(reference);
+}
+
+/////
+// DeleterInternalPtrData
+
+template<typename T>
+DeleterInternalPtrData<T>::DeleterInternalPtrData(
+        T* reference,
+        const std::function<void(T*)>& deleter) noexcept
+    : InternalPtrData<T>(reference)
+    , deleter_(deleter)
+{
+}
+
+template<typename T>
+DeleterInternalPtrData<T>::DeleterInternalPtrData(
+        DeleterInternalPtrData&& other) noexcept
+    : InternalPtrData<T>(std::move(other))
+    , deleter_(std::move(other.deleter_))
+{
+}
+
+template<typename T>
+DeleterInternalPtrData<T>::~DeleterInternalPtrData() noexcept
+{
+    // Parent destructor could not call the override, so the data is released here
+    this->release_reference_();
+}
+
+template<typename T>
+void DeleterInternalPtrData<T>::destroy_reference_(
+        T* reference)
+{
+    deleter_(reference);
+}
+
+/////
+// InplaceInternalPtrData
+
+template<typename T>
+template<typename ... Args>
+InplaceInternalPtrData<T>::InplaceInternalPtrData(
+        Args&&... args)
+{
+    // If the constructor throws, the data is never set, so nothing is destroyed
+    T* reference = new (&storage_) T(std::forward<Args>(args)...);
+    this->reference_.store(reference, std::memory_order_release);
+}
+
+template<typename T>
+InplaceInternalPtrData<T>::~InplaceInternalPtrData() noexcept
+{
+    // Parent destructor could not call the override, so the data is released here
+    this->release_reference_();
+}
+
+template<typename T>
+void InplaceInternalPtrData<T>::destroy_reference_(
+        T* reference)
+{
+    reference->~T();
 }
 
 } /* namespace utils */
@@ -187,8 +187,7 @@ protected:
      *
      * Protected constructor that must be called from \c OwnerPtr .
      *
-     * @param data weak reference to the data.
-     * @param shared_mutex shared mutex between owner and this.
+     * @param data_reference data shared between owner and this.
      */
     LesseePtr(
             std::shared_ptr<InternalPtrData<T>> data_reference) noexcept;
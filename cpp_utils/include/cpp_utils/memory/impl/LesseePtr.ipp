@@ -53,19 +53,21 @@ T& LesseePtr<T>::operator *() const
 template<typename T>
 GuardedPtr<T> LesseePtr<T>::lock() const noexcept
 {
+    // Take a hazard slot of this thread, so no memory shared with other threads is written
+    HazardPointer hazard;
+
+    T* reference = nullptr;
     if (data_reference_)
     {
-        // Lock mutex
-        data_reference_->lock_shared();
-        // From here, the validity cannot change until releasing lock
+        // From here, the data cannot be destroyed until the hazard pointer is released
+        reference = data_reference_->protect(hazard);
     }
 
-    // Create a GuardedPtr that will unlock mutex in destruction
-    // It could be that data is not valid, and this GuardedPtr will be invalid, but still exist
-    // with a valid shared_ptr to an empty data.
-    // If data_reference_ is nullptr, Guarded will not be valid and so it will not unlock mutex.
+    // Create a GuardedPtr that will release the hazard pointer in destruction
+    // It could be that data is not valid, and this GuardedPtr will be invalid, but still exist.
     return GuardedPtr<T> (
-        data_reference_);
+        std::move(hazard),
+        reference);
 }
 
 template<typename T>
@@ -74,7 +76,7 @@ GuardedPtr<T> LesseePtr<T>::lock_with_exception() const
     auto guarded = lock();
     if (!guarded)
     {
-        // Internal mutex of guarded ptr would be released when guarded
+        // Hazard pointer of guarded ptr would be released when guarded
         // object exits scope (after throw).
         throw ValueAccessException(
                   "Trying to access a data not available anymore.");
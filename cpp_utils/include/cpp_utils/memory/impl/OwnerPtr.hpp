@@ -104,9 +104,9 @@ public:
      * @brief Destroys the data owned by this object without destroying the object itself.
      *
      * This makes this object to have no data, and it releases the old data.
-     * Thus, it must wait if the data is locked by lessees.
+     * Thus, it must wait if the data is locked by lessees (until every \c GuardedPtr to it is destroyed).
      *
-     * Using this method, the lessees created so far will be detached (this is, the mutex is no longer shared).
+     * Using this method, the lessees created so far will be detached (this is, the internal data is no longer shared).
      */
     void reset();
 
@@ -116,7 +116,7 @@ public:
      * This makes this object to destroy the old data.
      * Thus, it must wait if the data is locked by lessees.
      *
-     * Using this method, the lessees created so far will be detached (this is, the mutex is no longer shared).
+     * Using this method, the lessees created so far will be detached (this is, the internal data is no longer shared).
      */
     void reset(
             T* reference,
@@ -172,6 +172,11 @@ public:
 
 protected:
 
+    //! It requires friendship to set the internal data created in place.
+    template <class U, class ... Args>
+    friend OwnerPtr<U> make_owned(
+            Args&&... args);
+
     ////////////////////////////
     // INTERNAL VARIABLES
     ////////////////////////////
@@ -190,6 +195,25 @@ protected:
     static const std::function<void(T*)> DEFAULT_DELETER_;
 };
 
+////////////////////////////
+// FACTORY
+////////////////////////////
+
+/**
+ * @brief Create a new object of type \c T owned by a new \c OwnerPtr .
+ *
+ * The object, the data shared with the lessees and the shared ptr control block are created in one allocation
+ * (see \c InplaceInternalPtrData ), and the object is destroyed by its destructor, without a deleter function.
+ * Lessees and guarded ptrs created from it behave as for any other \c OwnerPtr .
+ *
+ * @param args arguments to construct the object.
+ *
+ * @throw any exception thrown by the constructor of \c T .
+ */
+template <class T, class ... Args>
+OwnerPtr<T> make_owned(
+        Args&&... args);
+
 ////////////////////////////
 // EXTERNAL OPERATORS
 ////////////////////////////
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/exception/ValueAccessException.hpp>
 
@@ -101,7 +103,7 @@ void OwnerPtr<T>::reset(
     }
     else
     {
-        data_reference_.reset(new InternalPtrData<T>(reference, deleter));
+        data_reference_.reset(new DeleterInternalPtrData<T>(reference, deleter));
     }
 }
 
@@ -145,6 +147,19 @@ std::function<void(T*)> OwnerPtr<T>::default_deleter()
     return OwnerPtr<T>::DEFAULT_DELETER_;
 }
 
+////////////////////////////
+// FACTORY
+////////////////////////////
+
+template <class T, class ... Args>
+OwnerPtr<T> make_owned(
+        Args&&... args)
+{
+    OwnerPtr<T> owner;
+    owner.data_reference_ = std::make_shared<InplaceInternalPtrData<T>>(std::forward<Args>(args)...);
+    return owner;
+}
+
 ////////////////////////////
 // EXTERNAL OPERATORS
 ////////////////////////////
@@ -30,7 +30,8 @@
  * This is the only object that will be able to create and destruct such data (has ownership).
  * This object can destroy the data at any time (by deleting object or \c reset method).
  * This object will delete the internal data by a specific deleter given (if no deleter given, use \c delete )
- * If deleting data occurs while a sub object is USING (not handling) the data, this object will wait (in a mutex)
+ * \c make_owned creates the data together with the owner in one allocation, and destroys it without deleter.
+ * If deleting data occurs while a sub object is USING (not handling) the data, this object will wait
  * until it is safe to erase it.
  *
  * - LESSEE PTR
@@ -46,10 +47,11 @@
  * again to the owner of the data.
  *
  * DATA PROTECTION
- * The data is protected by a shared mutex in a way that the owner can only remove it when no one is using it.
- * It is important to notice that this mutex does not protect access to data, it only protects it from destruction.
- * The shared mutex is used in shared mode from Lessee so that the data can be used by multiple threads.
- * The shared mutex is locked uniquely from the Owner so no Lessee can use it while destruction.
+ * The data is protected by hazard pointers in a way that the owner can only remove it when no one is using it.
+ * It is important to notice that this does not protect access to data, it only protects it from destruction.
+ * Each Lessee lock publishes the data in a hazard slot of its own thread, so the data can be used by multiple
+ * threads without them writing any shared memory.
+ * The Owner unsets the data so no new Lessee could lock it, and waits until no hazard slot protects it.
  *
  * USE CASE
  * Whenever an object must be created and deleted from a single point, but could be used from different
@@ -60,10 +62,11 @@
  * owner, and only if no lessee is using it at the moment.
  *
  * IMPLEMENTATION
- * The way it works, is that every \c OwnerPtr shares a mutex with every \c LesseePtr , so while the
+ * The way it works, is that every \c OwnerPtr shares an atomic ptr to the data with every \c LesseePtr , so while the
  * data is being blocked by a lessee, the owner cannot destroy it.
- * Whenever the object is used from a lessee, a new ptr is created and the mutex locked. When this ptr is deleted
- * the mutex is unlocked, and then the data could be destroyed.
+ * Whenever the object is used from a lessee, a new ptr is created and the data protected by a hazard pointer
+ * (see \c HazardPointer ). When this ptr is deleted the hazard pointer is released, and then the data could be
+ * destroyed.
  *
  * PROBLEMS
  * The main problem of this kind of object is that it could be blocked in destruction.
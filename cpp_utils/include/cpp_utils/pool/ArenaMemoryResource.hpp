@@ -0,0 +1,136 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ArenaMemoryResource.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/pool/PoolMemoryResource.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Monotonic \c std::pmr::memory_resource to build one message, that releases all its memory at once.
+ *
+ * Allocations are served consecutively from chunks of fixed size requested to the upstream resource,
+ * and deallocation does nothing. The whole memory is given back with \c release or on destruction.
+ *
+ * Unlike \c std::pmr::monotonic_buffer_resource , every chunk has the same size, so using a
+ * \c PoolMemoryResource as upstream (with a chunk size equal to one of its size classes)
+ * reuses the same chunks for each message without reaching the global allocator.
+ * Allocations that do not fit in a chunk get their own upstream allocation.
+ *
+ * This class is not thread safe.
+ */
+class ArenaMemoryResource : public std::pmr::memory_resource
+{
+public:
+
+    //! Default size in bytes of each chunk, the largest size class of \c PoolMemoryResource .
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = PoolMemoryResource::MAX_BLOCK_SIZE;
+
+    /**
+     * @brief Create a new ArenaMemoryResource.
+     *
+     * @param upstream resource the chunks are allocated from.
+     * @param chunk_size size in bytes of each chunk, including its internal header.
+     */
+    CPP_UTILS_DllAPI ArenaMemoryResource(
+            std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+            std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    //! Release every chunk to the upstream resource.
+    CPP_UTILS_DllAPI ~ArenaMemoryResource();
+
+    // Chunks belong to this object
+    ArenaMemoryResource(
+            const ArenaMemoryResource&) = delete;
+    ArenaMemoryResource& operator =(
+            const ArenaMemoryResource&) = delete;
+
+    /**
+     * @brief Give back every chunk to the upstream resource.
+     *
+     * @warning Memory allocated from this resource must not be used afterwards.
+     */
+    CPP_UTILS_DllAPI void release() noexcept;
+
+    //! Resource the chunks are allocated from.
+    CPP_UTILS_DllAPI std::pmr::memory_resource* upstream_resource() const noexcept;
+
+    //! Number of bytes allocated from this resource since the last release, without alignment padding.
+    CPP_UTILS_DllAPI std::size_t bytes_allocated() const noexcept;
+
+    //! Number of chunks currently allocated from upstream.
+    CPP_UTILS_DllAPI std::size_t chunks() const noexcept;
+
+protected:
+
+    //! Header at the beginning of each chunk, that links it with the previous one.
+    struct ChunkHeader
+    {
+        ChunkHeader* previous;
+        std::size_t size;
+    };
+
+    //! Override \c std::pmr::memory_resource::do_allocate
+    CPP_UTILS_DllAPI void* do_allocate(
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_deallocate . It does nothing.
+    CPP_UTILS_DllAPI void do_deallocate(
+            void* p,
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_is_equal
+    CPP_UTILS_DllAPI bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override;
+
+    //! Allocate a chunk of \c size bytes from upstream and link it to the chunk list.
+    ChunkHeader* new_chunk_(
+            std::size_t size);
+
+    //! Resource the chunks are allocated from.
+    std::pmr::memory_resource* upstream_;
+
+    //! Size of each regular chunk.
+    std::size_t chunk_size_;
+
+    //! Last chunk allocated, that links the rest.
+    ChunkHeader* last_chunk_;
+
+    //! Number of chunks allocated.
+    std::size_t chunks_;
+
+    //! Next free byte in the current chunk.
+    void* cursor_;
+
+    //! Free bytes left in the current chunk.
+    std::size_t remaining_;
+
+    //! Bytes requested since the last release.
+    std::size_t bytes_allocated_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,145 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HugePageMemoryResource.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+//! Configuration of a \c HugePageMemoryResource .
+struct HugePageConfiguration
+{
+    //! Allocations smaller than this size in bytes are forwarded to the upstream resource.
+    std::size_t minimum_size = 1024 * 1024;
+    //! Size in bytes of a huge page. Mappings are rounded up and aligned to it.
+    std::size_t huge_page_size = 2 * 1024 * 1024;
+    //! Use pages reserved for \c MAP_HUGETLB first.
+    bool use_hugetlb = true;
+    //! Advise the kernel to back mappings with transparent huge pages when \c MAP_HUGETLB is not used or fails.
+    bool use_transparent = true;
+    //! Bind each mapping to the NUMA node of the thread that allocates it.
+    bool numa_local = true;
+};
+
+/**
+ * @brief \c std::pmr::memory_resource that maps big allocations in huge pages, placed in the local NUMA node.
+ *
+ * It is meant as backing resource of big pools (see \c PoolConfiguration::memory_resource ), where
+ * huge pages reduce TLB misses and local placement avoids remote memory accesses.
+ *
+ * Each allocation of at least \c minimum_size bytes is an independent \c mmap , rounded up to the huge page size:
+ * - First with \c MAP_HUGETLB , that requires huge pages reserved in the system.
+ * - If it fails, with regular pages and \c madvise(MADV_HUGEPAGE) , so transparent huge pages are used if enabled.
+ * Before the memory is touched, the mapping is bound with \c mbind to the node of the CPU running the thread,
+ * so the pool should allocate from the thread that will use its elements.
+ * Failing to bind is not an error, the memory is then placed by the default policy.
+ *
+ * Smaller allocations, and every allocation in platforms other than Linux, are forwarded to the upstream resource.
+ *
+ * This class is thread safe.
+ */
+class HugePageMemoryResource : public std::pmr::memory_resource
+{
+public:
+
+    /**
+     * @brief Create a new HugePageMemoryResource.
+     *
+     * @param configuration huge page and NUMA options.
+     * @param upstream resource for small allocations, and for every one where huge pages are not supported.
+     *
+     * @throw InitializationException if the huge page size is not a power of 2.
+     */
+    CPP_UTILS_DllAPI HugePageMemoryResource(
+            HugePageConfiguration configuration = HugePageConfiguration(),
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    //! Resource used for small allocations.
+    CPP_UTILS_DllAPI std::pmr::memory_resource* upstream_resource() const noexcept;
+
+    //! Number of mappings done with \c MAP_HUGETLB .
+    CPP_UTILS_DllAPI unsigned int hugetlb_allocations() const noexcept;
+
+    //! Number of mappings done with regular pages (advised for transparent huge pages if configured).
+    CPP_UTILS_DllAPI unsigned int regular_allocations() const noexcept;
+
+    //! Number of mappings bound to the local NUMA node.
+    CPP_UTILS_DllAPI unsigned int numa_bound_allocations() const noexcept;
+
+    //! Whether huge page mappings are supported in this platform.
+    CPP_UTILS_DllAPI static bool is_supported() noexcept;
+
+protected:
+
+    //! Override \c std::pmr::memory_resource::do_allocate
+    CPP_UTILS_DllAPI void* do_allocate(
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_deallocate
+    CPP_UTILS_DllAPI void do_deallocate(
+            void* p,
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_is_equal
+    CPP_UTILS_DllAPI bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override;
+
+    //! Whether an allocation is mapped by this resource or forwarded to upstream.
+    bool is_mapped_(
+            std::size_t bytes,
+            std::size_t alignment) const noexcept;
+
+    //! Size of the mapping for an allocation of \c bytes .
+    std::size_t mapping_size_(
+            std::size_t bytes) const noexcept;
+
+    //! Map memory with regular pages aligned to the huge page size.
+    void* map_aligned_(
+            std::size_t size);
+
+    //! Bind \c size bytes at \c memory to the NUMA node of the current thread.
+    bool bind_local_(
+            void* memory,
+            std::size_t size) noexcept;
+
+    //! Huge page and NUMA options.
+    const HugePageConfiguration configuration_;
+
+    //! Resource for small allocations.
+    std::pmr::memory_resource* upstream_;
+
+    //! Mappings done with \c MAP_HUGETLB .
+    std::atomic<unsigned int> hugetlb_allocations_;
+
+    //! Mappings done with regular pages.
+    std::atomic<unsigned int> regular_allocations_;
+
+    //! Mappings bound to the local NUMA node.
+    std::atomic<unsigned int> numa_bound_allocations_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,9 +18,22 @@
 
 #pragma once
 
+#include <memory_resource>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/time/time_utils.hpp>
+
 namespace eprosima {
 namespace utils {
 
+//! Behaviour of a limited pool when every element is loaned and a new one is requested.
+enum class PoolExhaustionPolicy
+{
+    fail,           //! \c loan returns false
+    wait,           //! \c loan waits until an element is returned, or returns false on timeout
+    heap_fallback,  //! \c loan allocates a new element out of the pool, that is freed when returned
+};
+
 //! Data structure to store values for a Memory Pool Configuration.
 struct PoolConfiguration
 {
@@ -28,7 +41,7 @@ struct PoolConfiguration
     PoolConfiguration() = default;
 
     //! Constructor with parameters.
-    PoolConfiguration(
+    CPP_UTILS_DllAPI PoolConfiguration(
             unsigned int initial_size,
             unsigned int maximum_size,
             unsigned int batch_size) noexcept;
@@ -39,6 +52,33 @@ struct PoolConfiguration
     unsigned int maximum_size = 0;
     //! Number of elements to allocate when no free elements are available (without exceeding maximum).
     unsigned int batch_size = 1;
+    //! What to do when \c maximum_size elements are loaned and a new one is requested.
+    PoolExhaustionPolicy exhaustion_policy = PoolExhaustionPolicy::fail;
+    //! Maximum time to wait with \c PoolExhaustionPolicy::wait in milliseconds. 0 = No limit.
+    Duration_ms exhaustion_timeout = 0;
+    //! Time in milliseconds the usage must stay below \c trim_threshold to free unused memory. 0 = Never trim.
+    Duration_ms trim_idle_time = 0;
+    //! Fraction of the reserved elements in use under which the pool is considered idle.
+    float trim_threshold = 0.5f;
+    //! Resource to allocate the slabs of elements from (in pools that use slabs). nullptr = global new.
+    std::pmr::memory_resource* memory_resource = nullptr;
+};
+
+//! Occupancy statistics of a pool.
+struct PoolStatistics
+{
+    //! Elements currently loaned.
+    unsigned int in_use = 0;
+    //! Elements reserved and not loaned.
+    unsigned int free = 0;
+    //! Maximum number of elements loaned at the same time.
+    unsigned int high_water_mark = 0;
+    //! Number of memory allocations done by the pool.
+    unsigned int allocations = 0;
+    //! Number of loans that failed.
+    unsigned int failed_loans = 0;
+    //! Number of elements freed because the pool was idle.
+    unsigned int trimmed = 0;
 };
 
 /**
@@ -59,6 +99,9 @@ class IPool
 {
 public:
 
+    //! Default virtual destructor, so pools could be destroyed from the interface.
+    virtual ~IPool() = default;
+
     /**
      * @brief Get a new element from the pool.
      *
@@ -83,11 +126,21 @@ public:
     virtual bool return_loan(
             T* element) = 0;
 
+    /**
+     * @brief Current occupancy statistics of the pool.
+     *
+     * By default, it returns empty statistics, for pools that do not track them.
+     */
+    virtual PoolStatistics statistics() const;
+
 protected:
 
     /**
      * @brief Construct a new non-initialized element.
      *
+     * It is used by pools that allocate each element on its own (as \c LimitedPool and \c MagazinePool ).
+     * Pools that allocate elements in slabs (as \c UnboundedPool ) use \c construct_element_ instead.
+     *
      * By default, it calls \c new with default constructor.
      */
     virtual T* new_element_();
@@ -100,6 +153,26 @@ protected:
     virtual void delete_element_(
             T* element);
 
+    /**
+     * @brief Construct a new element in memory already allocated by the pool.
+     *
+     * It is used by pools that allocate elements in slabs (as \c UnboundedPool ).
+     *
+     * By default, it calls placement \c new with default constructor.
+     *
+     * @param memory memory aligned and big enough for a \c T .
+     */
+    virtual T* construct_element_(
+            void* memory);
+
+    /**
+     * @brief Destroy an element constructed with \c construct_element_ without freeing its memory.
+     *
+     * By default, it calls the element destructor.
+     */
+    virtual void destroy_element_(
+            T* element);
+
     /**
      * @brief Reset internal element information to reuse it.
      *
@@ -112,7 +185,9 @@ protected:
 /**
  * @brief Create a pool object depending on the configuration given.
  *
- * It creates the IPool specialization that better implements the given configuration.
+ * It creates the IPool specialization that better implements the given configuration:
+ * - \c UnboundedPool if \c maximum_size is 0.
+ * - \c LimitedPool otherwise.
  *
  * @tparam T Type of elements that the Pool will manage.
  * @param configuration Pool Configuration
@@ -0,0 +1,147 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LimitedPool.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <cpp_utils/pool/IPool.hpp>
+#include <cpp_utils/wait/CounterWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief This class implements a generic thread-safe reusable Pool with a fixed number of elements.
+ *
+ * ATTRIBUTES:
+ * - Every element is allocated in construction, so loan and return_loan never allocate memory.
+ * - Thread safe
+ * - Pool size limited to \c maximum_size
+ *
+ * When every element is loaned, \c loan follows the configuration \c exhaustion_policy :
+ * - \c fail : return false.
+ * - \c wait : wait until other thread returns an element, or return false after \c exhaustion_timeout .
+ * - \c heap_fallback : allocate a new element out of the pool, that is freed when returned.
+ *   These allocations are counted, so the pool size could be adjusted.
+ *
+ * @note The \c maximum_size elements are allocated in the constructor with \c IPool::new_element_ .
+ *
+ * @tparam T Type of the elements in the pool.
+ */
+template <typename T>
+class LimitedPool : public IPool<T>
+{
+public:
+
+    /**
+     * @brief Create a new LimitedPool object by a Pool Configuration given.
+     *
+     * @param configuration Pool Configuration. \c initial_size and \c batch_size are ignored.
+     *
+     * @throw InitializationException if \c maximum_size is 0.
+     */
+    LimitedPool(
+            PoolConfiguration configuration);
+
+    /**
+     * @brief Destroy the pool and all its elements.
+     *
+     * Threads waiting for an element are awaken without it.
+     */
+    ~LimitedPool();
+
+    /**
+     * @brief Override IPool::loan
+     *
+     * Take a free element if any, or follow the exhaustion policy otherwise.
+     *
+     * @return false if there are no free elements and the policy is \c fail , or \c wait and timeout is reached.
+     */
+    virtual bool loan(
+            T*& element) override;
+
+    /**
+     * @brief Override IPool::return_loan
+     *
+     * Return the element to the pool, or free it if it was allocated by \c heap_fallback policy.
+     *
+     * @throw InconsistencyException if there have been more released than reserved calls.
+     */
+    virtual bool return_loan(
+            T* element) override;
+
+    //! Override IPool::statistics
+    virtual PoolStatistics statistics() const override;
+
+    //! Number of elements not loaned.
+    unsigned int free_elements() const noexcept;
+
+    //! Number of elements allocated out of the pool with \c heap_fallback policy so far.
+    unsigned int heap_allocations() const noexcept;
+
+    //! Number of elements allocated out of the pool currently loaned.
+    unsigned int heap_elements_in_use() const noexcept;
+
+protected:
+
+    //! Take the last free element (\c elements_mutex_ must not be taken). There must be one.
+    T* take_free_element_();
+
+    //! Count a new element loaned, updating the high water mark.
+    void count_loan_() noexcept;
+
+    //! Pool configuration.
+    const PoolConfiguration configuration_;
+
+    //! Elements not loaned.
+    std::vector<T*> elements_;
+
+    //! Every element of the pool, to distinguish them from heap allocated ones. Not modified after construction.
+    std::unordered_set<T*> owned_elements_;
+
+    //! Protect \c elements_ .
+    mutable std::mutex elements_mutex_;
+
+    //! Number of free elements, to wait for them with \c wait policy.
+    event::CounterWaitHandler available_;
+
+    //! Heap allocations with \c heap_fallback policy.
+    std::atomic<unsigned int> heap_allocations_;
+
+    //! Heap allocated elements not returned yet.
+    std::atomic<unsigned int> heap_elements_in_use_;
+
+    //! Elements loaned, from the pool or the heap.
+    std::atomic<unsigned int> in_use_;
+
+    //! Maximum of \c in_use_ .
+    std::atomic<unsigned int> high_water_mark_;
+
+    //! Loans that returned false.
+    std::atomic<unsigned int> failed_loans_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/LimitedPool.ipp>
@@ -0,0 +1,200 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MagazinePool.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief This class implements a generic thread-safe reusable Pool without size limit.
+ *
+ * ATTRIBUTES:
+ * - Reuse freed elements without allocation.
+ * - Thread safe: elements could be loaned in one thread and returned in other.
+ * - No pool size limit
+ *
+ * Each thread keeps a cache of two magazines (arrays of up to \c magazine_size free elements), so loan and
+ * return_loan only access thread local data in most cases.
+ * When a thread runs out of free elements it exchanges its empty magazine by a full one from a global depot,
+ * and when its magazines are full it leaves one in the depot. Only these exchanges take a mutex, once every
+ * \c magazine_size operations at most.
+ * When the depot has no full magazines, \c batch_size new elements are allocated (at least one).
+ *
+ * The magazines of a thread are returned to the depot when the thread finishes.
+ *
+ * Each thread counts its own loans and returns, and \c statistics adds them, so loan and return_loan do not
+ * write shared counters. \c high_water_mark is not tracked, as it would require a counter shared by every thread,
+ * and it is always 0. Elements are never trimmed.
+ *
+ * @note \c initial_size elements are allocated in the constructor with \c IPool::new_element_ .
+ *
+ * @tparam T Type of the elements in the pool.
+ */
+template <typename T>
+class MagazinePool : public IPool<T>
+{
+public:
+
+    /**
+     * @brief Create a new MagazinePool object by a Pool Configuration given.
+     *
+     * @param configuration Pool Configuration. \c maximum_size is ignored.
+     * @param magazine_size maximum number of free elements in each magazine.
+     *
+     * @throw InitializationException if the pool configuration is not correct.
+     */
+    MagazinePool(
+            PoolConfiguration configuration,
+            unsigned int magazine_size = 64);
+
+    /**
+     * @brief Destroy the pool and every element allocated by it.
+     *
+     * @warning No thread must be using the pool, and every element loaned is destroyed as well.
+     */
+    ~MagazinePool();
+
+    /**
+     * @brief Override IPool::loan
+     *
+     * It takes an element from the current thread magazines, refilling them from the depot if empty.
+     */
+    virtual bool loan(
+            T*& element) override;
+
+    /**
+     * @brief Override IPool::return_loan
+     *
+     * It stores the element in the current thread magazines, leaving a full magazine in the depot if full.
+     */
+    virtual bool return_loan(
+            T* element) override;
+
+    /**
+     * @brief Override IPool::statistics
+     *
+     * \c in_use and \c free are computed from the counters of every thread, so they could be slightly
+     * out of date while other threads loan or return elements. \c high_water_mark is not tracked.
+     */
+    virtual PoolStatistics statistics() const override;
+
+    //! Total number of elements allocated by the pool.
+    unsigned int reserved() const noexcept;
+
+protected:
+
+    //! Array of free elements.
+    using Magazine = std::vector<T*>;
+
+    struct ThreadCache;
+
+    //! Magazines and elements shared between threads.
+    struct Depot
+    {
+        //! Protect every depot field.
+        std::mutex mutex;
+
+        //! Magazines with \c magazine_size elements.
+        std::vector<Magazine> full_magazines;
+
+        //! Empty magazines, kept to avoid allocating new ones.
+        std::vector<Magazine> empty_magazines;
+
+        //! Every element allocated by the pool, to destroy them with the pool.
+        std::vector<T*> elements;
+
+        //! Caches of the threads alive that use the pool, to add their counters.
+        std::vector<const ThreadCache*> caches;
+
+        //! Loans counted by threads already finished.
+        uint64_t finished_loans = 0;
+
+        //! Returns counted by threads already finished.
+        uint64_t finished_returns = 0;
+    };
+
+    //! Magazines of one thread for this pool.
+    struct ThreadCache
+    {
+        //! Return the magazines to the depot if the pool still exists.
+        ~ThreadCache();
+
+        //! Depot where to return the magazines. Expired when the pool is destroyed.
+        std::weak_ptr<Depot> depot;
+
+        //! Magazine where elements are taken from and returned to.
+        Magazine loaded;
+
+        //! Second magazine, always empty or full.
+        Magazine previous;
+
+        //! Loans done by this thread. Only written by this thread.
+        std::atomic<uint64_t> loans {0};
+
+        //! Returns done by this thread. Only written by this thread.
+        std::atomic<uint64_t> returns {0};
+    };
+
+    //! Get the cache of the current thread for this pool, creating it if it does not exist.
+    ThreadCache& thread_cache_();
+
+    //! Give \c cache an empty magazine in exchange of a full one, or allocate new elements.
+    void refill_(
+            ThreadCache& cache);
+
+    //! Give \c cache an empty magazine in exchange of its full loaded one.
+    void drain_(
+            ThreadCache& cache);
+
+    //! Get a different identifier for each pool of this type, so thread caches of different pools are not mixed.
+    static uint64_t new_pool_id_() noexcept;
+
+    //! Pool configuration.
+    const PoolConfiguration configuration_;
+
+    //! Maximum number of elements in each magazine.
+    const unsigned int magazine_size_;
+
+    //! Identifier of this pool in thread caches.
+    const uint64_t id_;
+
+    //! Shared depot. Thread caches hold a weak reference to it.
+    std::shared_ptr<Depot> depot_;
+
+    //! Total number of elements allocated.
+    std::atomic<unsigned int> reserved_;
+
+    //! Number of batches allocated, including the initial one.
+    std::atomic<unsigned int> allocations_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/MagazinePool.ipp>
@@ -0,0 +1,206 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Pool.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <cpp_utils/pool/IPool.hpp>
+#include <cpp_utils/pool/SlabStorage.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Factory policy of \c Pool that constructs elements with their default constructor.
+ *
+ * A factory policy must implement:
+ * - \c T* construct(void* memory) : construct an element in \c memory , aligned and big enough for a \c T .
+ * - \c void destroy(T* element) : destroy an element without freeing its memory.
+ */
+template <typename T>
+struct DefaultFactory
+{
+    T* construct(
+            void* memory);
+
+    void destroy(
+            T* element) noexcept;
+};
+
+/**
+ * @brief Factory policy of \c Pool that constructs every element with the same arguments.
+ *
+ * The arguments are copied into the factory, and passed as const references to the constructor of each element.
+ * Use \c make_factory<T>(args...) to deduce their types.
+ */
+template <typename T, typename ... Args>
+class ArgumentsFactory
+{
+public:
+
+    ArgumentsFactory(
+            Args... args);
+
+    T* construct(
+            void* memory);
+
+    void destroy(
+            T* element) noexcept;
+
+protected:
+
+    //! Arguments for the constructor of every element.
+    std::tuple<Args...> arguments_;
+};
+
+//! Create an \c ArgumentsFactory that constructs elements of type \c T with \c args .
+template <typename T, typename ... Args>
+ArgumentsFactory<T, Args...> make_factory(
+        Args... args);
+
+/**
+ * @brief Resetter policy of \c Pool that does nothing.
+ *
+ * A resetter policy must implement \c void operator()(T& element) , called on each element returned to the pool.
+ */
+template <typename T>
+struct NoResetter
+{
+    void operator ()(
+            T& element) const noexcept;
+};
+
+/**
+ * @brief This class implements a generic not-thread-safe reusable Pool customized by policies.
+ *
+ * ATTRIBUTES:
+ * - Reuse freed elements without allocation.
+ * - Not thread safe
+ * - Pool size limited to \c maximum_size , or no limit if it is 0
+ * - No virtual calls
+ *
+ * Unlike \c IPool implementations, elements are constructed, destroyed and reset by the \c Factory and \c Resetter
+ * policies, that are known at compile time and so inlined in \c loan and \c return_loan .
+ * Elements do not need to be default constructible, as the factory could pass arguments to their constructor.
+ *
+ * Elements are allocated in contiguous slabs of \c batch_size elements in a \c SlabStorage , as in \c UnboundedPool ,
+ * from the configuration \c memory_resource if set.
+ * This class does not implement \c IPool ; use \c PoolAdapter where an \c IPool is required.
+ *
+ * @warning This class is not thread safe.
+ *
+ * @tparam T Type of the elements in the pool.
+ * @tparam Factory Policy to construct and destroy elements.
+ * @tparam Resetter Policy to reset elements returned to the pool.
+ */
+template <typename T, typename Factory = DefaultFactory<T>, typename Resetter = NoResetter<T>>
+class Pool
+{
+public:
+
+    //! Type of the elements in the pool.
+    using value_type = T;
+
+    /**
+     * @brief Create a new Pool, allocating \c initial_size elements.
+     *
+     * @param configuration Pool Configuration. Exhaustion and trim options are ignored.
+     * @param factory policy to construct and destroy elements.
+     * @param resetter policy to reset elements returned to the pool.
+     *
+     * @throw InitializationException if the pool configuration is not correct.
+     */
+    Pool(
+            PoolConfiguration configuration,
+            Factory factory = Factory(),
+            Resetter resetter = Resetter());
+
+    /**
+     * @brief Destroy the pool and all its elements.
+     *
+     * Every element is destroyed, even if it has not been returned.
+     */
+    ~Pool();
+
+    // Elements belong to this object
+    Pool(
+            const Pool&) = delete;
+    Pool& operator =(
+            const Pool&) = delete;
+
+    /**
+     * @brief Get a new element from the pool.
+     *
+     * If there are no free elements, it allocates a new batch, without exceeding \c maximum_size .
+     *
+     * @param [out] element reference to the ptr that will be filled with the new element.
+     * @return false if the pool has reached its maximum size and every element is loaned.
+     */
+    bool loan(
+            T*& element);
+
+    /**
+     * @brief Reset an element with the \c Resetter and return it to the pool.
+     *
+     * @throw InconsistencyException if there have been more released than reserved calls.
+     */
+    bool return_loan(
+            T* element);
+
+    //! Current occupancy statistics of the pool.
+    PoolStatistics statistics() const noexcept;
+
+protected:
+
+    //! Allocate a slab with \c count new elements, or less if \c maximum_size is reached.
+    bool augment_free_values_(
+            unsigned int count);
+
+    //! Pool configuration.
+    const PoolConfiguration configuration_;
+
+    //! Policy to construct and destroy elements.
+    Factory factory_;
+
+    //! Policy to reset elements returned.
+    Resetter resetter_;
+
+    //! Slabs where elements are constructed, to destroy them and free them with the pool.
+    SlabStorage<T> slabs_;
+
+    //! Elements not loaned, consumed from the back.
+    std::vector<T*> elements_;
+
+    //! Total number of elements reserved by the pool.
+    unsigned int reserved_;
+
+    //! Maximum number of elements loaned at the same time.
+    unsigned int high_water_mark_;
+
+    //! Loans that returned false.
+    unsigned int failed_loans_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/Pool.ipp>
@@ -0,0 +1,79 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolAdapter.hpp
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief \c IPool implementation that forwards to a pool without virtual methods, as \c Pool .
+ *
+ * It allows to use a policy-based pool where an \c IPool is required (e.g. \c PoolPtr ),
+ * paying the virtual call only in the adapter.
+ *
+ * @tparam PoolType type of the pool adapted. It must define \c value_type and implement
+ * \c loan , \c return_loan and \c statistics as \c Pool does.
+ */
+template <typename PoolType>
+class PoolAdapter : public IPool<typename PoolType::value_type>
+{
+public:
+
+    using T = typename PoolType::value_type;
+
+    /**
+     * @brief Create the pool adapted with \c args .
+     *
+     * It only takes part in overload resolution if \c PoolType could be constructed with \c args ,
+     * so it is never used to copy or move an adapter.
+     */
+    template <typename ... Args,
+            typename = typename std::enable_if<std::is_constructible<PoolType, Args&&...>::value>::type>
+    explicit PoolAdapter(
+            Args&&... args);
+
+    //! Override IPool::loan
+    virtual bool loan(
+            T*& element) override;
+
+    //! Override IPool::return_loan
+    virtual bool return_loan(
+            T* element) override;
+
+    //! Override IPool::statistics
+    virtual PoolStatistics statistics() const override;
+
+    //! Pool adapted, to use it directly without virtual calls.
+    PoolType& pool() noexcept;
+
+protected:
+
+    //! Pool adapted.
+    PoolType pool_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/PoolAdapter.ipp>
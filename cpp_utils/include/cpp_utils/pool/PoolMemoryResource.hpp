@@ -0,0 +1,137 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolMemoryResource.hpp
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Block of raw memory of \c Size bytes, used as element of the pools of a \c PoolMemoryResource .
+ *
+ * @tparam Size size in bytes of the block.
+ */
+template <std::size_t Size>
+struct alignas(alignof(std::max_align_t)) MemoryBlock
+{
+    unsigned char data[Size];
+};
+
+/**
+ * @brief \c std::pmr::memory_resource that serves allocations from pools of fixed size blocks.
+ *
+ * Each allocation is rounded up to the smallest size class that fits it (16, 32, ... 4096 bytes),
+ * and the block is loaned from the \c MagazinePool of that size class.
+ * Deallocated blocks return to their pool, so repeated allocations of similar sizes
+ * (as strings and vectors of a message) do not reach the global allocator.
+ *
+ * Allocations bigger than the largest size class, or with an alignment bigger than \c std::max_align_t ,
+ * are forwarded to the upstream resource.
+ *
+ * This class is thread safe, and memory could be deallocated from a thread different than the one that allocated it.
+ *
+ * @warning The resource must outlive every container using it.
+ */
+class PoolMemoryResource : public std::pmr::memory_resource
+{
+public:
+
+    //! Number of size classes.
+    static constexpr std::size_t SIZE_CLASSES = 9;
+
+    //! Size in bytes of the smallest size class.
+    static constexpr std::size_t MIN_BLOCK_SIZE = 16;
+
+    //! Size in bytes of the largest size class.
+    static constexpr std::size_t MAX_BLOCK_SIZE = MIN_BLOCK_SIZE << (SIZE_CLASSES - 1);
+
+    /**
+     * @brief Create a new PoolMemoryResource.
+     *
+     * @param configuration configuration of the pool of each size class. \c maximum_size is ignored.
+     * @param upstream resource for allocations that do not fit in any size class.
+     *
+     * @throw InitializationException if the pool configuration is not correct.
+     */
+    CPP_UTILS_DllAPI PoolMemoryResource(
+            PoolConfiguration configuration = PoolConfiguration(0, 0, 16),
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    /**
+     * @brief Destroy the resource and every block allocated by its pools.
+     *
+     * @warning No memory allocated from this resource must be in use.
+     */
+    CPP_UTILS_DllAPI ~PoolMemoryResource();
+
+    // Blocks belong to this object pools
+    PoolMemoryResource(
+            const PoolMemoryResource&) = delete;
+    PoolMemoryResource& operator =(
+            const PoolMemoryResource&) = delete;
+
+    //! Resource used for allocations that do not fit in any size class.
+    CPP_UTILS_DllAPI std::pmr::memory_resource* upstream_resource() const noexcept;
+
+    //! Size of the block that an allocation of \c bytes would use, or 0 if it is forwarded to upstream.
+    CPP_UTILS_DllAPI static std::size_t block_size(
+            std::size_t bytes,
+            std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    //! Type-erased pool of one size class, implemented in the source file.
+    class ISizeClass;
+
+protected:
+
+    //! Override \c std::pmr::memory_resource::do_allocate
+    CPP_UTILS_DllAPI void* do_allocate(
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_deallocate
+    CPP_UTILS_DllAPI void do_deallocate(
+            void* p,
+            std::size_t bytes,
+            std::size_t alignment) override;
+
+    //! Override \c std::pmr::memory_resource::do_is_equal
+    CPP_UTILS_DllAPI bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override;
+
+    //! Index of the size class for an allocation, or \c SIZE_CLASSES if it is forwarded to upstream.
+    static std::size_t size_class_index_(
+            std::size_t bytes,
+            std::size_t alignment) noexcept;
+
+    //! Pools of each size class, from the smallest to the biggest.
+    std::array<std::unique_ptr<ISizeClass>, SIZE_CLASSES> size_classes_;
+
+    //! Resource for allocations that do not fit in any size class.
+    std::pmr::memory_resource* upstream_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
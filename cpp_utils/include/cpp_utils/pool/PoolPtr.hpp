@@ -0,0 +1,122 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolPtr.hpp
+ */
+
+#pragma once
+
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Move-only handle of an element loaned from an \c IPool , that returns it to the pool when destroyed.
+ *
+ * It works as a \c std::unique_ptr whose deleter is \c return_loan , without any allocation.
+ *
+ * @warning The pool must outlive every \c PoolPtr of its elements.
+ *
+ * @tparam T Type of the elements in the pool.
+ */
+template <typename T>
+class PoolPtr
+{
+public:
+
+    //! Create an empty handle.
+    PoolPtr() noexcept = default;
+
+    /**
+     * @brief Take charge of an element already loaned.
+     *
+     * @param pool pool the element has been loaned from.
+     * @param element element loaned, that will be returned to \c pool .
+     */
+    PoolPtr(
+            IPool<T>* pool,
+            T* element) noexcept;
+
+    //! Return the element to its pool, if any.
+    ~PoolPtr();
+
+    //! Take the element of \c other , leaving it empty.
+    PoolPtr(
+            PoolPtr&& other) noexcept;
+
+    //! Return the current element and take the element of \c other , leaving it empty.
+    PoolPtr& operator =(
+            PoolPtr&& other) noexcept;
+
+    // Only one handle could return the element
+    PoolPtr(
+            const PoolPtr&) = delete;
+    PoolPtr& operator =(
+            const PoolPtr&) = delete;
+
+    /////
+    // Access methods
+
+    //! Element loaned, or nullptr if empty.
+    T* get() const noexcept;
+
+    T& operator *() const noexcept;
+
+    T* operator ->() const noexcept;
+
+    //! Whether it holds an element.
+    explicit operator bool() const noexcept;
+
+    /////
+    // Interaction methods
+
+    /**
+     * @brief Return the element to its pool now, leaving the handle empty.
+     *
+     * An exception from \c return_loan is logged and not propagated, as this is called from the destructor.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Leave the handle empty without returning the element.
+     *
+     * @return element loaned, that must be returned to the pool by the caller.
+     */
+    T* release() noexcept;
+
+protected:
+
+    //! Pool to return the element to.
+    IPool<T>* pool_ = nullptr;
+
+    //! Element loaned.
+    T* element_ = nullptr;
+};
+
+/**
+ * @brief Loan an element from \c pool in a \c PoolPtr .
+ *
+ * @return handle of the new element, or empty handle if the pool could not loan it.
+ */
+template <typename T>
+PoolPtr<T> loan_ptr(
+        IPool<T>& pool);
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/PoolPtr.ipp>
@@ -0,0 +1,149 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedPoolPtr.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Element of a pool that could be shared by several \c SharedPoolPtr .
+ *
+ * The reference count and the pool it belongs to are stored along with the value, so sharing an element
+ * does not require any allocation (as a \c std::shared_ptr control block would).
+ * Pools of \c PoolSlot<T> are used to loan shared elements of type \c T .
+ *
+ * @tparam T Type of the value.
+ */
+template <typename T>
+struct PoolSlot
+{
+    //! Value shared.
+    T value;
+
+    //! Number of \c SharedPoolPtr referencing this slot.
+    std::atomic<uint32_t> references {0};
+
+    //! Pool to return the slot to when the last reference is released.
+    IPool<PoolSlot<T>>* pool {nullptr};
+};
+
+/**
+ * @brief Shared handle of an element loaned from a pool, that returns it to the pool when the last handle is destroyed.
+ *
+ * It works as a \c std::shared_ptr with an intrusive reference count stored in the pooled \c PoolSlot .
+ * The handle is one pointer wide, and copying it only increments an atomic counter.
+ *
+ * The reference count is thread safe, so handles could be copied and destroyed from different threads
+ * (the pool must be thread safe as well in that case, as the element could be returned from any of them).
+ *
+ * @warning The pool must outlive every \c SharedPoolPtr of its elements.
+ *
+ * @tparam T Type of the value shared.
+ */
+template <typename T>
+class SharedPoolPtr
+{
+public:
+
+    //! Create an empty handle.
+    SharedPoolPtr() noexcept = default;
+
+    /**
+     * @brief Take charge of a slot already loaned, with no references.
+     *
+     * @param pool pool the slot has been loaned from.
+     * @param slot slot loaned, that will be returned to \c pool with the last reference.
+     */
+    SharedPoolPtr(
+            IPool<PoolSlot<T>>* pool,
+            PoolSlot<T>* slot) noexcept;
+
+    //! Release this reference, returning the slot to its pool if it is the last one.
+    ~SharedPoolPtr();
+
+    //! Add a new reference to the slot of \c other .
+    SharedPoolPtr(
+            const SharedPoolPtr& other) noexcept;
+
+    //! Take the reference of \c other , leaving it empty.
+    SharedPoolPtr(
+            SharedPoolPtr&& other) noexcept;
+
+    //! Release this reference and add a new reference to the slot of \c other .
+    SharedPoolPtr& operator =(
+            const SharedPoolPtr& other) noexcept;
+
+    //! Release this reference and take the reference of \c other , leaving it empty.
+    SharedPoolPtr& operator =(
+            SharedPoolPtr&& other) noexcept;
+
+    /////
+    // Access methods
+
+    //! Value shared, or nullptr if empty.
+    T* get() const noexcept;
+
+    T& operator *() const noexcept;
+
+    T* operator ->() const noexcept;
+
+    //! Whether it holds a value.
+    explicit operator bool() const noexcept;
+
+    //! Number of handles referencing the value. 0 if empty.
+    uint32_t use_count() const noexcept;
+
+    /////
+    // Interaction methods
+
+    /**
+     * @brief Release this reference, returning the slot to its pool if it is the last one.
+     *
+     * An exception from \c return_loan is logged and not propagated, as this is called from the destructor.
+     */
+    void reset() noexcept;
+
+protected:
+
+    //! Add a reference to \c slot_ , if any.
+    void acquire_() noexcept;
+
+    //! Slot referenced.
+    PoolSlot<T>* slot_ = nullptr;
+};
+
+/**
+ * @brief Loan a slot from \c pool in a \c SharedPoolPtr .
+ *
+ * @return handle of the new value, or empty handle if the pool could not loan it.
+ */
+template <typename T>
+SharedPoolPtr<T> loan_shared_ptr(
+        IPool<PoolSlot<T>>& pool);
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/SharedPoolPtr.ipp>
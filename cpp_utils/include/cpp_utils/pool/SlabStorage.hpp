@@ -0,0 +1,148 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SlabStorage.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Storage of pool elements in contiguous slabs, shared by the pools that allocate elements in batches.
+ *
+ * Each slab is allocated from a memory resource, aligned to a cache line, and holds the elements of one batch.
+ * Elements are constructed and destroyed with the functions given by the pool, so each pool decides how
+ * (e.g. virtual methods in \c UnboundedPool or policies in \c Pool ).
+ *
+ * The pool keeps the free elements: new elements are appended to its vector of free elements, and trimming
+ * removes from it the elements of the slabs freed.
+ *
+ * @warning This class is not thread safe.
+ *
+ * @tparam T Type of the elements stored.
+ */
+template <typename T>
+class SlabStorage
+{
+public:
+
+    //! Alignment of each slab: a cache line, or more if \c T requires it.
+    static constexpr std::size_t SLAB_ALIGNMENT = alignof(T) > 64 ? alignof(T) : 64;
+
+    /**
+     * @brief Create an empty storage.
+     *
+     * @param memory_resource resource to allocate the slabs from. nullptr = global new.
+     */
+    SlabStorage(
+            std::pmr::memory_resource* memory_resource);
+
+    /**
+     * @brief Free the memory of the slabs left.
+     *
+     * Elements are not destroyed: the pool must call \c clear before, with its destroy function.
+     */
+    ~SlabStorage();
+
+    // Slabs belong to this object
+    SlabStorage(
+            const SlabStorage&) = delete;
+    SlabStorage& operator =(
+            const SlabStorage&) = delete;
+
+    /**
+     * @brief Allocate a slab with \c count elements constructed with \c construct .
+     *
+     * Elements are appended to \c free_elements in reverse order, so taking them from the back loans them
+     * in memory order.
+     * If a construction throws, the elements already constructed are destroyed with \c destroy ,
+     * the slab is freed and the exception is rethrown.
+     *
+     * @param construct function that constructs an element in the memory given, as \c T*(void*) .
+     * @param destroy function that destroys an element without freeing its memory, as \c void(T*) .
+     */
+    template <typename Construct, typename Destroy>
+    void allocate(
+            unsigned int count,
+            std::vector<T*>& free_elements,
+            Construct&& construct,
+            Destroy&& destroy);
+
+    /**
+     * @brief Free every slab whose elements are all in \c free_elements , keeping at least \c keep elements.
+     *
+     * Newest slabs are freed first. \c free_elements is sorted with the lowest address at the back,
+     * so they keep being loaned in memory order.
+     *
+     * @return number of elements freed.
+     */
+    template <typename Destroy>
+    unsigned int trim(
+            std::vector<T*>& free_elements,
+            unsigned int keep,
+            Destroy&& destroy);
+
+    //! Destroy every element with \c destroy and free every slab.
+    template <typename Destroy>
+    void clear(
+            Destroy&& destroy);
+
+    //! Number of elements in every slab.
+    unsigned int elements() const noexcept;
+
+    //! Number of slabs allocated.
+    unsigned int slabs() const noexcept;
+
+protected:
+
+    //! Contiguous memory where a batch of elements is constructed.
+    struct Slab
+    {
+        //! First element, aligned.
+        T* elements;
+        //! Number of elements constructed.
+        unsigned int size;
+    };
+
+    //! Allocate the memory of a slab with \c count elements.
+    T* allocate_slab_(
+            unsigned int count);
+
+    //! Free the memory of a slab with \c count elements.
+    void deallocate_slab_(
+            T* elements,
+            unsigned int count) noexcept;
+
+    //! Resource the slabs are allocated from. nullptr = global new.
+    std::pmr::memory_resource* memory_resource_;
+
+    //! Slabs allocated.
+    std::vector<Slab> slabs_;
+
+    //! Number of elements in every slab.
+    unsigned int elements_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/pool/impl/SlabStorage.ipp>
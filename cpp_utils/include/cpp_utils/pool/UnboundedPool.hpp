@@ -18,9 +18,12 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <vector>
 
 #include <cpp_utils/pool/IPool.hpp>
+#include <cpp_utils/pool/SlabStorage.hpp>
 
 namespace eprosima {
 namespace utils {
@@ -37,22 +40,35 @@ namespace utils {
  * Whenever it runs out of free (not loaned) elements, it allocates more following configuration batch.
  * Whenever an element is returned, it turns back to the vector to be reused.
  *
+ * Each batch is allocated as one contiguous slab aligned to a cache line (from the configuration \c memory_resource
+ * if set), where elements are constructed in place with \c construct_element_ .
+ * Slabs are freed when the pool is destroyed, destroying their elements with \c destroy_element_ , or when trimmed.
+ * Children customize their elements overriding \c construct_element_ and \c destroy_element_ :
+ * \c new_element_ and \c delete_element_ are never called, so they are final here.
+ *
+ * If \c trim_idle_time is set in the configuration, the pool frees the slabs whose elements are all free
+ * once the elements in use have stayed below \c trim_threshold of the reserved ones for that time,
+ * keeping at least the elements used in that period and the initial size.
+ * This is checked whenever an element is returned, and in \c trim_if_idle .
+ * A pool that stays idle returns no elements, so its owner must call \c trim_if_idle periodically
+ * (e.g. from a \c PeriodicEventHandler synchronized with the pool users) to free its memory.
+ *
  * @warning This class is not thread safe.
  *
  * @tparam T Type of the elements in the pool.
  */
 template <typename T>
-class UnboundedPool : IPool<T>
+class UnboundedPool : public IPool<T>
 {
 public:
 
     /**
      * @brief Create a new UnboundedPool object by a Pool Configuration given.
      *
-     * It initializes the internal vector with the given initial size, using \c new_element_ .
+     * It initializes the internal vector with the given initial size, using \c construct_element_ .
      *
      * @note Whenever this class is inherited, the constructor must call \c initialize_vector_ ,
-     * as this class cannot because \c new_element_ must be overriden by the child class.
+     * as this class cannot because \c construct_element_ must be overriden by the child class.
      *
      * @param configuration Pool Configuration
      *
@@ -63,6 +79,8 @@ public:
 
     /**
      * @brief Destroy the Limitless Pool object and all its reserved elements.
+     *
+     * Every element is destroyed, even if it has not been returned.
      */
     ~UnboundedPool();
 
@@ -85,8 +103,41 @@ public:
     virtual bool return_loan(
             T* element) override;
 
+    //! Override IPool::statistics
+    virtual PoolStatistics statistics() const override;
+
+    /**
+     * @brief Free every slab whose elements are all free, keeping at least \c keep elements reserved.
+     *
+     * @param keep minimum number of elements to keep reserved.
+     * @return number of elements freed.
+     */
+    unsigned int trim(
+            unsigned int keep = 0);
+
+    /**
+     * @brief Trim the pool if it has been idle for the configured \c trim_idle_time .
+     *
+     * It applies the same check done when an element is returned, so an idle pool could be trimmed
+     * without loaning nor returning elements. It does nothing if \c trim_idle_time is 0.
+     *
+     * @return number of elements freed.
+     */
+    unsigned int trim_if_idle();
+
 protected:
 
+    /**
+     * @brief Not used, as elements are constructed in slabs with \c construct_element_ .
+     *
+     * It is final so a child that overrides it fails to compile, instead of being silently ignored.
+     */
+    T* new_element_() final;
+
+    //! Not used, as elements are destroyed in their slabs with \c destroy_element_ .
+    void delete_element_(
+            T* element) final;
+
     /**
      * @brief Initialize the internal vector with the given initial size in configuration.
      *
@@ -95,17 +146,22 @@ protected:
     virtual void initialize_vector_();
 
     /**
-     * @brief Augment the internal vector with \c batch new elements using \c new_element_ function for each of them.
+     * @brief Augment the internal vector with \c batch new elements, allocated in a new slab.
+     *
+     * Elements are constructed with \c construct_element_ , and they are loaned in memory order.
      */
     void augment_free_values_();
 
     void augment_free_values_(
             unsigned int new_values_count);
 
+    //! Slabs where elements are constructed, to destroy them and free them with the pool.
+    SlabStorage<T> slabs_;
+
     /**
      * @brief vector where elements are stored.
      *
-     * Each element of the vector has been initialized with \c new_element_
+     * Each element of the vector has been initialized with \c construct_element_
      * or returned to the pool after calling \c reset_element_ .
      * The elements are added and consumed at the back.
      */
@@ -120,6 +176,28 @@ protected:
 
     //! Pool configuration.
     const PoolConfiguration configuration_;
+
+    //! Maximum number of elements loaned at the same time.
+    unsigned int high_water_mark_;
+
+    //! Number of slabs allocated.
+    unsigned int allocations_;
+
+    //! Number of elements freed by \c trim .
+    unsigned int trimmed_;
+
+    //! Maximum number of elements loaned at the same time since \c trim_window_start_ .
+    unsigned int trim_window_peak_;
+
+    //! Start of the current period to decide whether the pool is idle.
+    std::chrono::steady_clock::time_point trim_window_start_;
+
+    /**
+     * @brief Trim the pool if it has been idle for the configured time, and start a new period.
+     *
+     * @return number of elements freed.
+     */
+    unsigned int check_trim_();
 };
 
 } /* namespace utils */
@@ -19,6 +19,9 @@
 #ifndef __DDSROUTERUTILS_POOL_IPOOL_IMPL_IPP_
 #define __DDSROUTERUTILS_POOL_IPOOL_IMPL_IPP_
 
+#include <new>
+
+#include <cpp_utils/pool/LimitedPool.hpp>
 #include <cpp_utils/pool/UnboundedPool.hpp>
 
 namespace eprosima {
@@ -27,16 +30,27 @@ namespace utils {
 template <typename T>
 class UnboundedPool;
 
+template <typename T>
+class LimitedPool;
+
 template <typename T>
 IPool<T>* create_pool(
         PoolConfiguration configuration)
 {
     // Create pool depending on the configuration
-    // TODO: change it depending on the configuration
-    // So far only one specialization exists
+    if (configuration.maximum_size > 0)
+    {
+        return new LimitedPool<T>(configuration);
+    }
     return new UnboundedPool<T>(configuration);
 }
 
+template <typename T>
+PoolStatistics IPool<T>::statistics() const
+{
+    return PoolStatistics();
+}
+
 template <typename T>
 T* IPool<T>::new_element_()
 {
@@ -50,6 +64,20 @@ void IPool<T>::delete_element_(
     delete element;
 }
 
+template <typename T>
+T* IPool<T>::construct_element_(
+        void* memory)
+{
+    return new (memory) T();
+}
+
+template <typename T>
+void IPool<T>::destroy_element_(
+        T* element)
+{
+    element->~T();
+}
+
 template <typename T>
 void IPool<T>::reset_element_(
         T* element)
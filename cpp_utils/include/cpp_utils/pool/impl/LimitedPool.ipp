@@ -0,0 +1,225 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LimitedPool.ipp
+ */
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+LimitedPool<T>::LimitedPool(
+        PoolConfiguration configuration)
+    : configuration_(configuration)
+    , available_(0, configuration.maximum_size)
+    , heap_allocations_(0)
+    , heap_elements_in_use_(0)
+    , in_use_(0)
+    , high_water_mark_(0)
+    , failed_loans_(0)
+{
+    if (configuration.maximum_size < 1)
+    {
+        throw utils::InitializationException("Maximum size must be at least 1.");
+    }
+
+    elements_.reserve(configuration_.maximum_size);
+    for (unsigned int i = 0; i < configuration_.maximum_size; ++i)
+    {
+        T* element = this->new_element_();
+        elements_.push_back(element);
+        owned_elements_.insert(element);
+    }
+
+    logDebug(
+        LIMITED_POOL,
+        "Created Pool " << TYPE_NAME(T) << " [" << this << "] with " << configuration_.maximum_size << " elements.");
+}
+
+template <typename T>
+LimitedPool<T>::~LimitedPool()
+{
+    // Awake threads waiting for an element
+    available_.blocking_disable();
+
+    std::lock_guard<std::mutex> lock(elements_mutex_);
+
+    // Check that every element has been released
+    if (elements_.size() != configuration_.maximum_size || heap_elements_in_use_ > 0)
+    {
+        logDevError(LIMITED_POOL, "More Elements reserved than released.");
+    }
+
+    logDebug(LIMITED_POOL, "Destroying Pool [" << this << "] with " << heap_allocations_ << " heap allocations.");
+
+    for (auto& element : elements_)
+    {
+        this->delete_element_(element);
+    }
+}
+
+template <typename T>
+bool LimitedPool<T>::loan(
+        T*& element)
+{
+    if (configuration_.exhaustion_policy == PoolExhaustionPolicy::wait)
+    {
+        // The counter holds the number of free elements, so after it is decreased there is one for this thread
+        if (available_.wait_and_decrement(configuration_.exhaustion_timeout) != event::AwakeReason::condition_met)
+        {
+            logDebug(LIMITED_POOL, "Pool [" << this << "] exhausted, no element returned in time.");
+            failed_loans_++;
+            return false;
+        }
+
+        element = take_free_element_();
+        count_loan_();
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(elements_mutex_);
+        if (!elements_.empty())
+        {
+            element = elements_.back();
+            elements_.pop_back();
+            count_loan_();
+            return true;
+        }
+    }
+
+    if (configuration_.exhaustion_policy == PoolExhaustionPolicy::heap_fallback)
+    {
+        element = this->new_element_();
+        heap_allocations_++;
+        heap_elements_in_use_++;
+        logDebug(LIMITED_POOL, "Pool [" << this << "] exhausted, element allocated in heap.");
+        count_loan_();
+        return true;
+    }
+
+    logDebug(LIMITED_POOL, "Pool [" << this << "] exhausted.");
+    failed_loans_++;
+    return false;
+}
+
+template <typename T>
+bool LimitedPool<T>::return_loan(
+        T* element)
+{
+    if (owned_elements_.find(element) == owned_elements_.end())
+    {
+        // Only heap fallback elements do not belong to the pool
+        if (heap_elements_in_use_ == 0)
+        {
+            throw InconsistencyException("return_loan: element does not belong to this pool.");
+        }
+
+        this->delete_element_(element);
+        heap_elements_in_use_--;
+        in_use_--;
+        return true;
+    }
+
+    this->reset_element_(element);
+
+    {
+        std::lock_guard<std::mutex> lock(elements_mutex_);
+
+        // This only could happen if more elements are released than reserved.
+        if (elements_.size() == configuration_.maximum_size)
+        {
+            throw InconsistencyException("return_loan: More elements are released than reserved.");
+        }
+
+        elements_.push_back(element);
+    }
+
+    in_use_--;
+
+    if (configuration_.exhaustion_policy == PoolExhaustionPolicy::wait)
+    {
+        ++available_;
+    }
+
+    return true;
+}
+
+template <typename T>
+PoolStatistics LimitedPool<T>::statistics() const
+{
+    PoolStatistics statistics;
+    statistics.in_use = in_use_.load();
+    statistics.free = free_elements();
+    statistics.high_water_mark = high_water_mark_.load();
+    statistics.allocations = configuration_.maximum_size + heap_allocations_.load();
+    statistics.failed_loans = failed_loans_.load();
+    return statistics;
+}
+
+template <typename T>
+unsigned int LimitedPool<T>::free_elements() const noexcept
+{
+    std::lock_guard<std::mutex> lock(elements_mutex_);
+    return static_cast<unsigned int>(elements_.size());
+}
+
+template <typename T>
+unsigned int LimitedPool<T>::heap_allocations() const noexcept
+{
+    return heap_allocations_.load();
+}
+
+template <typename T>
+unsigned int LimitedPool<T>::heap_elements_in_use() const noexcept
+{
+    return heap_elements_in_use_.load();
+}
+
+template <typename T>
+T* LimitedPool<T>::take_free_element_()
+{
+    std::lock_guard<std::mutex> lock(elements_mutex_);
+
+    if (elements_.empty())
+    {
+        throw InconsistencyException("LimitedPool without free elements after waiting for them.");
+    }
+
+    T* element = elements_.back();
+    elements_.pop_back();
+    return element;
+}
+
+template <typename T>
+void LimitedPool<T>::count_loan_() noexcept
+{
+    unsigned int in_use = ++in_use_;
+    unsigned int high_water_mark = high_water_mark_.load();
+    while (in_use > high_water_mark && !high_water_mark_.compare_exchange_weak(high_water_mark, in_use))
+    {
+        // high_water_mark is updated with the current value on failure
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,338 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MagazinePool.ipp
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+MagazinePool<T>::MagazinePool(
+        PoolConfiguration configuration,
+        unsigned int magazine_size /* = 64 */)
+    : configuration_(configuration)
+    , magazine_size_(magazine_size)
+    , id_(new_pool_id_())
+    , depot_(std::make_shared<Depot>())
+    , reserved_(0)
+    , allocations_(0)
+{
+    if (configuration.batch_size < 1)
+    {
+        throw utils::InitializationException("Batch size must be at least 1.");
+    }
+    if (magazine_size < 1)
+    {
+        throw utils::InitializationException("Magazine size must be at least 1.");
+    }
+
+    // Preallocate initial elements in full magazines
+    Magazine magazine;
+    for (unsigned int i = 0; i < configuration_.initial_size; ++i)
+    {
+        T* element = this->new_element_();
+        depot_->elements.push_back(element);
+        magazine.push_back(element);
+        if (magazine.size() == magazine_size_)
+        {
+            depot_->full_magazines.push_back(std::move(magazine));
+            magazine = Magazine();
+        }
+    }
+    if (!magazine.empty())
+    {
+        depot_->full_magazines.push_back(std::move(magazine));
+    }
+    reserved_ = configuration_.initial_size;
+    if (configuration_.initial_size > 0)
+    {
+        allocations_ = 1;
+    }
+
+    logDebug(MAGAZINE_POOL, "Created Pool " << TYPE_NAME(T) << " [" << this << "] with " << reserved_ << " elements.");
+}
+
+template <typename T>
+MagazinePool<T>::~MagazinePool()
+{
+    logDebug(MAGAZINE_POOL, "Destroying Pool [" << this << "] with " << reserved_ << " elements.");
+
+    std::lock_guard<std::mutex> lock(depot_->mutex);
+
+    // Thread caches still holding elements of this pool will discard them, as the depot expires
+    for (auto& element : depot_->elements)
+    {
+        this->delete_element_(element);
+    }
+    depot_->elements.clear();
+    depot_->full_magazines.clear();
+}
+
+template <typename T>
+bool MagazinePool<T>::loan(
+        T*& element)
+{
+    ThreadCache& cache = thread_cache_();
+
+    if (cache.loaded.empty())
+    {
+        if (!cache.previous.empty())
+        {
+            // Previous magazine is full
+            std::swap(cache.loaded, cache.previous);
+        }
+        else
+        {
+            refill_(cache);
+        }
+    }
+
+    element = cache.loaded.back();
+    cache.loaded.pop_back();
+
+    // Only this thread writes it, so it does not need an atomic increment
+    cache.loans.store(cache.loans.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+template <typename T>
+bool MagazinePool<T>::return_loan(
+        T* element)
+{
+    this->reset_element_(element);
+
+    ThreadCache& cache = thread_cache_();
+
+    if (cache.loaded.size() >= magazine_size_)
+    {
+        if (cache.previous.empty())
+        {
+            std::swap(cache.loaded, cache.previous);
+        }
+        else
+        {
+            // Both magazines are full
+            drain_(cache);
+        }
+    }
+
+    cache.loaded.push_back(element);
+
+    cache.returns.store(cache.returns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+template <typename T>
+PoolStatistics MagazinePool<T>::statistics() const
+{
+    uint64_t loans;
+    uint64_t returns;
+    {
+        std::lock_guard<std::mutex> lock(depot_->mutex);
+
+        loans = depot_->finished_loans;
+        returns = depot_->finished_returns;
+        for (const ThreadCache* cache : depot_->caches)
+        {
+            loans += cache->loans.load(std::memory_order_relaxed);
+            returns += cache->returns.load(std::memory_order_relaxed);
+        }
+    }
+
+    PoolStatistics statistics;
+    statistics.allocations = allocations_.load();
+
+    // Counters of different threads are read at different times, so keep them consistent
+    unsigned int reserved = reserved_.load();
+    uint64_t in_use = loans > returns ? loans - returns : 0;
+    statistics.in_use = static_cast<unsigned int>(std::min<uint64_t>(in_use, reserved));
+    statistics.free = reserved - statistics.in_use;
+    return statistics;
+}
+
+template <typename T>
+unsigned int MagazinePool<T>::reserved() const noexcept
+{
+    return reserved_.load();
+}
+
+template <typename T>
+MagazinePool<T>::ThreadCache::~ThreadCache()
+{
+    auto alive_depot = depot.lock();
+    if (!alive_depot)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(alive_depot->mutex);
+
+    alive_depot->finished_loans += loans.load(std::memory_order_relaxed);
+    alive_depot->finished_returns += returns.load(std::memory_order_relaxed);
+    alive_depot->caches.erase(std::remove(alive_depot->caches.begin(), alive_depot->caches.end(), this),
+            alive_depot->caches.end());
+
+    for (Magazine* magazine : {&loaded, &previous})
+    {
+        if (!magazine->empty())
+        {
+            alive_depot->full_magazines.push_back(std::move(*magazine));
+        }
+    }
+}
+
+template <typename T>
+typename MagazinePool<T>::ThreadCache& MagazinePool<T>::thread_cache_()
+{
+    // Caches of the current thread for every pool of this type
+    struct ThreadCaches
+    {
+        uint64_t last_id = 0;
+        ThreadCache* last = nullptr;
+        std::unordered_map<uint64_t, std::unique_ptr<ThreadCache>> caches;
+    };
+    static thread_local ThreadCaches thread_caches;
+
+    // Fast path: same pool as last call in this thread
+    if (thread_caches.last_id == id_)
+    {
+        return *thread_caches.last;
+    }
+
+    auto it = thread_caches.caches.find(id_);
+    if (it == thread_caches.caches.end())
+    {
+        // Forget caches of pools already destroyed
+        for (auto cache_it = thread_caches.caches.begin(); cache_it != thread_caches.caches.end();)
+        {
+            if (cache_it->second->depot.expired())
+            {
+                cache_it = thread_caches.caches.erase(cache_it);
+            }
+            else
+            {
+                ++cache_it;
+            }
+        }
+
+        std::unique_ptr<ThreadCache> cache(new ThreadCache());
+        cache->depot = depot_;
+        cache->loaded.reserve(magazine_size_);
+        cache->previous.reserve(magazine_size_);
+        it = thread_caches.caches.emplace(id_, std::move(cache)).first;
+
+        std::lock_guard<std::mutex> lock(depot_->mutex);
+        depot_->caches.push_back(it->second.get());
+    }
+
+    thread_caches.last_id = id_;
+    thread_caches.last = it->second.get();
+    return *thread_caches.last;
+}
+
+template <typename T>
+void MagazinePool<T>::refill_(
+        ThreadCache& cache)
+{
+    {
+        std::lock_guard<std::mutex> lock(depot_->mutex);
+
+        if (!depot_->full_magazines.empty())
+        {
+            depot_->empty_magazines.push_back(std::move(cache.loaded));
+            cache.loaded = std::move(depot_->full_magazines.back());
+            depot_->full_magazines.pop_back();
+            return;
+        }
+    }
+
+    // No free elements in the whole pool, allocate a new batch out of the mutex
+    Magazine new_elements;
+    new_elements.reserve(configuration_.batch_size);
+    for (unsigned int i = 0; i < configuration_.batch_size; ++i)
+    {
+        new_elements.push_back(this->new_element_());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(depot_->mutex);
+
+        depot_->elements.insert(depot_->elements.end(), new_elements.begin(), new_elements.end());
+
+        // Fill the loaded magazine and leave the rest in the depot
+        while (!new_elements.empty() && cache.loaded.size() < magazine_size_)
+        {
+            cache.loaded.push_back(new_elements.back());
+            new_elements.pop_back();
+        }
+        while (!new_elements.empty())
+        {
+            Magazine magazine;
+            std::size_t magazine_elements = std::min<std::size_t>(magazine_size_, new_elements.size());
+            magazine.assign(new_elements.end() - magazine_elements, new_elements.end());
+            new_elements.resize(new_elements.size() - magazine_elements);
+            depot_->full_magazines.push_back(std::move(magazine));
+        }
+    }
+
+    reserved_ += configuration_.batch_size;
+    allocations_++;
+    logDebug(
+        MAGAZINE_POOL,
+        "Pool " << TYPE_NAME(T) << " [" << this << "] augmented in "
+                << configuration_.batch_size << " to " << reserved_ << " elements.");
+}
+
+template <typename T>
+void MagazinePool<T>::drain_(
+        ThreadCache& cache)
+{
+    std::lock_guard<std::mutex> lock(depot_->mutex);
+
+    depot_->full_magazines.push_back(std::move(cache.loaded));
+
+    if (!depot_->empty_magazines.empty())
+    {
+        cache.loaded = std::move(depot_->empty_magazines.back());
+        depot_->empty_magazines.pop_back();
+    }
+    else
+    {
+        cache.loaded = Magazine();
+        cache.loaded.reserve(magazine_size_);
+    }
+}
+
+template <typename T>
+uint64_t MagazinePool<T>::new_pool_id_() noexcept
+{
+    // 0 is never used, so it is never found in the thread fast path
+    static std::atomic<uint64_t> next_id(1);
+    return next_id++;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,212 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Pool.ipp
+ */
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+/////
+// Policies
+
+template <typename T>
+T* DefaultFactory<T>::construct(
+        void* memory)
+{
+    return new (memory) T();
+}
+
+template <typename T>
+void DefaultFactory<T>::destroy(
+        T* element) noexcept
+{
+    element->~T();
+}
+
+template <typename T, typename ... Args>
+ArgumentsFactory<T, Args...>::ArgumentsFactory(
+        Args... args)
+    : arguments_(std::move(args)...)
+{
+}
+
+template <typename T, typename ... Args>
+T* ArgumentsFactory<T, Args...>::construct(
+        void* memory)
+{
+    return std::apply(
+        [memory](const Args&... args)
+        {
+            return new (memory) T(args...);
+        },
+        arguments_);
+}
+
+template <typename T, typename ... Args>
+void ArgumentsFactory<T, Args...>::destroy(
+        T* element) noexcept
+{
+    element->~T();
+}
+
+template <typename T, typename ... Args>
+ArgumentsFactory<T, Args...> make_factory(
+        Args... args)
+{
+    return ArgumentsFactory<T, Args...>(std::move(args)...);
+}
+
+template <typename T>
+void NoResetter<T>::operator ()(
+        T&) const noexcept
+{
+    // Do nothing
+}
+
+/////
+// Pool
+
+template <typename T, typename Factory, typename Resetter>
+Pool<T, Factory, Resetter>::Pool(
+        PoolConfiguration configuration,
+        Factory factory /* = Factory() */,
+        Resetter resetter /* = Resetter() */)
+    : configuration_(configuration)
+    , factory_(std::move(factory))
+    , resetter_(std::move(resetter))
+    , slabs_(configuration.memory_resource)
+    , reserved_(0)
+    , high_water_mark_(0)
+    , failed_loans_(0)
+{
+    if (configuration_.batch_size < 1)
+    {
+        throw utils::InitializationException("Batch size must be at least 1.");
+    }
+
+    if (configuration_.maximum_size > 0 && configuration_.initial_size > configuration_.maximum_size)
+    {
+        throw utils::InitializationException("Initial size must not be greater than maximum size.");
+    }
+
+    augment_free_values_(configuration_.initial_size);
+}
+
+template <typename T, typename Factory, typename Resetter>
+Pool<T, Factory, Resetter>::~Pool()
+{
+    // Check that every element has been released
+    if (elements_.size() != reserved_)
+    {
+        logDevError(POOL, "More Elements reserved than released.");
+    }
+
+    logDebug(POOL, "Destroying Pool " << TYPE_NAME(T) << " [" << this << "] with " << reserved_ << " elements.");
+
+    slabs_.clear([this](T* element)
+            {
+                factory_.destroy(element);
+            });
+}
+
+template <typename T, typename Factory, typename Resetter>
+bool Pool<T, Factory, Resetter>::loan(
+        T*& element)
+{
+    if (elements_.empty() && !augment_free_values_(configuration_.batch_size))
+    {
+        failed_loans_++;
+        return false;
+    }
+
+    element = elements_.back();
+    elements_.pop_back();
+
+    high_water_mark_ = std::max(high_water_mark_, reserved_ - static_cast<unsigned int>(elements_.size()));
+    return true;
+}
+
+template <typename T, typename Factory, typename Resetter>
+bool Pool<T, Factory, Resetter>::return_loan(
+        T* element)
+{
+    // This only could happen if more elements are released than reserved.
+    if (reserved_ == elements_.size())
+    {
+        throw InconsistencyException("return_loan: More elements are released than reserved.");
+    }
+
+    resetter_(*element);
+    elements_.push_back(element);
+    return true;
+}
+
+template <typename T, typename Factory, typename Resetter>
+PoolStatistics Pool<T, Factory, Resetter>::statistics() const noexcept
+{
+    PoolStatistics statistics;
+    statistics.free = static_cast<unsigned int>(elements_.size());
+    statistics.in_use = reserved_ - statistics.free;
+    statistics.high_water_mark = high_water_mark_;
+    statistics.allocations = slabs_.slabs();
+    statistics.failed_loans = failed_loans_;
+    return statistics;
+}
+
+template <typename T, typename Factory, typename Resetter>
+bool Pool<T, Factory, Resetter>::augment_free_values_(
+        unsigned int count)
+{
+    if (configuration_.maximum_size > 0)
+    {
+        count = std::min(count, configuration_.maximum_size - reserved_);
+    }
+
+    if (count == 0)
+    {
+        return false;
+    }
+
+    slabs_.allocate(count, elements_,
+            [this](void* memory)
+            {
+                factory_.construct(memory);
+            },
+            [this](T* element)
+            {
+                factory_.destroy(element);
+            });
+    reserved_ += count;
+
+    logDebug(
+        POOL,
+        "Pool " << TYPE_NAME(T) << " [" << this << "] augmented in " << count << " to " << reserved_ << " elements.");
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
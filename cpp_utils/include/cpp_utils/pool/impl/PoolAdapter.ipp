@@ -0,0 +1,61 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolAdapter.ipp
+ */
+
+#include <utility>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename PoolType>
+template <typename ... Args, typename>
+PoolAdapter<PoolType>::PoolAdapter(
+        Args&&... args)
+    : pool_(std::forward<Args>(args)...)
+{
+}
+
+template <typename PoolType>
+bool PoolAdapter<PoolType>::loan(
+        T*& element)
+{
+    return pool_.loan(element);
+}
+
+template <typename PoolType>
+bool PoolAdapter<PoolType>::return_loan(
+        T* element)
+{
+    return pool_.return_loan(element);
+}
+
+template <typename PoolType>
+PoolStatistics PoolAdapter<PoolType>::statistics() const
+{
+    return pool_.statistics();
+}
+
+template <typename PoolType>
+PoolType& PoolAdapter<PoolType>::pool() noexcept
+{
+    return pool_;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,132 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolPtr.ipp
+ */
+
+#include <utility>
+
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/Log.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+PoolPtr<T>::PoolPtr(
+        IPool<T>* pool,
+        T* element) noexcept
+    : pool_(pool)
+    , element_(element)
+{
+}
+
+template <typename T>
+PoolPtr<T>::~PoolPtr()
+{
+    reset();
+}
+
+template <typename T>
+PoolPtr<T>::PoolPtr(
+        PoolPtr&& other) noexcept
+    : pool_(other.pool_)
+    , element_(other.release())
+{
+}
+
+template <typename T>
+PoolPtr<T>& PoolPtr<T>::operator =(
+        PoolPtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        pool_ = other.pool_;
+        element_ = other.release();
+    }
+    return *this;
+}
+
+template <typename T>
+T* PoolPtr<T>::get() const noexcept
+{
+    return element_;
+}
+
+template <typename T>
+T& PoolPtr<T>::operator *() const noexcept
+{
+    return *element_;
+}
+
+template <typename T>
+T* PoolPtr<T>::operator ->() const noexcept
+{
+    return element_;
+}
+
+template <typename T>
+PoolPtr<T>::operator bool() const noexcept
+{
+    return element_ != nullptr;
+}
+
+template <typename T>
+void PoolPtr<T>::reset() noexcept
+{
+    if (element_ == nullptr)
+    {
+        return;
+    }
+
+    try
+    {
+        pool_->return_loan(element_);
+    }
+    catch (const utils::Exception& e)
+    {
+        logDevError(POOL_PTR, "Error returning element to pool: " << e.what());
+    }
+
+    element_ = nullptr;
+    pool_ = nullptr;
+}
+
+template <typename T>
+T* PoolPtr<T>::release() noexcept
+{
+    T* element = element_;
+    element_ = nullptr;
+    pool_ = nullptr;
+    return element;
+}
+
+template <typename T>
+PoolPtr<T> loan_ptr(
+        IPool<T>& pool)
+{
+    T* element;
+    if (!pool.loan(element))
+    {
+        return PoolPtr<T>();
+    }
+    return PoolPtr<T>(&pool, element);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
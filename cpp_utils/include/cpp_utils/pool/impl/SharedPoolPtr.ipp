@@ -0,0 +1,164 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedPoolPtr.ipp
+ */
+
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/Log.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+SharedPoolPtr<T>::SharedPoolPtr(
+        IPool<PoolSlot<T>>* pool,
+        PoolSlot<T>* slot) noexcept
+    : slot_(slot)
+{
+    if (slot_ != nullptr)
+    {
+        slot_->pool = pool;
+        slot_->references.store(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+SharedPoolPtr<T>::~SharedPoolPtr()
+{
+    reset();
+}
+
+template <typename T>
+SharedPoolPtr<T>::SharedPoolPtr(
+        const SharedPoolPtr& other) noexcept
+    : slot_(other.slot_)
+{
+    acquire_();
+}
+
+template <typename T>
+SharedPoolPtr<T>::SharedPoolPtr(
+        SharedPoolPtr&& other) noexcept
+    : slot_(other.slot_)
+{
+    other.slot_ = nullptr;
+}
+
+template <typename T>
+SharedPoolPtr<T>& SharedPoolPtr<T>::operator =(
+        const SharedPoolPtr& other) noexcept
+{
+    if (slot_ != other.slot_)
+    {
+        reset();
+        slot_ = other.slot_;
+        acquire_();
+    }
+    return *this;
+}
+
+template <typename T>
+SharedPoolPtr<T>& SharedPoolPtr<T>::operator =(
+        SharedPoolPtr&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        slot_ = other.slot_;
+        other.slot_ = nullptr;
+    }
+    return *this;
+}
+
+template <typename T>
+T* SharedPoolPtr<T>::get() const noexcept
+{
+    return slot_ == nullptr ? nullptr : &slot_->value;
+}
+
+template <typename T>
+T& SharedPoolPtr<T>::operator *() const noexcept
+{
+    return slot_->value;
+}
+
+template <typename T>
+T* SharedPoolPtr<T>::operator ->() const noexcept
+{
+    return &slot_->value;
+}
+
+template <typename T>
+SharedPoolPtr<T>::operator bool() const noexcept
+{
+    return slot_ != nullptr;
+}
+
+template <typename T>
+uint32_t SharedPoolPtr<T>::use_count() const noexcept
+{
+    return slot_ == nullptr ? 0 : slot_->references.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void SharedPoolPtr<T>::reset() noexcept
+{
+    if (slot_ == nullptr)
+    {
+        return;
+    }
+
+    // Same ordering as shared_ptr: the last one must see every write done through other references
+    if (slot_->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        try
+        {
+            slot_->pool->return_loan(slot_);
+        }
+        catch (const utils::Exception& e)
+        {
+            logDevError(SHARED_POOL_PTR, "Error returning element to pool: " << e.what());
+        }
+    }
+
+    slot_ = nullptr;
+}
+
+template <typename T>
+void SharedPoolPtr<T>::acquire_() noexcept
+{
+    if (slot_ != nullptr)
+    {
+        slot_->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+SharedPoolPtr<T> loan_shared_ptr(
+        IPool<PoolSlot<T>>& pool)
+{
+    PoolSlot<T>* slot;
+    if (!pool.loan(slot))
+    {
+        return SharedPoolPtr<T>();
+    }
+    return SharedPoolPtr<T>(&pool, slot);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,205 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SlabStorage.ipp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+
+namespace eprosima {
+namespace utils {
+
+template <typename T>
+constexpr std::size_t SlabStorage<T>::SLAB_ALIGNMENT;
+
+template <typename T>
+SlabStorage<T>::SlabStorage(
+        std::pmr::memory_resource* memory_resource)
+    : memory_resource_(memory_resource)
+    , elements_(0)
+{
+}
+
+template <typename T>
+SlabStorage<T>::~SlabStorage()
+{
+    for (auto& slab : slabs_)
+    {
+        deallocate_slab_(slab.elements, slab.size);
+    }
+}
+
+template <typename T>
+template <typename Construct, typename Destroy>
+void SlabStorage<T>::allocate(
+        unsigned int count,
+        std::vector<T*>& free_elements,
+        Construct&& construct,
+        Destroy&& destroy)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Reserve the free elements before constructing, so nothing could throw once the slab is complete
+    std::size_t required = free_elements.size() + count;
+    if (free_elements.capacity() < required)
+    {
+        free_elements.reserve(std::max(required, 2 * free_elements.capacity()));
+    }
+
+    // Register the slab first, so it could not be lost once its elements are constructed
+    slabs_.push_back(Slab{nullptr, 0});
+    Slab& slab = slabs_.back();
+
+    try
+    {
+        slab.elements = allocate_slab_(count);
+        for (; slab.size < count; ++slab.size)
+        {
+            construct(static_cast<void*>(slab.elements + slab.size));
+        }
+    }
+    catch (...)
+    {
+        // Undo the elements already constructed
+        if (slab.elements != nullptr)
+        {
+            while (slab.size > 0)
+            {
+                destroy(slab.elements + --slab.size);
+            }
+            deallocate_slab_(slab.elements, count);
+        }
+        slabs_.pop_back();
+        throw;
+    }
+
+    elements_ += count;
+
+    // Elements are taken from the back, so push them in reverse to loan them in memory order
+    for (unsigned int i = count; i > 0; --i)
+    {
+        free_elements.push_back(slab.elements + i - 1);
+    }
+}
+
+template <typename T>
+template <typename Destroy>
+unsigned int SlabStorage<T>::trim(
+        std::vector<T*>& free_elements,
+        unsigned int keep,
+        Destroy&& destroy)
+{
+    // Sort free elements by address, with the lowest at the back to keep loaning them in memory order
+    std::sort(free_elements.begin(), free_elements.end(), std::greater<T*>());
+
+    unsigned int freed = 0;
+
+    // Newest slabs first
+    for (std::size_t i = slabs_.size(); i > 0; --i)
+    {
+        Slab& slab = slabs_[i - 1];
+        if (elements_ - slab.size < keep)
+        {
+            continue;
+        }
+
+        // Free elements of this slab are consecutive in the sorted vector
+        T* first = slab.elements;
+        T* last = slab.elements + slab.size - 1;
+        auto from = std::lower_bound(free_elements.begin(), free_elements.end(), last, std::greater<T*>());
+        auto to = std::upper_bound(from, free_elements.end(), first, std::greater<T*>());
+        if (static_cast<unsigned int>(to - from) != slab.size)
+        {
+            // Some element is loaned
+            continue;
+        }
+
+        free_elements.erase(from, to);
+        for (unsigned int j = 0; j < slab.size; ++j)
+        {
+            destroy(slab.elements + j);
+        }
+        deallocate_slab_(slab.elements, slab.size);
+
+        elements_ -= slab.size;
+        freed += slab.size;
+        slabs_.erase(slabs_.begin() + (i - 1));
+    }
+
+    if (freed > 0)
+    {
+        free_elements.shrink_to_fit();
+    }
+
+    return freed;
+}
+
+template <typename T>
+template <typename Destroy>
+void SlabStorage<T>::clear(
+        Destroy&& destroy)
+{
+    for (auto& slab : slabs_)
+    {
+        for (unsigned int i = 0; i < slab.size; ++i)
+        {
+            destroy(slab.elements + i);
+        }
+        deallocate_slab_(slab.elements, slab.size);
+    }
+    slabs_.clear();
+    elements_ = 0;
+}
+
+template <typename T>
+unsigned int SlabStorage<T>::elements() const noexcept
+{
+    return elements_;
+}
+
+template <typename T>
+unsigned int SlabStorage<T>::slabs() const noexcept
+{
+    return static_cast<unsigned int>(slabs_.size());
+}
+
+template <typename T>
+T* SlabStorage<T>::allocate_slab_(
+        unsigned int count)
+{
+    std::pmr::memory_resource* resource =
+            memory_resource_ != nullptr ? memory_resource_ : std::pmr::new_delete_resource();
+    return static_cast<T*>(resource->allocate(count * sizeof(T), SLAB_ALIGNMENT));
+}
+
+template <typename T>
+void SlabStorage<T>::deallocate_slab_(
+        T* elements,
+        unsigned int count) noexcept
+{
+    std::pmr::memory_resource* resource =
+            memory_resource_ != nullptr ? memory_resource_ : std::pmr::new_delete_resource();
+    resource->deallocate(elements, count * sizeof(T), SLAB_ALIGNMENT);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
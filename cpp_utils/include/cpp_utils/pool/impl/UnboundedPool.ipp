@@ -19,6 +19,8 @@
 #ifndef __DDSROUTERUTILS_POOL_UnboundedPool_IMPL_IPP_
 #define __DDSROUTERUTILS_POOL_UnboundedPool_IMPL_IPP_
 
+#include <algorithm>
+
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/utils.hpp>
 #include <cpp_utils/exception/InconsistencyException.hpp>
@@ -30,8 +32,14 @@ namespace utils {
 template <typename T>
 UnboundedPool<T>::UnboundedPool(
         PoolConfiguration configuration)
-    : reserved_(0)
+    : slabs_(configuration.memory_resource)
+    , reserved_(0)
     , configuration_(configuration)
+    , high_water_mark_(0)
+    , allocations_(0)
+    , trimmed_(0)
+    , trim_window_peak_(0)
+    , trim_window_start_(std::chrono::steady_clock::now())
 {
     // Call initialize_vector_ in every child constructor
 
@@ -41,6 +49,12 @@ UnboundedPool<T>::UnboundedPool(
     {
         throw utils::InitializationException("Batch size must be at least 1.");
     }
+
+    // Check trim threshold
+    if (configuration.trim_threshold < 0 || configuration.trim_threshold > 1)
+    {
+        throw utils::InitializationException("Trim threshold must be between 0 and 1.");
+    }
 }
 
 template <typename T>
@@ -52,13 +66,16 @@ UnboundedPool<T>::~UnboundedPool()
         logDevError(LIMITLESS_POOL, "More Elements reserved than released.");
     }
 
-    logDebug(LIMITLESS_POOL, "Destroying Pool [" << this << "] with " << reserved_ << " elements.");
-
-    // Delete the values
-    for (auto& element : elements_)
-    {
-        this->delete_element_(element);
-    }
+    logDebug(
+        LIMITLESS_POOL,
+        "Destroying Pool [" << this << "] with " << reserved_ << " elements, with a maximum of "
+                            << high_water_mark_ << " in use.");
+
+    // Destroy every element and free the slabs
+    slabs_.clear([this](T* element)
+            {
+                this->destroy_element_(element);
+            });
 }
 
 template <typename T>
@@ -77,6 +94,10 @@ bool UnboundedPool<T>::loan(
     element = elements_.back();
     elements_.pop_back();
 
+    unsigned int in_use = reserved_ - static_cast<unsigned int>(elements_.size());
+    high_water_mark_ = std::max(high_water_mark_, in_use);
+    trim_window_peak_ = std::max(trim_window_peak_, in_use);
+
     return true;
 }
 
@@ -96,9 +117,92 @@ bool UnboundedPool<T>::return_loan(
     this->reset_element_(element);
     elements_.push_back(element);
 
+    if (configuration_.trim_idle_time > 0)
+    {
+        check_trim_();
+    }
+
     return true;
 }
 
+template <typename T>
+PoolStatistics UnboundedPool<T>::statistics() const
+{
+    PoolStatistics statistics;
+    statistics.free = static_cast<unsigned int>(elements_.size());
+    statistics.in_use = reserved_ - statistics.free;
+    statistics.high_water_mark = high_water_mark_;
+    statistics.allocations = allocations_;
+    statistics.trimmed = trimmed_;
+    return statistics;
+}
+
+template <typename T>
+unsigned int UnboundedPool<T>::trim(
+        unsigned int keep /* = 0 */)
+{
+    unsigned int freed = slabs_.trim(elements_, keep, [this](T* element)
+                    {
+                        this->destroy_element_(element);
+                    });
+    reserved_ -= freed;
+    trimmed_ += freed;
+    if (freed > 0)
+    {
+        logDebug(
+            LIMITLESS_POOL,
+            "Pool " << TYPE_NAME(T) << " [" << this << "] trimmed in " << freed << " to " << reserved_ << " elements.");
+    }
+
+    return freed;
+}
+
+template <typename T>
+T* UnboundedPool<T>::new_element_()
+{
+    return IPool<T>::new_element_();
+}
+
+template <typename T>
+void UnboundedPool<T>::delete_element_(
+        T* element)
+{
+    IPool<T>::delete_element_(element);
+}
+
+template <typename T>
+unsigned int UnboundedPool<T>::trim_if_idle()
+{
+    if (configuration_.trim_idle_time == 0)
+    {
+        return 0;
+    }
+
+    return check_trim_();
+}
+
+template <typename T>
+unsigned int UnboundedPool<T>::check_trim_()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (now - trim_window_start_ < std::chrono::milliseconds(configuration_.trim_idle_time))
+    {
+        return 0;
+    }
+
+    // Idle if the elements in use during the whole period stayed below the threshold
+    unsigned int freed = 0;
+    if (trim_window_peak_ < configuration_.trim_threshold * reserved_)
+    {
+        freed = trim(std::max(trim_window_peak_, configuration_.initial_size));
+    }
+
+    trim_window_start_ = now;
+    trim_window_peak_ = reserved_ - static_cast<unsigned int>(elements_.size());
+
+    return freed;
+}
+
 template <typename T>
 void UnboundedPool<T>::augment_free_values_()
 {
@@ -109,11 +213,22 @@ template <typename T>
 void UnboundedPool<T>::augment_free_values_(
         unsigned int new_values_count)
 {
-    for (unsigned int i = 0; i < new_values_count; ++i)
+    if (new_values_count == 0)
     {
-        auto new_element = this->new_element_();
-        this->elements_.push_back(new_element);
+        return;
     }
+
+    slabs_.allocate(new_values_count, elements_,
+            [this](void* memory)
+            {
+                this->construct_element_(memory);
+            },
+            [this](T* element)
+            {
+                this->destroy_element_(element);
+            });
+    allocations_++;
+
     reserved_ += new_values_count;
     logDebug(
         LIMITLESS_POOL,
@@ -0,0 +1,200 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmRingBuffer.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/time/time_utils.hpp>
+#include <cpp_utils/wait/WaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Control block at the beginning of the shared memory segment.
+struct ShmRingHeader;
+
+/**
+ * @brief Ring buffer of fixed size records in a shared memory segment, to exchange data between processes.
+ *
+ * The segment is created by the first process that opens it and attached by the rest, that must use the
+ * same record size and capacity (checked against the segment header).
+ * It is meant to be used by one producer process and one consumer process. Inside each process, several
+ * threads could produce or consume, as they are serialized with local mutexes.
+ *
+ * Waiting threads sleep in process-shared futexes, and they are only awaken when there is someone waiting.
+ *
+ * Read and write indices are only published once the record has been completely copied, so if a process
+ * crashes the other one keeps working, and a new process attaching the segment resumes from the last
+ * published indices. A record being consumed when the consumer crashes is delivered again.
+ *
+ * @note Only supported in Linux. In other platforms the constructor throws \c UnsupportedException .
+ */
+class ShmRingBuffer
+{
+public:
+
+    /**
+     * @brief Create or attach a shared memory ring buffer.
+     *
+     * @param name name of the shared memory segment (in \c /dev/shm ).
+     * @param record_size size in bytes of each record.
+     * @param capacity maximum number of records stored.
+     * @param enabled whether the buffer starts enabled in this process.
+     *
+     * @throw \c InitializationException if the segment could not be created or its header does not match.
+     * @throw \c InconsistencyException if the indices stored in the segment are not consistent.
+     * @throw \c UnsupportedException if the platform does not support it.
+     */
+    CPP_UTILS_DllAPI ShmRingBuffer(
+            const std::string& name,
+            uint32_t record_size,
+            uint64_t capacity,
+            bool enabled = true);
+
+    //! Disable the buffer and detach the segment. The segment is not removed.
+    CPP_UTILS_DllAPI ~ShmRingBuffer();
+
+    //! Remove the shared memory segment \c name . Processes already attached keep using it.
+    CPP_UTILS_DllAPI static void remove(
+            const std::string& name) noexcept;
+
+    /////
+    // Enabling methods
+
+    //! Enable the buffer in this process.
+    CPP_UTILS_DllAPI void enable() noexcept;
+
+    //! Disable the buffer in this process, awaking every thread waiting.
+    CPP_UTILS_DllAPI void disable() noexcept;
+
+    //! Disable the buffer in this process and wait until every thread has stopped waiting.
+    CPP_UTILS_DllAPI void blocking_disable() noexcept;
+
+    //! Whether the buffer is enabled in this process.
+    CPP_UTILS_DllAPI bool enabled() const noexcept;
+
+    /////
+    // Get internal values
+
+    //! Size in bytes of each record.
+    CPP_UTILS_DllAPI uint32_t record_size() const noexcept;
+
+    //! Maximum number of records stored.
+    CPP_UTILS_DllAPI uint64_t capacity() const noexcept;
+
+    //! Number of records stored and not consumed yet.
+    CPP_UTILS_DllAPI uint64_t size() const noexcept;
+
+    /////
+    // Data methods
+
+    /**
+     * @brief Copy a record in the buffer, waiting until there is space for it.
+     *
+     * @param record \c record_size bytes to copy.
+     * @param timeout maximum time to wait in milliseconds. If 0, not time limit.
+     *
+     * @return \c condition_met if the record has been written, else the reason why it has not.
+     */
+    CPP_UTILS_DllAPI AwakeReason write(
+            const void* record,
+            const utils::Duration_ms& timeout);
+
+    /**
+     * @brief Copy up to \c max_records records out of the buffer, waiting until there is at least one.
+     *
+     * @param records memory for at least \c max_records records.
+     * @param max_records maximum number of records to read.
+     * @param timeout maximum time to wait in milliseconds. If 0, not time limit.
+     * @param records_read number of records copied in \c records .
+     *
+     * @return \c condition_met if at least one record has been read, else the reason why it has not.
+     */
+    CPP_UTILS_DllAPI AwakeReason read(
+            void* records,
+            uint64_t max_records,
+            const utils::Duration_ms& timeout,
+            uint64_t& records_read);
+
+    /**
+     * @brief Wait until every record has been consumed.
+     *
+     * @param timeout maximum time to wait in milliseconds. If 0, not time limit.
+     */
+    CPP_UTILS_DllAPI AwakeReason wait_empty(
+            const utils::Duration_ms& timeout);
+
+protected:
+
+    /**
+     * @brief Wait in the futex \c sequence until \c ready returns true.
+     *
+     * @param sequence futex word incremented by the other side every time the condition may have changed.
+     * @param waiting number of threads waiting in \c sequence , so the other side knows it must wake them.
+     */
+    template <typename Ready>
+    AwakeReason wait_(
+            std::atomic<uint32_t>& sequence,
+            std::atomic<uint32_t>& waiting,
+            const utils::Timestamp& deadline,
+            Ready ready);
+
+    //! Increment \c sequence and wake the threads waiting in it, if any.
+    static void notify_(
+            std::atomic<uint32_t>& sequence,
+            const std::atomic<uint32_t>& waiting) noexcept;
+
+    //! Address of the record with index \c index .
+    uint8_t* record_(
+            uint64_t index) const noexcept;
+
+    //! Name of the segment.
+    std::string name_;
+
+    //! Header of the segment mapped.
+    ShmRingHeader* header_ {nullptr};
+
+    //! First record of the segment mapped.
+    uint8_t* data_ {nullptr};
+
+    //! Size of the segment mapped.
+    std::size_t mapped_size_ {0};
+
+    //! Whether this process can use the buffer.
+    std::atomic<bool> enabled_;
+
+    //! Threads of this process waiting in a futex.
+    std::atomic<uint32_t> local_waiting_ {0};
+
+    //! Serialize writers of this process.
+    std::timed_mutex write_mutex_;
+
+    //! Serialize readers of this process.
+    std::timed_mutex read_mutex_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
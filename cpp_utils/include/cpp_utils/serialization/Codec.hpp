@@ -0,0 +1,46 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Codec.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Functions to convert values to bytes and back, used to store values in disk
+ * (e.g. by \c PersistentSafeDatabase and \c SpillDBQueueWaitHandler ).
+ *
+ * @tparam T Type of the values to serialize.
+ */
+template <typename T>
+struct Codec
+{
+    //! Serialize \c value appending its bytes at the end of \c buffer .
+    std::function<void(const T& value, std::vector<uint8_t>& buffer)> serialize;
+
+    //! Deserialize a value from \c size bytes starting in \c data .
+    std::function<T(const uint8_t* data, std::size_t size)> deserialize;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
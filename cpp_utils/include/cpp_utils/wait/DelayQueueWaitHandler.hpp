@@ -0,0 +1,167 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DelayQueueWaitHandler.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+#include <cpp_utils/wait/CounterWaitHandler.hpp>
+#include <cpp_utils/wait/WaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * This Wait Handler stores data that could only be consumed once a given time has been reached.
+ *
+ * Each value is produced with a timestamp (\c ready_at ). A consumer waiting in \c consume will only retrieve
+ * a value once its timestamp has been reached, and values are always retrieved in timestamp order
+ * (values with the same timestamp in FIFO order).
+ *
+ * Values are stored in a min-heap by timestamp, so producing and consuming is O(log n) in the number of
+ * pending values.
+ * Consumers do not poll: only one consumer (the leader) sleeps until the earliest timestamp, while the rest wait
+ * until they are notified. The leader is replaced whenever a value with an earlier timestamp is produced.
+ *
+ * \c T specializes this class depending on the data that is stored inside the queue.
+ */
+template <typename T>
+class DelayQueueWaitHandler : protected WaitHandler<CounterType>
+{
+public:
+
+    /**
+     * @brief Construct a new Delay Queue Wait Handler object
+     *
+     * @param enabled whether the object starts enabled or disabled
+     */
+    DelayQueueWaitHandler(
+            bool enabled = true);
+
+    // Make this parent methods public
+    using WaitHandler::enable;
+    using WaitHandler::disable;
+    using WaitHandler::blocking_disable;
+    using WaitHandler::enabled;
+    using WaitHandler::stop_and_continue;
+
+    /////
+    // Get internal values
+
+    //! Get the number of values stored, ready or not to be consumed.
+    CounterType elements_pending() const noexcept;
+
+    //! Get the timestamp of the next value to be ready. \c the_end_of_time if there are no values.
+    utils::Timestamp next_ready_time() const noexcept;
+
+    /////
+    // Add values methods
+
+    /**
+     * @brief Add a new value that will be ready to consume at \c ready_at . Use move constructor.
+     *
+     * This method will awake a consumer only if this value is the next one to be ready.
+     *
+     * @param value new data
+     * @param ready_at time from which this value could be consumed
+     */
+    void produce(
+            T&& value,
+            const utils::Timestamp& ready_at);
+
+    /**
+     * @brief Add a new value that will be ready to consume at \c ready_at . Use copy constructor.
+     *
+     * This method will awake a consumer only if this value is the next one to be ready.
+     *
+     * @param value new data
+     * @param ready_at time from which this value could be consumed
+     */
+    void produce(
+            const T& value,
+            const utils::Timestamp& ready_at);
+
+    /////
+    // Get values methods
+
+    /**
+     * @brief Wait until there is a value ready and retrieve it.
+     *
+     * @param timeout maximum time to wait for a value in milliseconds. If 0, not time limit. [default 0].
+     * @return T next value ready.
+     *
+     * @throw \c DisabledException if the handler is disabled when calling this method or while waiting.
+     * @throw \c TimeoutException if timeout is reached.
+     */
+    T consume(
+            const utils::Duration_ms& timeout = 0);
+
+protected:
+
+    //! Internal element stored in the heap.
+    struct Entry
+    {
+        T value;
+        utils::Timestamp ready_at;
+        uint64_t sequence;
+    };
+
+    //! Push a new entry in the heap and notify if it is the new first (mutex must not be taken).
+    void push_entry_(
+            Entry&& entry);
+
+    //! Remove the first entry from the heap and return its value (mutex must be taken).
+    T pop_entry_nts_();
+
+    /**
+     * @brief Heap ordering between entries (min-heap by timestamp).
+     *
+     * An entry goes before other (is consumed later) if it is ready later, or if they are ready at the same
+     * time and it has been produced later.
+     */
+    static bool entry_later_(
+            const Entry& lhs,
+            const Entry& rhs);
+
+    /**
+     * @brief Heap of values, sorted with \c entry_later_ .
+     *
+     * @warning Must be protected with \c wait_condition_variable_mutex_ . \c value_ holds its size.
+     */
+    std::vector<Entry> heap_;
+
+    //! Sequence number for the next value produced (protected with \c wait_condition_variable_mutex_ ).
+    uint64_t next_sequence_ {0};
+
+    //! Whether a consumer is sleeping until the first timestamp (protected with \c wait_condition_variable_mutex_ ).
+    bool leader_waiting_ {false};
+
+    //! Consumer sleeping until the first timestamp (protected with \c wait_condition_variable_mutex_ ).
+    std::thread::id leader_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/wait/impl/DelayQueueWaitHandler.ipp>
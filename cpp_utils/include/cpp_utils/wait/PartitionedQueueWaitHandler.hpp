@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionedQueueWaitHandler.hpp
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <cpp_utils/wait/DBQueueWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * This Wait Handler distributes data between N independent \c DBQueueWaitHandler (partitions) depending on a key.
+ *
+ * Each value is produced along with a key, and every value with the same key is stored in the same partition.
+ * Each partition is meant to be consumed by one single thread, so values with the same key are consumed in the
+ * same order they were produced, while values with different keys could be consumed in parallel.
+ *
+ * New partitions could be added while the handler is being used (e.g. when a new consumer thread is created).
+ * As adding partitions changes the partition of already used keys, the rebalance waits until every value already
+ * produced has been consumed, blocking new producers meanwhile. This assures that the order per key is kept.
+ *
+ * \c Key type of the key used to select the partition.
+ * \c T specializes this class depending on the data that is stored inside the queues.
+ * \c Hash hash function over \c Key .
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class PartitionedQueueWaitHandler
+{
+public:
+
+    /**
+     * @brief Construct a new Partitioned Queue Wait Handler object
+     *
+     * @param partitions initial number of partitions. Must be at least 1.
+     * @param enabled whether the partitions start enabled.
+     *
+     * @throw InitializationException if \c partitions is 0.
+     */
+    PartitionedQueueWaitHandler(
+            unsigned int partitions,
+            bool enabled = true);
+
+    /////
+    // Enabling methods
+
+    //! Enable every partition.
+    void enable() noexcept;
+
+    //! Disable every partition, awaking every consumer waiting.
+    void disable() noexcept;
+
+    //! Disable every partition and wait until every consumer has stopped waiting.
+    void blocking_disable() noexcept;
+
+    //! Whether the handler is enabled.
+    bool enabled() const noexcept;
+
+    /////
+    // Get internal values
+
+    //! Current number of partitions.
+    unsigned int partitions() const noexcept;
+
+    //! Partition where values with \c key are stored with the current number of partitions.
+    unsigned int partition(
+            const Key& key) const noexcept;
+
+    //! Get the number of values ready for consumption in every partition.
+    CounterType elements_ready_to_consume() const noexcept;
+
+    /**
+     * @brief Get the number of values ready for consumption in one partition.
+     *
+     * @throw PreconditionNotMet if \c partition_index does not exist.
+     */
+    CounterType elements_ready_to_consume(
+            unsigned int partition_index) const;
+
+    /////
+    // Add values methods
+
+    /**
+     * @brief Add a new value to the partition of \c key . Use move constructor.
+     *
+     * It may block while partitions are being rebalanced.
+     */
+    void produce(
+            const Key& key,
+            T&& value);
+
+    /**
+     * @brief Add a new value to the partition of \c key . Use copy constructor.
+     *
+     * It may block while partitions are being rebalanced.
+     */
+    void produce(
+            const Key& key,
+            const T& value);
+
+    /////
+    // Get values methods
+
+    /**
+     * @brief Wait until there is data available in a partition and retrieve the first one.
+     *
+     * @param partition_index index of the partition to consume from. Only one thread should consume from each.
+     * @param timeout maximum time to wait for data in milliseconds. If 0, not time limit. [default 0].
+     * @return T next value available in the partition.
+     *
+     * @throw \c PreconditionNotMet if \c partition_index does not exist.
+     * @throw \c DisabledException if the handler is disabled when calling this method or while waiting.
+     * @throw \c TimeoutException if timeout is reached.
+     */
+    T consume(
+            unsigned int partition_index,
+            const utils::Duration_ms& timeout = 0);
+
+    /////
+    // Synchronization methods
+
+    /**
+     * @brief Wait until all elements in every partition are consumed.
+     *
+     * @param timeout maximum time to wait in milliseconds for all partitions. If 0, not time limit. [default 0].
+     * @return AwakeReason Whether the method returned due to timeout, disable or because all elements were consumed.
+     */
+    AwakeReason wait_all_consumed(
+            const utils::Duration_ms& timeout = 0);
+
+    /////
+    // Rebalance methods
+
+    /**
+     * @brief Add new partitions to the handler.
+     *
+     * Producers are blocked until the rebalance finishes.
+     * The new partitions are only added once every value already produced has been consumed, so the values of a
+     * key that change its partition are never consumed out of order.
+     *
+     * @param new_partitions number of partitions to add.
+     * @param timeout maximum time to wait in milliseconds for every partition to be consumed. If 0, not time limit.
+     * @return new number of partitions.
+     *
+     * @throw \c DisabledException if the handler is disabled while waiting. No partition is added.
+     * @throw \c TimeoutException if timeout is reached. No partition is added.
+     */
+    unsigned int add_partitions(
+            unsigned int new_partitions,
+            const utils::Duration_ms& timeout = 0);
+
+protected:
+
+    //! Get the partition with index \c partition_index (\c partitions_mutex_ must be taken).
+    DBQueueWaitHandler<T>* partition_nts_(
+            unsigned int partition_index) const;
+
+    //! Wait until every partition is consumed (\c partitions_mutex_ must be taken).
+    AwakeReason wait_all_consumed_nts_(
+            const utils::Duration_ms& timeout);
+
+    //! Partitions. They are never removed, so their pointer could be used without mutex once obtained.
+    std::vector<std::unique_ptr<DBQueueWaitHandler<T>>> partitions_;
+
+    //! Hash function to select the partition of a key.
+    Hash hash_;
+
+    //! Whether new partitions must be created enabled.
+    std::atomic<bool> enabled_;
+
+    /**
+     * @brief Guard the partitions vector.
+     *
+     * Consumers take it in shared mode only to get their partition, and release it before waiting for data.
+     * Rebalance takes it in unique mode only to add the new partitions, once every partition has been consumed.
+     */
+    mutable std::shared_timed_mutex partitions_mutex_;
+
+    /**
+     * @brief Block producers while rebalancing.
+     *
+     * Producers take it in shared mode, while rebalance takes it in unique mode during the whole process.
+     * It must be taken before \c partitions_mutex_ .
+     */
+    mutable std::shared_timed_mutex producers_mutex_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/wait/impl/PartitionedQueueWaitHandler.ipp>
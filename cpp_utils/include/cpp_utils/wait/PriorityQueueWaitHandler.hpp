@@ -0,0 +1,119 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PriorityQueueWaitHandler.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/wait/ConsumerWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * This Wait Handler will make threads wait until a data has been added to a priority queue.
+ *
+ * Values are consumed by priority instead of by arrival order, so higher priority data (e.g. control messages)
+ * overtakes lower priority data (e.g. bulk data) already stored in the handler.
+ * Values with the same priority are consumed in the same order they were produced (FIFO).
+ *
+ * \c T specializes this class depending on the data that is stored inside the queue.
+ * \c Compare is a strict weak ordering over \c T with the same meaning as in \c std::priority_queue :
+ * the value that is the greatest regarding \c Compare is the first to be consumed.
+ */
+template <typename T, typename Compare = std::less<T>>
+class PriorityQueueWaitHandler : public ConsumerWaitHandler<T>
+{
+public:
+
+    // Use parent constructor
+    using ConsumerWaitHandler<T>::ConsumerWaitHandler;
+
+    /**
+     * @brief Construct a new Priority Queue Wait Handler with a specific comparator object.
+     *
+     * @param compare comparator to sort the values stored.
+     * @param enabled whether the handler starts enabled.
+     */
+    PriorityQueueWaitHandler(
+            const Compare& compare,
+            bool enabled = true);
+
+protected:
+
+    //! Internal element stored in the heap: the value and the order it was produced.
+    struct Entry
+    {
+        T value;
+        uint64_t sequence;
+    };
+
+    //! Override of \c ConsumerWaitHandler method to move a new value into the priority queue
+    void add_value_(
+            T&& value) override;
+
+    //! Override of \c ConsumerWaitHandler method to copy a new value into the priority queue
+    void add_value_(
+            const T& value) override;
+
+    /**
+     * @brief Override of \c ConsumerWaitHandler method to remove the highest priority value from the queue
+     *
+     * The value is moved out of the queue, so no copy is performed.
+     *
+     * @throw \c InconsistencyException if it is called without data in the queue
+     */
+    T get_next_value_() override;
+
+    //! Push an entry already created into the heap (mutex must be taken)
+    void push_entry_nts_(
+            Entry&& entry);
+
+    /**
+     * @brief Heap ordering between entries.
+     *
+     * An entry goes before other (is consumed later) if its value has less priority, or if they have the same
+     * priority and it has been produced later.
+     */
+    bool entry_less_(
+            const Entry& lhs,
+            const Entry& rhs) const;
+
+    //! Comparator to sort values.
+    Compare compare_;
+
+    //! Heap of values, sorted with \c entry_less_ .
+    std::vector<Entry> heap_;
+
+    //! Sequence number for the next value produced.
+    uint64_t next_sequence_ {0};
+
+    //! Protect the access to the heap from producers and consumers.
+    std::mutex heap_mutex_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/wait/impl/PriorityQueueWaitHandler.ipp>
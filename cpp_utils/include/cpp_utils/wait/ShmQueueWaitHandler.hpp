@@ -0,0 +1,168 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmQueueWaitHandler.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cpp_utils/queue/ShmRingBuffer.hpp>
+#include <cpp_utils/wait/CounterWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * This Wait Handler exchanges data between processes of the same host through a shared memory ring buffer.
+ *
+ * It has the same produce / consume API as \c DBQueueWaitHandler , but producers and consumers could live in
+ * different processes: every process that creates a handler with the same \c name uses the same queue.
+ * It is meant to have one producer process and one consumer process (see \c ShmRingBuffer ).
+ *
+ * As values are copied byte by byte into shared memory, \c T must be trivially copyable and must not hold
+ * pointers. As the queue is bounded, producers wait while it is full.
+ *
+ * \c T specializes this class depending on the data that is stored inside the queue.
+ */
+template <typename T>
+class ShmQueueWaitHandler
+{
+    static_assert(std::is_trivially_copyable<T>::value, "ShmQueueWaitHandler requires trivially copyable values.");
+
+public:
+
+    /**
+     * @brief Create or attach the shared memory queue \c name .
+     *
+     * @param name name of the shared memory segment. Every process must use the same name and capacity.
+     * @param capacity maximum number of values stored.
+     * @param enabled whether the handler starts enabled.
+     *
+     * @throw \c InitializationException if the segment could not be created or it does not match this type.
+     */
+    ShmQueueWaitHandler(
+            const std::string& name,
+            uint64_t capacity,
+            bool enabled = true);
+
+    //! Remove the shared memory segment \c name . Processes already attached keep using it.
+    static void remove(
+            const std::string& name) noexcept;
+
+    /////
+    // Enabling methods
+
+    //! Enable the handler in this process.
+    void enable() noexcept;
+
+    //! Disable the handler in this process, awaking every thread waiting.
+    void disable() noexcept;
+
+    //! Disable the handler in this process and wait until every thread has stopped waiting.
+    void blocking_disable() noexcept;
+
+    //! Whether the handler is enabled in this process.
+    bool enabled() const noexcept;
+
+    /////
+    // Get internal values
+
+    //! Get the number of values ready for consumption.
+    CounterType elements_ready_to_consume() const noexcept;
+
+    //! Maximum number of values stored.
+    uint64_t capacity() const noexcept;
+
+    /////
+    // Add values methods
+
+    /**
+     * @brief Copy a new value to the queue, waiting while it is full.
+     *
+     * @param value new data
+     * @param timeout maximum time to wait for space in milliseconds. If 0, not time limit. [default 0].
+     *
+     * @throw \c DisabledException if the handler is disabled when calling this method or while waiting.
+     * @throw \c TimeoutException if timeout is reached.
+     */
+    void produce(
+            const T& value,
+            const utils::Duration_ms& timeout = 0);
+
+    /////
+    // Get values methods
+
+    /**
+     * @brief Wait until there is data available and retrieve the first one.
+     *
+     * @param timeout maximum time to wait for data in milliseconds. If 0, not time limit. [default 0].
+     * @return T next value available.
+     *
+     * @throw \c DisabledException if the handler is disabled when calling this method or while waiting.
+     * @throw \c TimeoutException if timeout is reached.
+     */
+    T consume(
+            const utils::Duration_ms& timeout = 0);
+
+    /**
+     * @brief Wait until there is data available and retrieve every value available, up to \c max_values .
+     *
+     * Values are copied out of shared memory in one operation, and released to the producer at once.
+     *
+     * @param max_values maximum number of values to retrieve.
+     * @param timeout maximum time to wait for data in milliseconds. If 0, not time limit. [default 0].
+     * @return std::vector<T> values retrieved in FIFO order. At least one.
+     *
+     * @throw \c DisabledException if the handler is disabled when calling this method or while waiting.
+     * @throw \c TimeoutException if timeout is reached.
+     */
+    std::vector<T> consume_batch(
+            std::size_t max_values,
+            const utils::Duration_ms& timeout = 0);
+
+    /////
+    // Synchronization methods
+
+    /**
+     * @brief Wait until all elements in the queue are consumed (by any process).
+     *
+     * @param timeout maximum time to wait in milliseconds. If 0, not time limit. [default 0].
+     * @return AwakeReason Whether the method returned due to timeout, disable or because all elements were consumed.
+     */
+    AwakeReason wait_all_consumed(
+            const utils::Duration_ms& timeout = 0);
+
+protected:
+
+    //! Throw the exception corresponding with a reason different than \c condition_met .
+    static void throw_if_not_met_(
+            AwakeReason reason);
+
+    //! Shared memory where values are stored.
+    ShmRingBuffer buffer_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/wait/impl/ShmQueueWaitHandler.ipp>
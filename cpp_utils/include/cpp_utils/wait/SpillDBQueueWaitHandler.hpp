@@ -0,0 +1,223 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SpillDBQueueWaitHandler.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/serialization/Codec.hpp>
+#include <cpp_utils/wait/DBQueueWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Codec of the values spilled to disk by a \c SpillDBQueueWaitHandler .
+template <typename T>
+using SpillCodec = Codec<T>;
+
+//! Configuration of a \c SpillDBQueueWaitHandler .
+struct SpillConfiguration
+{
+    //! Path of the segment file where values are spilled. It is truncated at creation and removed at destruction.
+    std::string file_path;
+
+    //! Maximum number of values kept in memory. Values produced over this threshold are spilled to disk.
+    unsigned int memory_threshold = 1000;
+
+    //! Number of values written to or read from disk in each I/O operation.
+    unsigned int batch_size = 100;
+};
+
+//! Spill and replay metrics of a \c SpillDBQueueWaitHandler .
+struct SpillStatistics
+{
+    //! Number of values moved out of memory.
+    uint64_t spilled_values = 0;
+    //! Number of bytes of the values moved out of memory (including record headers).
+    uint64_t spilled_bytes = 0;
+    //! Number of write operations in the segment file.
+    uint64_t write_operations = 0;
+    //! Time spent serializing and writing values.
+    std::chrono::nanoseconds spill_time {0};
+
+    //! Number of values moved back to memory.
+    uint64_t replayed_values = 0;
+    //! Number of bytes of the values moved back to memory (including record headers).
+    uint64_t replayed_bytes = 0;
+    //! Number of batches read from the segment file.
+    uint64_t read_operations = 0;
+    //! Time spent reading and deserializing values.
+    std::chrono::nanoseconds replay_time {0};
+
+    //! Spill throughput in bytes per second. 0 if nothing has been spilled.
+    CPP_UTILS_DllAPI double spill_throughput() const noexcept;
+
+    //! Replay throughput in bytes per second. 0 if nothing has been replayed.
+    CPP_UTILS_DllAPI double replay_throughput() const noexcept;
+};
+
+/**
+ * This Wait Handler works as a \c DBQueueWaitHandler that moves its values to disk when too many are stored.
+ *
+ * While the number of values in memory is under \c memory_threshold , it behaves as a \c DBQueueWaitHandler .
+ * Once the threshold is reached, new values are serialized with the codec given and appended to a segment file
+ * (in batches of \c batch_size values).
+ * Once the values in memory are consumed, the values in disk are read back in batches in the same order.
+ * Values are always consumed in the same order they were produced (FIFO), whether they have been spilled or not.
+ *
+ * The segment file is truncated every time all the spilled values have been read back, so it does not grow
+ * beyond the largest backlog.
+ *
+ * \c T specializes this class depending on the data that is stored inside the queue.
+ */
+template <typename T>
+class SpillDBQueueWaitHandler : public DBQueueWaitHandler<T>
+{
+public:
+
+    /**
+     * @brief Construct a new Spill DBQueue Wait Handler object
+     *
+     * @param configuration spill configuration.
+     * @param codec functions to serialize and deserialize values.
+     * @param enabled whether the handler starts enabled.
+     *
+     * @throw ConfigurationException if the configuration is not valid.
+     * @throw InitializationException if the segment file could not be opened.
+     */
+    SpillDBQueueWaitHandler(
+            const SpillConfiguration& configuration,
+            const SpillCodec<T>& codec,
+            bool enabled = true);
+
+    /**
+     * @brief Destroy the object, disabling it first and removing the segment file.
+     *
+     * Values not consumed are lost.
+     */
+    ~SpillDBQueueWaitHandler();
+
+    //! Number of values currently stored in memory.
+    unsigned int elements_in_memory() const noexcept;
+
+    //! Number of values currently stored in disk (or waiting to be written in the current batch).
+    unsigned int elements_spilled() const noexcept;
+
+    //! Spill and replay metrics so far.
+    SpillStatistics statistics() const noexcept;
+
+protected:
+
+    //! Override of \c DBQueueWaitHandler method to move a new value to memory or disk.
+    void add_value_(
+            T&& value) override;
+
+    //! Override of \c DBQueueWaitHandler method to copy a new value to memory or disk.
+    void add_value_(
+            const T& value) override;
+
+    /**
+     * @brief Override of \c DBQueueWaitHandler method to remove the next value.
+     *
+     * If there are no values in memory, the next batch is read back from disk.
+     * If the values in memory drop under half the threshold, the next batch is read back from disk as well.
+     *
+     * @throw \c InconsistencyException if it is called without data
+     */
+    T get_next_value_() override;
+
+    //! Whether a new value must be spilled (\c spill_mutex_ must be taken).
+    bool must_spill_nts_() const noexcept;
+
+    //! Serialize a value in the current write batch, and write it if full (\c spill_mutex_ must be taken).
+    void spill_nts_(
+            const T& value);
+
+    //! Write the current batch to the segment file (\c spill_mutex_ must be taken).
+    void flush_write_batch_nts_();
+
+    /**
+     * @brief Move the next batch of spilled values into memory (\c spill_mutex_ must be taken).
+     *
+     * Values are read from the segment file, or taken directly from the write batch if every value in the file
+     * has already been read.
+     */
+    void replay_batch_nts_();
+
+    //! Truncate the segment file once every value in it has been read back (\c spill_mutex_ must be taken).
+    void reset_segment_nts_();
+
+    //! Spill configuration.
+    const SpillConfiguration configuration_;
+
+    //! Codec to store values in disk.
+    const SpillCodec<T> codec_;
+
+    //! Number of values in memory.
+    std::atomic<unsigned int> in_memory_ {0};
+
+    //! Number of values in disk or in the current write batch.
+    std::atomic<unsigned int> spilled_ {0};
+
+    //! Values written to the segment file that have not been read back yet.
+    unsigned int unread_in_file_ {0};
+
+    //! Bytes written to the segment file since it was last truncated.
+    uint64_t bytes_in_file_ {0};
+
+    //! Number of values serialized in \c write_batch_ .
+    unsigned int values_in_write_batch_ {0};
+
+    //! Serialized values waiting to be written to the segment file.
+    std::vector<uint8_t> write_batch_;
+
+    //! Buffer to read records from the segment file.
+    std::vector<uint8_t> read_buffer_;
+
+    //! Append-only stream to write the segment file.
+    std::ofstream writer_;
+
+    //! Sequential stream to read back the segment file.
+    std::ifstream reader_;
+
+    //! Spill and replay metrics.
+    SpillStatistics statistics_;
+
+    /**
+     * @brief Protect the spill state.
+     *
+     * It must be taken after \c pop_queue_mutex_ when both are needed.
+     */
+    mutable std::mutex spill_mutex_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/wait/impl/SpillDBQueueWaitHandler.ipp>
@@ -0,0 +1,205 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DelayQueueWaitHandler.ipp
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename T>
+DelayQueueWaitHandler<T>::DelayQueueWaitHandler(
+        bool enabled /* = true */)
+    : WaitHandler<CounterType>(0, enabled)
+{
+    logDebug(UTILS_WAIT_DELAY_QUEUE, "Created Delay Queue Wait Handler with type " << TYPE_NAME(T) << ".");
+}
+
+template <typename T>
+CounterType DelayQueueWaitHandler<T>::elements_pending() const noexcept
+{
+    return get_value();
+}
+
+template <typename T>
+utils::Timestamp DelayQueueWaitHandler<T>::next_ready_time() const noexcept
+{
+    std::lock_guard<std::mutex> lock(wait_condition_variable_mutex_);
+
+    if (heap_.empty())
+    {
+        return utils::the_end_of_time();
+    }
+    return heap_.front().ready_at;
+}
+
+template <typename T>
+void DelayQueueWaitHandler<T>::produce(
+        T&& value,
+        const utils::Timestamp& ready_at)
+{
+    push_entry_(Entry{std::move(value), ready_at, 0});
+}
+
+template <typename T>
+void DelayQueueWaitHandler<T>::produce(
+        const T& value,
+        const utils::Timestamp& ready_at)
+{
+    push_entry_(Entry{value, ready_at, 0});
+}
+
+template <typename T>
+T DelayQueueWaitHandler<T>::consume(
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    std::unique_lock<std::mutex> lock(wait_condition_variable_mutex_);
+
+    utils::Timestamp deadline;
+    if (timeout > 0)
+    {
+        deadline = utils::now() + utils::duration_to_ms(timeout);
+    }
+    else
+    {
+        deadline = utils::the_end_of_time();
+    }
+
+    // Increment number of threads waiting
+    // WARNING: mutex must be taken
+    threads_waiting_++;
+
+    // Every exit path must decrement the waiting threads and, if no one is waiting for the first value,
+    // awake another consumer so it takes the lead.
+    auto finish_waiting = [this]()
+            {
+                threads_waiting_--;
+                if (!leader_waiting_ && !heap_.empty())
+                {
+                    wait_condition_variable_.notify_one();
+                }
+            };
+
+    while (true)
+    {
+        if (!enabled_.load())
+        {
+            finish_waiting();
+            throw utils::DisabledException("DelayQueueWaitHandler has been disabled.");
+        }
+
+        utils::Timestamp current_time = utils::now();
+
+        if (!heap_.empty() && heap_.front().ready_at <= current_time)
+        {
+            T value = pop_entry_nts_();
+            finish_waiting();
+            return value;
+        }
+
+        if (current_time >= deadline)
+        {
+            finish_waiting();
+            throw utils::TimeoutException("DelayQueueWaitHandler awaken by timeout.");
+        }
+
+        if (heap_.empty() || leader_waiting_)
+        {
+            // Nothing to wait for, or other consumer is already waiting for the first value
+            wait_condition_variable_.wait_until(lock, deadline);
+        }
+        else
+        {
+            // Become the leader and sleep until the first value is ready
+            leader_waiting_ = true;
+            leader_ = std::this_thread::get_id();
+
+            wait_condition_variable_.wait_until(lock, std::min(heap_.front().ready_at, deadline));
+
+            // Leadership could have been revoked by a producer while waiting
+            if (leader_waiting_ && leader_ == std::this_thread::get_id())
+            {
+                leader_waiting_ = false;
+            }
+        }
+    }
+}
+
+template <typename T>
+void DelayQueueWaitHandler<T>::push_entry_(
+        Entry&& entry)
+{
+    bool new_first;
+    {
+        std::lock_guard<std::mutex> lock(wait_condition_variable_mutex_);
+
+        uint64_t sequence = next_sequence_++;
+        entry.sequence = sequence;
+        heap_.push_back(std::move(entry));
+        std::push_heap(heap_.begin(), heap_.end(), &DelayQueueWaitHandler<T>::entry_later_);
+        value_++;
+
+        // Only if the new value is the first one, the leader must wake up earlier
+        new_first = (heap_.front().sequence == sequence);
+        if (new_first)
+        {
+            leader_waiting_ = false;
+        }
+    }
+
+    if (new_first)
+    {
+        wait_condition_variable_.notify_one();
+    }
+}
+
+template <typename T>
+T DelayQueueWaitHandler<T>::pop_entry_nts_()
+{
+    std::pop_heap(heap_.begin(), heap_.end(), &DelayQueueWaitHandler<T>::entry_later_);
+
+    T value = std::move(heap_.back().value);
+    heap_.pop_back();
+    value_--;
+
+    return value;
+}
+
+template <typename T>
+bool DelayQueueWaitHandler<T>::entry_later_(
+        const Entry& lhs,
+        const Entry& rhs)
+{
+    if (lhs.ready_at != rhs.ready_at)
+    {
+        return lhs.ready_at > rhs.ready_at;
+    }
+
+    // Same time: the one produced later must be consumed later
+    return lhs.sequence > rhs.sequence;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
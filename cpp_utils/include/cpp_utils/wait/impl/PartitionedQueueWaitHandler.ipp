@@ -0,0 +1,275 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionedQueueWaitHandler.ipp
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename Key, typename T, typename Hash>
+PartitionedQueueWaitHandler<Key, T, Hash>::PartitionedQueueWaitHandler(
+        unsigned int partitions,
+        bool enabled /* = true */)
+    : enabled_(enabled)
+{
+    if (partitions < 1)
+    {
+        throw utils::InitializationException("PartitionedQueueWaitHandler requires at least 1 partition.");
+    }
+
+    for (unsigned int i = 0; i < partitions; ++i)
+    {
+        partitions_.emplace_back(new DBQueueWaitHandler<T>(0, enabled));
+    }
+
+    logDebug(
+        UTILS_WAIT_PARTITIONED_QUEUE,
+        "Created Partitioned Queue Wait Handler with type " << TYPE_NAME(T) << " and "
+                                                             << partitions << " partitions.");
+}
+
+template <typename Key, typename T, typename Hash>
+void PartitionedQueueWaitHandler<Key, T, Hash>::enable() noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    enabled_.store(true);
+    for (auto& partition : partitions_)
+    {
+        partition->enable();
+    }
+}
+
+template <typename Key, typename T, typename Hash>
+void PartitionedQueueWaitHandler<Key, T, Hash>::disable() noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    enabled_.store(false);
+    for (auto& partition : partitions_)
+    {
+        partition->disable();
+    }
+}
+
+template <typename Key, typename T, typename Hash>
+void PartitionedQueueWaitHandler<Key, T, Hash>::blocking_disable() noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    enabled_.store(false);
+    for (auto& partition : partitions_)
+    {
+        partition->blocking_disable();
+    }
+}
+
+template <typename Key, typename T, typename Hash>
+bool PartitionedQueueWaitHandler<Key, T, Hash>::enabled() const noexcept
+{
+    return enabled_.load();
+}
+
+template <typename Key, typename T, typename Hash>
+unsigned int PartitionedQueueWaitHandler<Key, T, Hash>::partitions() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    return partitions_.size();
+}
+
+template <typename Key, typename T, typename Hash>
+unsigned int PartitionedQueueWaitHandler<Key, T, Hash>::partition(
+        const Key& key) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    return hash_(key) % partitions_.size();
+}
+
+template <typename Key, typename T, typename Hash>
+CounterType PartitionedQueueWaitHandler<Key, T, Hash>::elements_ready_to_consume() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    CounterType result = 0;
+    for (const auto& partition : partitions_)
+    {
+        result += partition->elements_ready_to_consume();
+    }
+    return result;
+}
+
+template <typename Key, typename T, typename Hash>
+CounterType PartitionedQueueWaitHandler<Key, T, Hash>::elements_ready_to_consume(
+        unsigned int partition_index) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    return partition_nts_(partition_index)->elements_ready_to_consume();
+}
+
+template <typename Key, typename T, typename Hash>
+void PartitionedQueueWaitHandler<Key, T, Hash>::produce(
+        const Key& key,
+        T&& value)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(producers_mutex_);
+
+    partitions_[hash_(key) % partitions_.size()]->produce(std::move(value));
+}
+
+template <typename Key, typename T, typename Hash>
+void PartitionedQueueWaitHandler<Key, T, Hash>::produce(
+        const Key& key,
+        const T& value)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(producers_mutex_);
+
+    partitions_[hash_(key) % partitions_.size()]->produce(value);
+}
+
+template <typename Key, typename T, typename Hash>
+T PartitionedQueueWaitHandler<Key, T, Hash>::consume(
+        unsigned int partition_index,
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    DBQueueWaitHandler<T>* partition;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+        partition = partition_nts_(partition_index);
+    }
+
+    // Partitions are never destroyed while this object exists, so it could wait without mutex
+    return partition->consume(timeout);
+}
+
+template <typename Key, typename T, typename Hash>
+AwakeReason PartitionedQueueWaitHandler<Key, T, Hash>::wait_all_consumed(
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    return wait_all_consumed_nts_(timeout);
+}
+
+template <typename Key, typename T, typename Hash>
+unsigned int PartitionedQueueWaitHandler<Key, T, Hash>::add_partitions(
+        unsigned int new_partitions,
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    // Block producers until the new partitions are added
+    std::unique_lock<std::shared_timed_mutex> producers_lock(producers_mutex_);
+
+    // Consumers could still access the partitions while waiting
+    AwakeReason reason;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+        reason = wait_all_consumed_nts_(timeout);
+    }
+
+    if (reason == AwakeReason::disabled)
+    {
+        throw utils::DisabledException("PartitionedQueueWaitHandler has been disabled while rebalancing.");
+    }
+    else if (reason == AwakeReason::timeout)
+    {
+        throw utils::TimeoutException("PartitionedQueueWaitHandler rebalance awaken by timeout.");
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(partitions_mutex_);
+
+    for (unsigned int i = 0; i < new_partitions; ++i)
+    {
+        partitions_.emplace_back(new DBQueueWaitHandler<T>(0, enabled_.load()));
+    }
+
+    logDebug(
+        UTILS_WAIT_PARTITIONED_QUEUE,
+        "Partitioned Queue Wait Handler rebalanced to " << partitions_.size() << " partitions.");
+
+    return partitions_.size();
+}
+
+template <typename Key, typename T, typename Hash>
+DBQueueWaitHandler<T>* PartitionedQueueWaitHandler<Key, T, Hash>::partition_nts_(
+        unsigned int partition_index) const
+{
+    if (partition_index >= partitions_.size())
+    {
+        throw utils::PreconditionNotMet(
+                  STR_ENTRY << "Partition " << partition_index << " does not exist in a handler with "
+                            << partitions_.size() << " partitions.");
+    }
+
+    return partitions_[partition_index].get();
+}
+
+template <typename Key, typename T, typename Hash>
+AwakeReason PartitionedQueueWaitHandler<Key, T, Hash>::wait_all_consumed_nts_(
+        const utils::Duration_ms& timeout)
+{
+    // The timeout applies to the whole wait, so each partition only waits for the time left
+    utils::Timestamp deadline = utils::now() + utils::duration_to_ms(timeout);
+
+    for (auto& partition : partitions_)
+    {
+        // An empty partition does not need to wait (even if it is disabled)
+        if (partition->elements_ready_to_consume() == 0)
+        {
+            continue;
+        }
+
+        utils::Duration_ms partition_timeout = 0;
+        if (timeout > 0)
+        {
+            utils::Timestamp current_time = utils::now();
+            if (current_time >= deadline)
+            {
+                return AwakeReason::timeout;
+            }
+
+            // Rounded up and at least 1, as 0 would mean no time limit
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - current_time).count();
+            partition_timeout = static_cast<utils::Duration_ms>(std::max<decltype(remaining)>(remaining, 1));
+        }
+
+        AwakeReason reason = partition->wait_all_consumed(partition_timeout);
+        if (reason != AwakeReason::condition_met)
+        {
+            return reason;
+        }
+    }
+
+    return AwakeReason::condition_met;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
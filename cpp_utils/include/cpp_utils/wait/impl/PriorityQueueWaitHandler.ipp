@@ -0,0 +1,116 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PriorityQueueWaitHandler.ipp
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename T, typename Compare>
+PriorityQueueWaitHandler<T, Compare>::PriorityQueueWaitHandler(
+        const Compare& compare,
+        bool enabled /* = true */)
+    : ConsumerWaitHandler<T>(0, enabled)
+    , compare_(compare)
+{
+}
+
+template <typename T, typename Compare>
+void PriorityQueueWaitHandler<T, Compare>::add_value_(
+        T&& value)
+{
+    logDebug(UTILS_WAIT_PRIORITY_QUEUE, "Moving element to priority queue.");
+    std::lock_guard<std::mutex> lock(heap_mutex_);
+    push_entry_nts_(Entry{std::move(value), next_sequence_++});
+}
+
+template <typename T, typename Compare>
+void PriorityQueueWaitHandler<T, Compare>::add_value_(
+        const T& value)
+{
+    logDebug(UTILS_WAIT_PRIORITY_QUEUE, "Copying element to priority queue.");
+    std::lock_guard<std::mutex> lock(heap_mutex_);
+    push_entry_nts_(Entry{value, next_sequence_++});
+}
+
+template <typename T, typename Compare>
+T PriorityQueueWaitHandler<T, Compare>::get_next_value_()
+{
+    std::lock_guard<std::mutex> lock(heap_mutex_);
+
+    // If heap is empty, there is a synchronization problem
+    if (heap_.empty())
+    {
+        throw utils::InconsistencyException("Empty priority queue, impossible to get value.");
+    }
+
+    // Move highest priority entry to the back and take its value without copying it
+    std::pop_heap(
+        heap_.begin(),
+        heap_.end(),
+        [this](const Entry& lhs, const Entry& rhs)
+        {
+            return entry_less_(lhs, rhs);
+        });
+
+    T value = std::move(heap_.back().value);
+    heap_.pop_back();
+
+    return value;
+}
+
+template <typename T, typename Compare>
+void PriorityQueueWaitHandler<T, Compare>::push_entry_nts_(
+        Entry&& entry)
+{
+    heap_.push_back(std::move(entry));
+    std::push_heap(
+        heap_.begin(),
+        heap_.end(),
+        [this](const Entry& lhs, const Entry& rhs)
+        {
+            return entry_less_(lhs, rhs);
+        });
+}
+
+template <typename T, typename Compare>
+bool PriorityQueueWaitHandler<T, Compare>::entry_less_(
+        const Entry& lhs,
+        const Entry& rhs) const
+{
+    if (compare_(lhs.value, rhs.value))
+    {
+        return true;
+    }
+    else if (compare_(rhs.value, lhs.value))
+    {
+        return false;
+    }
+
+    // Same priority: the one produced later must be consumed later
+    return lhs.sequence > rhs.sequence;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
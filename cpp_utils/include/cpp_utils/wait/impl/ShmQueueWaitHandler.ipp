@@ -0,0 +1,140 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmQueueWaitHandler.ipp
+ */
+
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename T>
+ShmQueueWaitHandler<T>::ShmQueueWaitHandler(
+        const std::string& name,
+        uint64_t capacity,
+        bool enabled /* = true */)
+    : buffer_(name, sizeof(T), capacity, enabled)
+{
+    logDebug(UTILS_WAIT_SHM_QUEUE, "Created Shm Queue Wait Handler " << name << " with type " << TYPE_NAME(T) << ".");
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::remove(
+        const std::string& name) noexcept
+{
+    ShmRingBuffer::remove(name);
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::enable() noexcept
+{
+    buffer_.enable();
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::disable() noexcept
+{
+    buffer_.disable();
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::blocking_disable() noexcept
+{
+    buffer_.blocking_disable();
+}
+
+template <typename T>
+bool ShmQueueWaitHandler<T>::enabled() const noexcept
+{
+    return buffer_.enabled();
+}
+
+template <typename T>
+CounterType ShmQueueWaitHandler<T>::elements_ready_to_consume() const noexcept
+{
+    return static_cast<CounterType>(buffer_.size());
+}
+
+template <typename T>
+uint64_t ShmQueueWaitHandler<T>::capacity() const noexcept
+{
+    return buffer_.capacity();
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::produce(
+        const T& value,
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    throw_if_not_met_(buffer_.write(&value, timeout));
+}
+
+template <typename T>
+T ShmQueueWaitHandler<T>::consume(
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    T value;
+    uint64_t values_read;
+    throw_if_not_met_(buffer_.read(&value, 1, timeout, values_read));
+    return value;
+}
+
+template <typename T>
+std::vector<T> ShmQueueWaitHandler<T>::consume_batch(
+        std::size_t max_values,
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    if (max_values == 0)
+    {
+        return {};
+    }
+
+    std::vector<T> values(max_values);
+    uint64_t values_read;
+    throw_if_not_met_(buffer_.read(values.data(), max_values, timeout, values_read));
+    values.resize(static_cast<std::size_t>(values_read));
+    return values;
+}
+
+template <typename T>
+AwakeReason ShmQueueWaitHandler<T>::wait_all_consumed(
+        const utils::Duration_ms& timeout /* = 0 */)
+{
+    return buffer_.wait_empty(timeout);
+}
+
+template <typename T>
+void ShmQueueWaitHandler<T>::throw_if_not_met_(
+        AwakeReason reason)
+{
+    if (reason == AwakeReason::disabled)
+    {
+        throw utils::DisabledException("ShmQueueWaitHandler has been disabled.");
+    }
+    else if (reason == AwakeReason::timeout)
+    {
+        throw utils::TimeoutException("ShmQueueWaitHandler awaken by timeout.");
+    }
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,327 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SpillDBQueueWaitHandler.ipp
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename T>
+SpillDBQueueWaitHandler<T>::SpillDBQueueWaitHandler(
+        const SpillConfiguration& configuration,
+        const SpillCodec<T>& codec,
+        bool enabled /* = true */)
+    : DBQueueWaitHandler<T>(0, enabled)
+    , configuration_(configuration)
+    , codec_(codec)
+{
+    if (configuration_.file_path.empty())
+    {
+        throw utils::ConfigurationException("SpillDBQueueWaitHandler requires a segment file path.");
+    }
+    if (configuration_.batch_size == 0)
+    {
+        throw utils::ConfigurationException("SpillDBQueueWaitHandler batch size must be at least 1.");
+    }
+    if (!codec_.serialize || !codec_.deserialize)
+    {
+        throw utils::ConfigurationException("SpillDBQueueWaitHandler requires serialize and deserialize functions.");
+    }
+
+    writer_.open(configuration_.file_path, std::ios::binary | std::ios::trunc);
+    reader_.open(configuration_.file_path, std::ios::binary);
+    if (!writer_.is_open() || !reader_.is_open())
+    {
+        throw utils::InitializationException(
+                  STR_ENTRY << "Could not open spill segment file " << configuration_.file_path << ".");
+    }
+
+    logDebug(UTILS_WAIT_SPILL_DBQUEUE,
+            "Created Spill DBQueue Wait Handler with type " << TYPE_NAME(T) <<
+            " over file " << configuration_.file_path << ".");
+}
+
+template <typename T>
+SpillDBQueueWaitHandler<T>::~SpillDBQueueWaitHandler()
+{
+    // Consumers must leave before closing the file
+    this->blocking_disable();
+
+    writer_.close();
+    reader_.close();
+    std::remove(configuration_.file_path.c_str());
+}
+
+template <typename T>
+unsigned int SpillDBQueueWaitHandler<T>::elements_in_memory() const noexcept
+{
+    return in_memory_.load();
+}
+
+template <typename T>
+unsigned int SpillDBQueueWaitHandler<T>::elements_spilled() const noexcept
+{
+    return spilled_.load();
+}
+
+template <typename T>
+SpillStatistics SpillDBQueueWaitHandler<T>::statistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+    return statistics_;
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::add_value_(
+        T&& value)
+{
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+
+    if (must_spill_nts_())
+    {
+        spill_nts_(value);
+    }
+    else
+    {
+        in_memory_++;
+        this->queue_.push(std::move(value));
+    }
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::add_value_(
+        const T& value)
+{
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+
+    if (must_spill_nts_())
+    {
+        spill_nts_(value);
+    }
+    else
+    {
+        in_memory_++;
+        this->queue_.push(value);
+    }
+}
+
+template <typename T>
+T SpillDBQueueWaitHandler<T>::get_next_value_()
+{
+    // Assure that only one thread check if queue must be swapped
+    std::unique_lock<std::mutex> lock(this->pop_queue_mutex_);
+
+    // If front is empty, swap to back queue
+    if (this->queue_.empty())
+    {
+        this->queue_.swap();
+    }
+
+    // If memory is empty, the next value is in disk
+    if (this->queue_.empty())
+    {
+        {
+            std::lock_guard<std::mutex> spill_lock(spill_mutex_);
+            replay_batch_nts_();
+        }
+        this->queue_.swap();
+    }
+
+    // If queue is still empty, there is a synchronization problem
+    if (this->queue_.empty())
+    {
+        throw utils::InconsistencyException("Empty SpillDBQueue, impossible to get value.");
+    }
+
+    T value = this->queue_.front_and_pop();
+    in_memory_--;
+
+    // Bring the next batch before memory runs out, so consumers rarely wait for disk
+    if (spilled_.load() > 0 && in_memory_.load() <= configuration_.memory_threshold / 2)
+    {
+        std::lock_guard<std::mutex> spill_lock(spill_mutex_);
+        replay_batch_nts_();
+    }
+
+    return value;
+}
+
+template <typename T>
+bool SpillDBQueueWaitHandler<T>::must_spill_nts_() const noexcept
+{
+    // Once a value is in disk, every new value must go after it to keep the order
+    return spilled_.load() > 0 || in_memory_.load() >= configuration_.memory_threshold;
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::spill_nts_(
+        const T& value)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // Each record is its size followed by the serialized value
+    std::size_t record_begin = write_batch_.size();
+    write_batch_.resize(record_begin + sizeof(uint32_t));
+    codec_.serialize(value, write_batch_);
+    uint32_t size = static_cast<uint32_t>(write_batch_.size() - record_begin - sizeof(uint32_t));
+    std::memcpy(write_batch_.data() + record_begin, &size, sizeof(uint32_t));
+
+    values_in_write_batch_++;
+    spilled_++;
+    statistics_.spilled_values++;
+    statistics_.spilled_bytes += sizeof(uint32_t) + size;
+
+    if (values_in_write_batch_ >= configuration_.batch_size)
+    {
+        flush_write_batch_nts_();
+    }
+
+    statistics_.spill_time += std::chrono::steady_clock::now() - start;
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::flush_write_batch_nts_()
+{
+    if (values_in_write_batch_ == 0)
+    {
+        return;
+    }
+
+    writer_.write(reinterpret_cast<const char*>(write_batch_.data()), write_batch_.size());
+    writer_.flush();
+    if (!writer_)
+    {
+        throw utils::InconsistencyException(
+                  STR_ENTRY << "Error writing spill segment file " << configuration_.file_path << ".");
+    }
+
+    logDebug(UTILS_WAIT_SPILL_DBQUEUE,
+            "Spilled " << values_in_write_batch_ << " values (" << write_batch_.size() << " bytes) to disk.");
+
+    unread_in_file_ += values_in_write_batch_;
+    bytes_in_file_ += write_batch_.size();
+    statistics_.write_operations++;
+
+    values_in_write_batch_ = 0;
+    write_batch_.clear();
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::replay_batch_nts_()
+{
+    if (spilled_.load() == 0)
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (unread_in_file_ == 0)
+    {
+        // Every value in disk has been read, the next ones have not been written yet
+        std::size_t offset = 0;
+        while (offset < write_batch_.size())
+        {
+            uint32_t size;
+            std::memcpy(&size, write_batch_.data() + offset, sizeof(uint32_t));
+            offset += sizeof(uint32_t);
+            this->queue_.push(codec_.deserialize(write_batch_.data() + offset, size));
+            offset += size;
+        }
+
+        in_memory_ += values_in_write_batch_;
+        spilled_ -= values_in_write_batch_;
+        statistics_.replayed_values += values_in_write_batch_;
+        statistics_.replayed_bytes += write_batch_.size();
+
+        values_in_write_batch_ = 0;
+        write_batch_.clear();
+    }
+    else
+    {
+        unsigned int values_to_read = std::min(configuration_.batch_size, unread_in_file_);
+        for (unsigned int i = 0; i < values_to_read; ++i)
+        {
+            uint32_t size;
+            reader_.read(reinterpret_cast<char*>(&size), sizeof(uint32_t));
+            read_buffer_.resize(size);
+            reader_.read(reinterpret_cast<char*>(read_buffer_.data()), size);
+            if (!reader_)
+            {
+                throw utils::InconsistencyException(
+                          STR_ENTRY << "Error reading spill segment file " << configuration_.file_path << ".");
+            }
+
+            this->queue_.push(codec_.deserialize(read_buffer_.data(), size));
+
+            in_memory_++;
+            spilled_--;
+            unread_in_file_--;
+            statistics_.replayed_bytes += sizeof(uint32_t) + size;
+        }
+
+        statistics_.replayed_values += values_to_read;
+        statistics_.read_operations++;
+
+        logDebug(UTILS_WAIT_SPILL_DBQUEUE, "Replayed " << values_to_read << " values from disk.");
+    }
+
+    if (spilled_.load() == 0)
+    {
+        reset_segment_nts_();
+    }
+
+    statistics_.replay_time += std::chrono::steady_clock::now() - start;
+}
+
+template <typename T>
+void SpillDBQueueWaitHandler<T>::reset_segment_nts_()
+{
+    if (bytes_in_file_ == 0)
+    {
+        return;
+    }
+
+    writer_.close();
+    writer_.open(configuration_.file_path, std::ios::binary | std::ios::trunc);
+    reader_.close();
+    reader_.clear();
+    reader_.open(configuration_.file_path, std::ios::binary);
+    if (!writer_.is_open() || !reader_.is_open())
+    {
+        throw utils::InconsistencyException(
+                  STR_ENTRY << "Could not reopen spill segment file " << configuration_.file_path << ".");
+    }
+
+    bytes_in_file_ = 0;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
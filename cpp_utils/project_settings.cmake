@@ -22,6 +22,9 @@ set(MODULE_NAME
 set(MODULE_SUMMARY
     "C++ library for generic useful methods and classes for Developers.")
 
+set(MODULE_CPP_VERSION
+    C++17)
+
 set(MODULE_FIND_PACKAGES
         fastcdr
         fastdds
@@ -29,6 +32,7 @@ set(MODULE_FIND_PACKAGES
 
 set(MODULE_DEPENDENCIES
         $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi>
+        $<$<PLATFORM_ID:Linux>:rt>
         ${MODULE_FIND_PACKAGES}
     )
 
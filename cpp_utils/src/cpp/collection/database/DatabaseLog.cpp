@@ -0,0 +1,708 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DatabaseLog.cpp
+ *
+ */
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // if defined(_WIN32) || defined(_WIN64)
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+#include <cpp_utils/collection/database/DatabaseLog.hpp>
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+//! Identify a snapshot file ("EPDS").
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53445045;
+
+//! Version of the snapshot layout.
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+//! Header of a snapshot file, followed by its entries framed as log records.
+struct SnapshotHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+    uint64_t count;
+};
+
+//! Bytes before each payload in files: size and CRC-32 of the payload.
+constexpr std::size_t FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+//! Bytes at the beginning of each payload: operation and key size.
+constexpr std::size_t PAYLOAD_HEADER_SIZE = 1 + sizeof(uint32_t);
+
+//! Prefix of the log files, followed by their generation.
+constexpr const char* LOG_PREFIX = "log.";
+
+uint32_t read_u32(
+        const uint8_t* data) noexcept
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void write_u32(
+        uint8_t* data,
+        uint32_t value) noexcept
+{
+    std::memcpy(data, &value, sizeof(value));
+}
+
+/**
+ * @brief Call \c visitor with each valid record framed in \c size bytes starting in \c data .
+ *
+ * @return bytes of valid records, from the beginning of \c data to the first torn or corrupt record.
+ */
+std::size_t parse_records(
+        const uint8_t* data,
+        std::size_t size,
+        const DatabaseLog::RecordVisitor& visitor,
+        uint64_t& records)
+{
+    std::size_t position = 0;
+    while (size - position >= FRAME_HEADER_SIZE)
+    {
+        uint32_t payload_size = read_u32(data + position);
+        uint32_t checksum = read_u32(data + position + sizeof(uint32_t));
+        const uint8_t* payload = data + position + FRAME_HEADER_SIZE;
+
+        if (payload_size < PAYLOAD_HEADER_SIZE ||
+                payload_size > size - position - FRAME_HEADER_SIZE ||
+                DatabaseLog::crc32(payload, payload_size) != checksum)
+        {
+            break;
+        }
+
+        uint8_t operation = payload[0];
+        uint32_t key_size = read_u32(payload + 1);
+        if (operation > static_cast<uint8_t>(DatabaseLogOperation::erase) ||
+                key_size > payload_size - PAYLOAD_HEADER_SIZE)
+        {
+            break;
+        }
+
+        const uint8_t* key = payload + PAYLOAD_HEADER_SIZE;
+        visitor(
+            static_cast<DatabaseLogOperation>(operation),
+            key,
+            key_size,
+            key + key_size,
+            payload_size - PAYLOAD_HEADER_SIZE - key_size);
+
+        position += FRAME_HEADER_SIZE + payload_size;
+        records++;
+    }
+
+    return position;
+}
+
+/**
+ * @brief Read-only view of the whole content of a file.
+ *
+ * The file is memory-mapped where available, and read into memory otherwise.
+ */
+class FileView
+{
+public:
+
+    explicit FileView(
+            const std::string& path)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw InitializationException(STR_ENTRY << "Could not open file " << path << ".");
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = reinterpret_cast<const uint8_t*>(buffer_.data());
+        size_ = buffer_.size();
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat status;
+        if (fd < 0 || ::fstat(fd, &status) != 0)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            throw InitializationException(STR_ENTRY << "Could not open file " << path << ".");
+        }
+
+        size_ = static_cast<std::size_t>(status.st_size);
+        if (size_ > 0)
+        {
+            void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED)
+            {
+                ::close(fd);
+                throw InitializationException(STR_ENTRY << "Could not map file " << path << ".");
+            }
+            // Entries are read once, in order
+            ::madvise(mapped, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const uint8_t*>(mapped);
+        }
+        ::close(fd);
+#endif // if defined(_WIN32) || defined(_WIN64)
+    }
+
+    ~FileView()
+    {
+#if !defined(_WIN32) && !defined(_WIN64)
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+#endif // if !defined(_WIN32) && !defined(_WIN64)
+    }
+
+    FileView(
+            const FileView&) = delete;
+    FileView& operator =(
+            const FileView&) = delete;
+
+    const uint8_t* data() const noexcept
+    {
+        return data_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    std::vector<char> buffer_;
+#endif // if defined(_WIN32) || defined(_WIN64)
+};
+
+int open_append(
+        const std::string& path)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+#endif // if defined(_WIN32) || defined(_WIN64)
+}
+
+int open_truncate(
+        const std::string& path)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif // if defined(_WIN32) || defined(_WIN64)
+}
+
+//! Write every byte of \c size bytes starting in \c data . Return whether it succeeded.
+bool write_all(
+        int fd,
+        const uint8_t* data,
+        std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        int written = ::_write(fd, data, static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30)));
+#else
+        ssize_t written = ::write(fd, data, size);
+#endif // if defined(_WIN32) || defined(_WIN64)
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+//! Flush the content of \c fd to the storage device. Return whether it succeeded.
+bool sync_file(
+        int fd) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return ::_commit(fd) == 0;
+#else
+    return ::fsync(fd) == 0;
+#endif // if defined(_WIN32) || defined(_WIN64)
+}
+
+//! Discard the content of \c fd after \c size bytes. Return whether it succeeded.
+bool truncate_file(
+        int fd,
+        uint64_t size) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return ::_chsize_s(fd, static_cast<__int64>(size)) == 0;
+#else
+    return ::ftruncate(fd, static_cast<off_t>(size)) == 0;
+#endif // if defined(_WIN32) || defined(_WIN64)
+}
+
+void close_file(
+        int fd) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif // if defined(_WIN32) || defined(_WIN64)
+}
+
+//! Flush the entries of \c directory , so files created or renamed in it survive a crash.
+void sync_directory(
+        const std::string& directory) noexcept
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#endif // if !defined(_WIN32) && !defined(_WIN64)
+}
+
+//! Generation of every log file in \c directory , sorted.
+std::vector<uint64_t> log_generations(
+        const std::string& directory)
+{
+    std::vector<uint64_t> generations;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        std::string name = entry.path().filename().string();
+        if (name.compare(0, std::strlen(LOG_PREFIX), LOG_PREFIX) != 0)
+        {
+            continue;
+        }
+
+        std::string suffix = name.substr(std::strlen(LOG_PREFIX));
+        if (suffix.empty() || suffix.find_first_not_of("0123456789") != std::string::npos)
+        {
+            continue;
+        }
+        generations.push_back(std::stoull(suffix));
+    }
+
+    std::sort(generations.begin(), generations.end());
+    return generations;
+}
+
+} /* namespace */
+
+/////
+// PersistenceStatistics
+
+double PersistenceStatistics::write_amplification() const noexcept
+{
+    if (logical_bytes == 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(log_bytes + snapshot_bytes) / static_cast<double>(logical_bytes);
+}
+
+/////
+// DatabaseLog
+
+DatabaseLog::DatabaseLog(
+        const PersistenceConfiguration& configuration)
+    : configuration_(configuration)
+    , generation_(0)
+    , log_fd_(-1)
+    , log_written_(0)
+    , appended_(0)
+    , committed_(0)
+    , writing_(false)
+{
+    if (configuration_.directory.empty())
+    {
+        throw ConfigurationException("DatabaseLog requires a directory.");
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(configuration_.directory, error);
+    if (error)
+    {
+        throw InitializationException(
+                  STR_ENTRY << "Could not create database directory " << configuration_.directory << ": "
+                            << error.message() << ".");
+    }
+}
+
+DatabaseLog::~DatabaseLog()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (log_fd_ < 0)
+    {
+        return;
+    }
+
+    try
+    {
+        commit_nts_(lock, appended_);
+    }
+    catch (const InconsistencyException& e)
+    {
+        logWarning(DATABASE_LOG, "Records lost closing the database log: " << e.what());
+    }
+
+    close_file(log_fd_);
+}
+
+void DatabaseLog::recover(
+        const RecordVisitor& visitor)
+{
+    std::lock_guard<std::mutex> _(mutex_);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Load the snapshot, that is always complete as it is renamed once written
+    uint64_t snapshot_generation = 0;
+    if (std::filesystem::exists(snapshot_path_()))
+    {
+        FileView snapshot(snapshot_path_());
+
+        SnapshotHeader header;
+        if (snapshot.size() < sizeof(header))
+        {
+            throw InitializationException(STR_ENTRY << "Corrupt database snapshot " << snapshot_path_() << ".");
+        }
+        std::memcpy(&header, snapshot.data(), sizeof(header));
+        if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION)
+        {
+            throw InitializationException(STR_ENTRY << "Corrupt database snapshot " << snapshot_path_() << ".");
+        }
+
+        uint64_t entries = 0;
+        std::size_t valid = parse_records(
+            snapshot.data() + sizeof(header),
+            snapshot.size() - sizeof(header),
+            visitor,
+            entries);
+        if (entries != header.count || valid != snapshot.size() - sizeof(header))
+        {
+            throw InitializationException(STR_ENTRY << "Corrupt database snapshot " << snapshot_path_() << ".");
+        }
+
+        snapshot_generation = header.generation;
+        statistics_.recovered_entries = entries;
+    }
+
+    // Replay the logs since the snapshot, removing the older ones left by an interrupted compaction
+    generation_ = snapshot_generation;
+    std::vector<uint64_t> generations = log_generations(configuration_.directory);
+    for (uint64_t generation : generations)
+    {
+        if (generation < snapshot_generation)
+        {
+            std::filesystem::remove(log_path_(generation));
+            continue;
+        }
+
+        std::size_t size;
+        std::size_t valid;
+        {
+            FileView log(log_path_(generation));
+            size = log.size();
+            valid = parse_records(log.data(), size, visitor, statistics_.replayed_records);
+        }
+
+        // Older logs were committed before rotating, so only the last one could have been torn by a crash
+        if (valid < size && generation != generations.back())
+        {
+            throw InitializationException(STR_ENTRY << "Corrupt database log " << log_path_(generation) << ".");
+        }
+
+        if (valid < size)
+        {
+            logWarning(DATABASE_LOG, "Discarding " << size - valid << " bytes of torn or corrupt records from "
+                                                   << log_path_(generation) << ".");
+            statistics_.discarded_bytes += size - valid;
+            std::filesystem::resize_file(log_path_(generation), valid);
+        }
+
+        generation_ = generation;
+        log_written_ = valid;
+    }
+
+    open_log_();
+
+    statistics_.recovery_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    logDebug(DATABASE_LOG, "Recovered " << statistics_.recovered_entries << " entries and replayed "
+                                        << statistics_.replayed_records << " records from "
+                                        << configuration_.directory << ".");
+}
+
+std::size_t DatabaseLog::begin_record(
+        std::vector<uint8_t>& payload,
+        DatabaseLogOperation operation)
+{
+    payload.push_back(static_cast<uint8_t>(operation));
+    std::size_t position = payload.size();
+    payload.resize(position + sizeof(uint32_t));
+    return position;
+}
+
+void DatabaseLog::end_key(
+        std::vector<uint8_t>& payload,
+        std::size_t position)
+{
+    write_u32(payload.data() + position, static_cast<uint32_t>(payload.size() - position - sizeof(uint32_t)));
+}
+
+void DatabaseLog::frame(
+        std::vector<uint8_t>& buffer,
+        const std::vector<uint8_t>& payload)
+{
+    std::size_t position = buffer.size();
+    buffer.resize(position + FRAME_HEADER_SIZE + payload.size());
+    write_u32(buffer.data() + position, static_cast<uint32_t>(payload.size()));
+    write_u32(buffer.data() + position + sizeof(uint32_t), crc32(payload.data(), payload.size()));
+    std::memcpy(buffer.data() + position + FRAME_HEADER_SIZE, payload.data(), payload.size());
+}
+
+uint64_t DatabaseLog::append(
+        const std::vector<uint8_t>& payload)
+{
+    std::lock_guard<std::mutex> _(mutex_);
+
+    frame(buffer_, payload);
+    statistics_.logged_records++;
+    statistics_.logical_bytes += payload.size() - PAYLOAD_HEADER_SIZE;
+
+    return ++appended_;
+}
+
+void DatabaseLog::commit(
+        uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    commit_nts_(lock, sequence);
+}
+
+uint64_t DatabaseLog::log_size() const
+{
+    std::lock_guard<std::mutex> _(mutex_);
+    return log_written_ + buffer_.size();
+}
+
+uint64_t DatabaseLog::rotate()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    commit_nts_(lock, appended_);
+
+    close_file(log_fd_);
+    log_fd_ = -1;
+    generation_++;
+    log_written_ = 0;
+    open_log_();
+
+    return generation_;
+}
+
+void DatabaseLog::write_snapshot(
+        uint64_t generation,
+        const std::vector<uint8_t>& entries,
+        uint64_t count)
+{
+    SnapshotHeader header {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, generation, count};
+    std::string temporary_path = snapshot_path_() + ".tmp";
+
+    // Write it aside and rename it, so a crash never leaves a partial snapshot
+    int fd = open_truncate(temporary_path);
+    bool written = fd >= 0 &&
+            write_all(fd, reinterpret_cast<const uint8_t*>(&header), sizeof(header)) &&
+            write_all(fd, entries.data(), entries.size()) &&
+            sync_file(fd);
+    if (fd >= 0)
+    {
+        close_file(fd);
+    }
+
+    std::error_code error;
+    if (written)
+    {
+        std::filesystem::rename(temporary_path, snapshot_path_(), error);
+    }
+    if (!written || error)
+    {
+        std::filesystem::remove(temporary_path, error);
+        throw InconsistencyException(STR_ENTRY << "Error writing database snapshot " << snapshot_path_() << ".");
+    }
+    sync_directory(configuration_.directory);
+
+    // The snapshot replaces every log before its generation
+    for (uint64_t old_generation : log_generations(configuration_.directory))
+    {
+        if (old_generation < generation)
+        {
+            std::filesystem::remove(log_path_(old_generation), error);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> _(mutex_);
+        statistics_.snapshots++;
+        statistics_.snapshot_bytes += sizeof(header) + entries.size();
+    }
+
+    logDebug(DATABASE_LOG, "Written snapshot of generation " << generation << " with " << count << " entries ("
+                                                             << sizeof(header) + entries.size() << " bytes).");
+}
+
+PersistenceStatistics DatabaseLog::statistics() const
+{
+    std::lock_guard<std::mutex> _(mutex_);
+    return statistics_;
+}
+
+uint32_t DatabaseLog::crc32(
+        const uint8_t* data,
+        std::size_t size) noexcept
+{
+    static const std::array<uint32_t, 256> table = []()
+            {
+                std::array<uint32_t, 256> result;
+                for (uint32_t i = 0; i < 256; i++)
+                {
+                    uint32_t value = i;
+                    for (int bit = 0; bit < 8; bit++)
+                    {
+                        value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                    }
+                    result[i] = value;
+                }
+                return result;
+            }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+std::string DatabaseLog::log_path_(
+        uint64_t generation) const
+{
+    return (std::filesystem::path(configuration_.directory) / (LOG_PREFIX + std::to_string(generation))).string();
+}
+
+std::string DatabaseLog::snapshot_path_() const
+{
+    return (std::filesystem::path(configuration_.directory) / "snapshot").string();
+}
+
+void DatabaseLog::open_log_()
+{
+    log_fd_ = open_append(log_path_(generation_));
+    if (log_fd_ < 0)
+    {
+        throw InitializationException(STR_ENTRY << "Could not open database log " << log_path_(generation_) << ".");
+    }
+    sync_directory(configuration_.directory);
+}
+
+void DatabaseLog::commit_nts_(
+        std::unique_lock<std::mutex>& lock,
+        uint64_t sequence)
+{
+    while (committed_ < sequence)
+    {
+        if (writing_)
+        {
+            // Another thread is writing, and will probably take this record too
+            committed_cv_.wait(lock);
+            continue;
+        }
+
+        // Become the leader of this group: write every record buffered so far
+        writing_ = true;
+        std::vector<uint8_t> group;
+        group.swap(buffer_);
+        uint64_t last = appended_;
+
+        lock.unlock();
+        bool written = write_all(log_fd_, group.data(), group.size()) &&
+                (!configuration_.sync || sync_file(log_fd_));
+        lock.lock();
+
+        writing_ = false;
+        if (!written)
+        {
+            // Drop what could have been written, so the next writer retries the whole group
+            truncate_file(log_fd_, log_written_);
+            buffer_.insert(buffer_.begin(), group.begin(), group.end());
+            committed_cv_.notify_all();
+            throw InconsistencyException(
+                      STR_ENTRY << "Error writing database log " << log_path_(generation_) << ".");
+        }
+
+        committed_ = last;
+        log_written_ += group.size();
+        statistics_.log_bytes += group.size();
+        statistics_.commits++;
+        committed_cv_.notify_all();
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,224 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HazardPointer.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/memory/HazardPointer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+/**
+ * @brief Whether the cache of this thread has already been destroyed.
+ *
+ * It is trivially destructible, so it could be read by any later thread local or static destructor.
+ */
+thread_local bool thread_cache_destroyed_ = false;
+
+/**
+ * @brief Slots released by a thread, reused by it before taking any from the domain.
+ *
+ * When the thread finishes, its slots are returned to the domain for other threads.
+ */
+struct ThreadSlotCache
+{
+    ~ThreadSlotCache()
+    {
+        thread_cache_destroyed_ = true;
+        for (HazardSlot* slot : slots)
+        {
+            HazardPointerDomain::global().release_slot(slot);
+        }
+    }
+
+    std::vector<HazardSlot*> slots;
+};
+
+/**
+ * @brief Cache of this thread, or nullptr if it has already been destroyed.
+ *
+ * Hazard pointers created or destroyed after it (e.g. from other thread local destructors) use the domain.
+ */
+ThreadSlotCache* thread_cache_() noexcept
+{
+    if (thread_cache_destroyed_)
+    {
+        return nullptr;
+    }
+    static thread_local ThreadSlotCache cache;
+    return &cache;
+}
+
+/**
+ * @brief Return \c slot to the cache of this thread, or to the domain if the cache is gone.
+ */
+void release_to_cache_(
+        HazardSlot* slot) noexcept
+{
+    ThreadSlotCache* cache = thread_cache_();
+    if (cache == nullptr)
+    {
+        HazardPointerDomain::global().release_slot(slot);
+        return;
+    }
+
+    try
+    {
+        cache->slots.push_back(slot);
+    }
+    catch (...)
+    {
+        HazardPointerDomain::global().release_slot(slot);
+    }
+}
+
+} /* namespace */
+
+/////
+// HazardPointerDomain
+
+HazardPointerDomain& HazardPointerDomain::global() noexcept
+{
+    // Leaked on purpose: hazard pointers could still be used from destructors of other statics
+    static auto* domain = new HazardPointerDomain();
+    return *domain;
+}
+
+HazardSlot* HazardPointerDomain::acquire_slot()
+{
+    // Reuse a released slot
+    for (HazardSlot* slot = head_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        bool free = false;
+        if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(free, true, std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+
+    // Every slot is in use, push a new one
+    HazardSlot* slot = new HazardSlot();
+    slot->in_use.store(true, std::memory_order_relaxed);
+    HazardSlot* head = head_.load(std::memory_order_relaxed);
+    do
+    {
+        slot->next = head;
+    }
+    while (!head_.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+
+    return slot;
+}
+
+void HazardPointerDomain::release_slot(
+        HazardSlot* slot) noexcept
+{
+    slot->pointer.store(nullptr, std::memory_order_release);
+    slot->in_use.store(false, std::memory_order_release);
+}
+
+bool HazardPointerDomain::is_protected(
+        const void* pointer) const noexcept
+{
+    for (HazardSlot* slot = head_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        if (slot->pointer.load(std::memory_order_seq_cst) == pointer)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<const void*> HazardPointerDomain::protected_pointers() const
+{
+    std::vector<const void*> pointers;
+    for (HazardSlot* slot = head_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        const void* pointer = slot->pointer.load(std::memory_order_seq_cst);
+        if (pointer != nullptr)
+        {
+            pointers.push_back(pointer);
+        }
+    }
+    std::sort(pointers.begin(), pointers.end());
+    return pointers;
+}
+
+/////
+// HazardPointer
+
+HazardPointer::HazardPointer()
+{
+    ThreadSlotCache* cache = thread_cache_();
+    if (cache == nullptr || cache->slots.empty())
+    {
+        slot_ = HazardPointerDomain::global().acquire_slot();
+    }
+    else
+    {
+        slot_ = cache->slots.back();
+        cache->slots.pop_back();
+    }
+}
+
+HazardPointer::~HazardPointer()
+{
+    if (slot_ != nullptr)
+    {
+        reset();
+        release_to_cache_(slot_);
+    }
+}
+
+HazardPointer::HazardPointer(
+        HazardPointer&& other) noexcept
+    : slot_(other.slot_)
+{
+    other.slot_ = nullptr;
+}
+
+HazardPointer& HazardPointer::operator =(
+        HazardPointer&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (slot_ != nullptr)
+        {
+            reset();
+            release_to_cache_(slot_);
+        }
+        slot_ = other.slot_;
+        other.slot_ = nullptr;
+    }
+    return *this;
+}
+
+void HazardPointer::reset() noexcept
+{
+    if (slot_ != nullptr)
+    {
+        slot_->pointer.store(nullptr, std::memory_order_release);
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,141 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ArenaMemoryResource.cpp
+ *
+ */
+
+#include <memory>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/pool/ArenaMemoryResource.hpp>
+
+namespace eprosima {
+namespace utils {
+
+ArenaMemoryResource::ArenaMemoryResource(
+        std::pmr::memory_resource* upstream /* = std::pmr::get_default_resource() */,
+        std::size_t chunk_size /* = DEFAULT_CHUNK_SIZE */)
+    : upstream_(upstream)
+    , chunk_size_(chunk_size)
+    , last_chunk_(nullptr)
+    , chunks_(0)
+    , cursor_(nullptr)
+    , remaining_(0)
+    , bytes_allocated_(0)
+{
+    if (chunk_size_ <= sizeof(ChunkHeader))
+    {
+        throw InitializationException(
+                  STR_ENTRY << "Arena chunk size must be bigger than " << sizeof(ChunkHeader) << " bytes.");
+    }
+}
+
+ArenaMemoryResource::~ArenaMemoryResource()
+{
+    release();
+}
+
+void ArenaMemoryResource::release() noexcept
+{
+    while (last_chunk_ != nullptr)
+    {
+        ChunkHeader* previous = last_chunk_->previous;
+        upstream_->deallocate(last_chunk_, last_chunk_->size, alignof(std::max_align_t));
+        last_chunk_ = previous;
+    }
+
+    chunks_ = 0;
+    cursor_ = nullptr;
+    remaining_ = 0;
+    bytes_allocated_ = 0;
+}
+
+std::pmr::memory_resource* ArenaMemoryResource::upstream_resource() const noexcept
+{
+    return upstream_;
+}
+
+std::size_t ArenaMemoryResource::bytes_allocated() const noexcept
+{
+    return bytes_allocated_;
+}
+
+std::size_t ArenaMemoryResource::chunks() const noexcept
+{
+    return chunks_;
+}
+
+void* ArenaMemoryResource::do_allocate(
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    if (bytes == 0)
+    {
+        bytes = 1;
+    }
+
+    void* result = std::align(alignment, bytes, cursor_, remaining_);
+    if (result == nullptr)
+    {
+        std::size_t chunk_capacity = chunk_size_ - sizeof(ChunkHeader);
+        if (bytes + alignment > chunk_capacity)
+        {
+            // Too big for a regular chunk: it gets its own one, and the current chunk is kept for next allocations
+            std::size_t space = bytes + alignment;
+            void* memory = new_chunk_(sizeof(ChunkHeader) + space) + 1;
+            bytes_allocated_ += bytes;
+            return std::align(alignment, bytes, memory, space);
+        }
+
+        cursor_ = new_chunk_(chunk_size_) + 1;
+        remaining_ = chunk_capacity;
+        result = std::align(alignment, bytes, cursor_, remaining_);
+    }
+
+    cursor_ = static_cast<unsigned char*>(result) + bytes;
+    remaining_ -= bytes;
+    bytes_allocated_ += bytes;
+    return result;
+}
+
+void ArenaMemoryResource::do_deallocate(
+        void*,
+        std::size_t,
+        std::size_t)
+{
+    // Memory is only given back in release
+}
+
+bool ArenaMemoryResource::do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+ArenaMemoryResource::ChunkHeader* ArenaMemoryResource::new_chunk_(
+        std::size_t size)
+{
+    ChunkHeader* chunk = static_cast<ChunkHeader*>(upstream_->allocate(size, alignof(std::max_align_t)));
+    chunk->previous = last_chunk_;
+    chunk->size = size;
+    last_chunk_ = chunk;
+    chunks_++;
+    return chunk;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
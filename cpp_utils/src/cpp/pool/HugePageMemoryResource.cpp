@@ -0,0 +1,268 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HugePageMemoryResource.cpp
+ *
+ */
+
+#if defined(__linux__)
+    #include <linux/mempolicy.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <cstdint>
+#include <new>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/pool/HugePageMemoryResource.hpp>
+
+namespace eprosima {
+namespace utils {
+
+HugePageMemoryResource::HugePageMemoryResource(
+        HugePageConfiguration configuration /* = HugePageConfiguration() */,
+        std::pmr::memory_resource* upstream /* = std::pmr::new_delete_resource() */)
+    : configuration_(configuration)
+    , upstream_(upstream)
+    , hugetlb_allocations_(0)
+    , regular_allocations_(0)
+    , numa_bound_allocations_(0)
+{
+    std::size_t page = configuration_.huge_page_size;
+    if (page == 0 || (page & (page - 1)) != 0)
+    {
+        throw InitializationException(
+                  STR_ENTRY << "Huge page size " << page << " must be a power of 2.");
+    }
+}
+
+std::pmr::memory_resource* HugePageMemoryResource::upstream_resource() const noexcept
+{
+    return upstream_;
+}
+
+unsigned int HugePageMemoryResource::hugetlb_allocations() const noexcept
+{
+    return hugetlb_allocations_.load();
+}
+
+unsigned int HugePageMemoryResource::regular_allocations() const noexcept
+{
+    return regular_allocations_.load();
+}
+
+unsigned int HugePageMemoryResource::numa_bound_allocations() const noexcept
+{
+    return numa_bound_allocations_.load();
+}
+
+bool HugePageMemoryResource::is_supported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif // if defined(__linux__)
+}
+
+#if defined(__linux__)
+
+void* HugePageMemoryResource::do_allocate(
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    if (!is_mapped_(bytes, alignment))
+    {
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    std::size_t size = mapping_size_(bytes);
+    void* memory = MAP_FAILED;
+    bool hugetlb = false;
+
+    if (configuration_.use_hugetlb)
+    {
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        hugetlb = memory != MAP_FAILED;
+        if (!hugetlb)
+        {
+            logDebug(HUGE_PAGE_MEMORY_RESOURCE, "MAP_HUGETLB not available, using regular pages.");
+        }
+    }
+
+    if (!hugetlb)
+    {
+        memory = map_aligned_(size);
+        if (configuration_.use_transparent && madvise(memory, size, MADV_HUGEPAGE) != 0)
+        {
+            logDebug(HUGE_PAGE_MEMORY_RESOURCE, "Transparent huge pages not available.");
+        }
+    }
+
+    // Bind before the memory is touched, so pages are placed in the local node when faulted
+    if (configuration_.numa_local && bind_local_(memory, size))
+    {
+        numa_bound_allocations_++;
+    }
+
+    if (hugetlb)
+    {
+        hugetlb_allocations_++;
+    }
+    else
+    {
+        regular_allocations_++;
+    }
+
+    logDebug(
+        HUGE_PAGE_MEMORY_RESOURCE,
+        "Mapped " << size << " bytes at " << memory << (hugetlb ? " with MAP_HUGETLB." : " with regular pages."));
+
+    return memory;
+}
+
+void HugePageMemoryResource::do_deallocate(
+        void* p,
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    if (!is_mapped_(bytes, alignment))
+    {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    if (munmap(p, mapping_size_(bytes)) != 0)
+    {
+        logDevError(HUGE_PAGE_MEMORY_RESOURCE, "Error unmapping " << bytes << " bytes at " << p << ".");
+    }
+}
+
+void* HugePageMemoryResource::map_aligned_(
+        std::size_t size)
+{
+    // Map one extra huge page to align the start, and unmap the unused head and tail
+    std::size_t page = configuration_.huge_page_size;
+    void* memory = mmap(nullptr, size + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(memory);
+    std::uintptr_t aligned = (start + page - 1) & ~(static_cast<std::uintptr_t>(page) - 1);
+
+    if (aligned > start)
+    {
+        munmap(memory, aligned - start);
+    }
+    std::size_t tail = (start + size + page) - (aligned + size);
+    if (tail > 0)
+    {
+        munmap(reinterpret_cast<void*>(aligned + size), tail);
+    }
+
+    return reinterpret_cast<void*>(aligned);
+}
+
+bool HugePageMemoryResource::bind_local_(
+        void* memory,
+        std::size_t size) noexcept
+{
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+    {
+        return false;
+    }
+
+    constexpr std::size_t MASK_BITS = 1024;
+    constexpr std::size_t WORD_BITS = sizeof(unsigned long) * 8;
+    if (node >= MASK_BITS)
+    {
+        return false;
+    }
+
+    unsigned long mask[MASK_BITS / WORD_BITS] = {};
+    mask[node / WORD_BITS] = 1ul << (node % WORD_BITS);
+
+    // Preferred instead of bind, so memory could still be taken from other nodes if the local one is full
+    if (syscall(SYS_mbind, memory, size, MPOL_PREFERRED, mask, MASK_BITS + 1, 0) != 0)
+    {
+        logDebug(HUGE_PAGE_MEMORY_RESOURCE, "mbind to node " << node << " failed.");
+        return false;
+    }
+    return true;
+}
+
+#else
+
+void* HugePageMemoryResource::do_allocate(
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    return upstream_->allocate(bytes, alignment);
+}
+
+void HugePageMemoryResource::do_deallocate(
+        void* p,
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    upstream_->deallocate(p, bytes, alignment);
+}
+
+void* HugePageMemoryResource::map_aligned_(
+        std::size_t)
+{
+    throw std::bad_alloc();
+}
+
+bool HugePageMemoryResource::bind_local_(
+        void*,
+        std::size_t) noexcept
+{
+    return false;
+}
+
+#endif // if defined(__linux__)
+
+bool HugePageMemoryResource::do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+bool HugePageMemoryResource::is_mapped_(
+        std::size_t bytes,
+        std::size_t alignment) const noexcept
+{
+    return is_supported() && bytes > 0 && bytes >= configuration_.minimum_size &&
+           alignment <= configuration_.huge_page_size;
+}
+
+std::size_t HugePageMemoryResource::mapping_size_(
+        std::size_t bytes) const noexcept
+{
+    std::size_t page = configuration_.huge_page_size;
+    return (bytes + page - 1) & ~(page - 1);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,36 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/pool/IPool.hpp>
+
+namespace eprosima {
+namespace utils {
+
+PoolConfiguration::PoolConfiguration(
+        unsigned int initial_size,
+        unsigned int maximum_size,
+        unsigned int batch_size) noexcept
+    : initial_size(initial_size)
+    , maximum_size(maximum_size)
+    , batch_size(batch_size)
+{
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
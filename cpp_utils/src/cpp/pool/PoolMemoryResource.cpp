@@ -0,0 +1,170 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolMemoryResource.cpp
+ *
+ */
+
+#include <new>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/pool/MagazinePool.hpp>
+#include <cpp_utils/pool/PoolMemoryResource.hpp>
+
+namespace eprosima {
+namespace utils {
+
+class PoolMemoryResource::ISizeClass
+{
+public:
+
+    virtual ~ISizeClass() = default;
+
+    virtual void* allocate() = 0;
+
+    virtual void deallocate(
+            void* p) = 0;
+};
+
+namespace {
+
+//! Size class of blocks of \c Size bytes over a \c MagazinePool .
+template <std::size_t Size>
+class SizeClass : public PoolMemoryResource::ISizeClass
+{
+public:
+
+    SizeClass(
+            PoolConfiguration configuration)
+        : pool_(configuration)
+    {
+    }
+
+    void* allocate() override
+    {
+        MemoryBlock<Size>* block;
+        if (!pool_.loan(block))
+        {
+            throw std::bad_alloc();
+        }
+        return block;
+    }
+
+    void deallocate(
+            void* p) override
+    {
+        pool_.return_loan(static_cast<MemoryBlock<Size>*>(p));
+    }
+
+protected:
+
+    MagazinePool<MemoryBlock<Size>> pool_;
+};
+
+template <std::size_t ... Index>
+std::array<std::unique_ptr<PoolMemoryResource::ISizeClass>, PoolMemoryResource::SIZE_CLASSES> create_size_classes(
+        PoolConfiguration configuration,
+        std::index_sequence<Index...>)
+{
+    return {{
+        std::unique_ptr<PoolMemoryResource::ISizeClass>(
+            new SizeClass<(PoolMemoryResource::MIN_BLOCK_SIZE << Index)>(configuration))...
+    }};
+}
+
+} /* namespace */
+
+PoolMemoryResource::PoolMemoryResource(
+        PoolConfiguration configuration /* = PoolConfiguration(0, 0, 16) */,
+        std::pmr::memory_resource* upstream /* = std::pmr::new_delete_resource() */)
+    : size_classes_(create_size_classes(configuration, std::make_index_sequence<SIZE_CLASSES>()))
+    , upstream_(upstream)
+{
+    logDebug(POOL_MEMORY_RESOURCE, "Created PoolMemoryResource [" << this << "].");
+}
+
+PoolMemoryResource::~PoolMemoryResource()
+{
+    logDebug(POOL_MEMORY_RESOURCE, "Destroying PoolMemoryResource [" << this << "].");
+}
+
+std::pmr::memory_resource* PoolMemoryResource::upstream_resource() const noexcept
+{
+    return upstream_;
+}
+
+std::size_t PoolMemoryResource::block_size(
+        std::size_t bytes,
+        std::size_t alignment /* = alignof(std::max_align_t) */) noexcept
+{
+    std::size_t index = size_class_index_(bytes, alignment);
+    return index == SIZE_CLASSES ? 0 : MIN_BLOCK_SIZE << index;
+}
+
+void* PoolMemoryResource::do_allocate(
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    std::size_t index = size_class_index_(bytes, alignment);
+    if (index == SIZE_CLASSES)
+    {
+        return upstream_->allocate(bytes, alignment);
+    }
+    return size_classes_[index]->allocate();
+}
+
+void PoolMemoryResource::do_deallocate(
+        void* p,
+        std::size_t bytes,
+        std::size_t alignment)
+{
+    // Same arguments as allocate, so the same size class is chosen
+    std::size_t index = size_class_index_(bytes, alignment);
+    if (index == SIZE_CLASSES)
+    {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+    }
+    size_classes_[index]->deallocate(p);
+}
+
+bool PoolMemoryResource::do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+std::size_t PoolMemoryResource::size_class_index_(
+        std::size_t bytes,
+        std::size_t alignment) noexcept
+{
+    if (bytes > MAX_BLOCK_SIZE || alignment > alignof(std::max_align_t))
+    {
+        return SIZE_CLASSES;
+    }
+
+    std::size_t index = 0;
+    std::size_t size = MIN_BLOCK_SIZE;
+    while (size < bytes)
+    {
+        size <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
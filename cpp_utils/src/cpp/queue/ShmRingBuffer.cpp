@@ -0,0 +1,497 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmRingBuffer.cpp
+ *
+ */
+
+#if defined(__linux__)
+    #include <climits>
+    #include <fcntl.h>
+    #include <linux/futex.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/UnsupportedException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/queue/ShmRingBuffer.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * @brief Layout of the beginning of the shared memory segment.
+ *
+ * Consumer and producer fields are in different cache lines, so each side only writes its own line.
+ */
+struct ShmRingHeader
+{
+    //! Identify the segment as a ring buffer and its layout.
+    uint64_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;
+
+    //! Set to 1 by the creator once every field is initialized.
+    std::atomic<uint32_t> initialized;
+
+    //! Index of the next record to read. Only written by the consumer.
+    alignas(64) std::atomic<uint64_t> head;
+    //! Futex word incremented every time records are consumed.
+    std::atomic<uint32_t> space_sequence;
+    //! Producers waiting for space.
+    std::atomic<uint32_t> producers_waiting;
+
+    //! Index of the next record to write. Only written by the producer.
+    alignas(64) std::atomic<uint64_t> tail;
+    //! Futex word incremented every time records are produced.
+    std::atomic<uint32_t> data_sequence;
+    //! Consumers waiting for data.
+    std::atomic<uint32_t> consumers_waiting;
+};
+
+namespace {
+
+constexpr uint64_t SHM_RING_MAGIC = 0x5152696e67536d65;  // "emSgniRQ"
+constexpr uint32_t SHM_RING_VERSION = 1;
+
+//! Time to wait for the creator of a segment to initialize it.
+constexpr Duration_ms SHM_RING_INITIALIZATION_TIMEOUT = 1000;
+
+//! Offset of the first record in the segment.
+constexpr std::size_t data_offset() noexcept
+{
+    return (sizeof(ShmRingHeader) + 63) / 64 * 64;
+}
+
+std::string segment_name(
+        const std::string& name)
+{
+    return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+#if defined(__linux__)
+
+void futex_wait(
+        std::atomic<uint32_t>& word,
+        uint32_t expected,
+        const utils::Timestamp& deadline) noexcept
+{
+    struct timespec timeout;
+    struct timespec* timeout_ptr = nullptr;
+    if (deadline != utils::the_end_of_time())
+    {
+        auto remaining = std::max(deadline - utils::now(), utils::Timestamp::duration::zero());
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+        timeout.tv_sec = static_cast<time_t>(seconds.count());
+        timeout.tv_nsec = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    remaining - seconds).count());
+        timeout_ptr = &timeout;
+    }
+
+    // Not private: the word is shared between processes
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, timeout_ptr, nullptr, 0);
+}
+
+void futex_wake_all(
+        std::atomic<uint32_t>& word) noexcept
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+void futex_wait(
+        std::atomic<uint32_t>&,
+        uint32_t,
+        const utils::Timestamp&) noexcept
+{
+}
+
+void futex_wake_all(
+        std::atomic<uint32_t>&) noexcept
+{
+}
+
+#endif // if defined(__linux__)
+
+utils::Timestamp deadline(
+        const utils::Duration_ms& timeout) noexcept
+{
+    return timeout > 0 ? utils::now() + utils::duration_to_ms(timeout) : utils::the_end_of_time();
+}
+
+} /* namespace */
+
+ShmRingBuffer::ShmRingBuffer(
+        const std::string& name,
+        uint32_t record_size,
+        uint64_t capacity,
+        bool enabled /* = true */)
+    : name_(segment_name(name))
+    , enabled_(enabled)
+{
+    if (record_size == 0 || capacity == 0)
+    {
+        throw utils::InitializationException("ShmRingBuffer requires a positive record size and capacity.");
+    }
+
+#if defined(__linux__)
+    mapped_size_ = data_offset() + record_size * capacity;
+
+    // The one that creates the segment initializes it
+    bool creator = true;
+    int fd = shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+    if (fd < 0 && errno == EEXIST)
+    {
+        creator = false;
+        fd = shm_open(name_.c_str(), O_RDWR, 0666);
+    }
+    if (fd < 0)
+    {
+        throw utils::InitializationException(
+                  STR_ENTRY << "Could not open shared memory segment " << name_ << ": " << std::strerror(errno) << ".");
+    }
+
+    if (creator)
+    {
+        if (ftruncate(fd, static_cast<off_t>(mapped_size_)) != 0)
+        {
+            close(fd);
+            shm_unlink(name_.c_str());
+            throw utils::InitializationException(
+                      STR_ENTRY << "Could not size shared memory segment " << name_ << ".");
+        }
+    }
+    else
+    {
+        // Wait until the creator has given the segment its size
+        utils::Timestamp limit = deadline(SHM_RING_INITIALIZATION_TIMEOUT);
+        struct stat segment_stat;
+        segment_stat.st_size = 0;
+        while (fstat(fd, &segment_stat) == 0 && segment_stat.st_size == 0 && utils::now() < limit)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (static_cast<std::size_t>(segment_stat.st_size) != mapped_size_)
+        {
+            close(fd);
+            throw utils::InitializationException(
+                      STR_ENTRY << "Shared memory segment " << name_ << " has " << segment_stat.st_size <<
+                          " bytes, expected " << mapped_size_ << ".");
+        }
+    }
+
+    void* segment = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        throw utils::InitializationException(
+                  STR_ENTRY << "Could not map shared memory segment " << name_ << ".");
+    }
+
+    header_ = static_cast<ShmRingHeader*>(segment);
+    data_ = static_cast<uint8_t*>(segment) + data_offset();
+
+    if (creator)
+    {
+        // ftruncate fills the segment with zeros, so atomics already hold their initial value
+        header_->magic = SHM_RING_MAGIC;
+        header_->version = SHM_RING_VERSION;
+        header_->record_size = record_size;
+        header_->capacity = capacity;
+        header_->initialized.store(1, std::memory_order_release);
+    }
+    else
+    {
+        utils::Timestamp limit = deadline(SHM_RING_INITIALIZATION_TIMEOUT);
+        while (header_->initialized.load(std::memory_order_acquire) == 0 && utils::now() < limit)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (header_->initialized.load(std::memory_order_acquire) == 0 ||
+                header_->magic != SHM_RING_MAGIC ||
+                header_->version != SHM_RING_VERSION ||
+                header_->record_size != record_size ||
+                header_->capacity != capacity)
+        {
+            munmap(segment, mapped_size_);
+            throw utils::InitializationException(
+                      STR_ENTRY << "Shared memory segment " << name_ << " is not a compatible ring buffer.");
+        }
+
+        // Indices are only published after a complete copy, so they must always be consistent
+        uint64_t head = header_->head.load();
+        uint64_t tail = header_->tail.load();
+        if (head > tail || tail - head > capacity)
+        {
+            munmap(segment, mapped_size_);
+            throw utils::InconsistencyException(
+                      STR_ENTRY << "Shared memory segment " << name_ << " has inconsistent indices.");
+        }
+
+        // Waiting counters from processes that crashed while waiting only cause extra wakeups
+    }
+
+    logDebug(UTILS_SHM_RING_BUFFER,
+            (creator ? "Created" : "Attached") << " shared memory ring buffer " << name_ <<
+            " with " << capacity << " records of " << record_size << " bytes.");
+#else
+    throw utils::UnsupportedException("ShmRingBuffer is only supported in Linux.");
+#endif // if defined(__linux__)
+}
+
+ShmRingBuffer::~ShmRingBuffer()
+{
+    blocking_disable();
+
+#if defined(__linux__)
+    if (header_ != nullptr)
+    {
+        munmap(header_, mapped_size_);
+    }
+#endif // if defined(__linux__)
+}
+
+void ShmRingBuffer::remove(
+        const std::string& name) noexcept
+{
+#if defined(__linux__)
+    shm_unlink(segment_name(name).c_str());
+#endif // if defined(__linux__)
+}
+
+void ShmRingBuffer::enable() noexcept
+{
+    enabled_.store(true);
+}
+
+void ShmRingBuffer::disable() noexcept
+{
+    enabled_.store(false);
+
+    // Waiters of other processes are also awaken, and they will go back to sleep
+    header_->data_sequence.fetch_add(1);
+    futex_wake_all(header_->data_sequence);
+    header_->space_sequence.fetch_add(1);
+    futex_wake_all(header_->space_sequence);
+}
+
+void ShmRingBuffer::blocking_disable() noexcept
+{
+    disable();
+
+    while (local_waiting_.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+bool ShmRingBuffer::enabled() const noexcept
+{
+    return enabled_.load();
+}
+
+uint32_t ShmRingBuffer::record_size() const noexcept
+{
+    return header_->record_size;
+}
+
+uint64_t ShmRingBuffer::capacity() const noexcept
+{
+    return header_->capacity;
+}
+
+uint64_t ShmRingBuffer::size() const noexcept
+{
+    uint64_t head = header_->head.load(std::memory_order_acquire);
+    return header_->tail.load(std::memory_order_acquire) - head;
+}
+
+AwakeReason ShmRingBuffer::write(
+        const void* record,
+        const utils::Duration_ms& timeout)
+{
+    utils::Timestamp limit = deadline(timeout);
+
+    std::unique_lock<std::timed_mutex> lock(write_mutex_, limit);
+    if (!lock.owns_lock())
+    {
+        return AwakeReason::timeout;
+    }
+
+    // Only this thread writes the tail
+    uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+
+    AwakeReason reason = wait_(
+        header_->space_sequence,
+        header_->producers_waiting,
+        limit,
+        [this, tail]()
+        {
+            return tail - header_->head.load(std::memory_order_acquire) < header_->capacity;
+        });
+    if (reason != AwakeReason::condition_met)
+    {
+        return reason;
+    }
+
+    std::memcpy(record_(tail), record, header_->record_size);
+
+    // Publish the record once it is completely copied
+    header_->tail.store(tail + 1, std::memory_order_seq_cst);
+    notify_(header_->data_sequence, header_->consumers_waiting);
+
+    return AwakeReason::condition_met;
+}
+
+AwakeReason ShmRingBuffer::read(
+        void* records,
+        uint64_t max_records,
+        const utils::Duration_ms& timeout,
+        uint64_t& records_read)
+{
+    records_read = 0;
+    utils::Timestamp limit = deadline(timeout);
+
+    std::unique_lock<std::timed_mutex> lock(read_mutex_, limit);
+    if (!lock.owns_lock())
+    {
+        return AwakeReason::timeout;
+    }
+
+    // Only this thread writes the head
+    uint64_t head = header_->head.load(std::memory_order_relaxed);
+
+    AwakeReason reason = wait_(
+        header_->data_sequence,
+        header_->consumers_waiting,
+        limit,
+        [this, head]()
+        {
+            return header_->tail.load(std::memory_order_acquire) != head;
+        });
+    if (reason != AwakeReason::condition_met)
+    {
+        return reason;
+    }
+
+    uint64_t available = header_->tail.load(std::memory_order_acquire) - head;
+    records_read = std::min(available, max_records);
+
+    // Copy in at most two chunks, as records could wrap around the end of the ring
+    const uint64_t capacity = header_->capacity;
+    const uint32_t size = header_->record_size;
+    uint64_t first_chunk = std::min(records_read, capacity - head % capacity);
+    std::memcpy(records, record_(head), first_chunk * size);
+    std::memcpy(
+        static_cast<uint8_t*>(records) + first_chunk * size,
+        data_,
+        (records_read - first_chunk) * size);
+
+    // Release the records once they are completely copied
+    header_->head.store(head + records_read, std::memory_order_seq_cst);
+    notify_(header_->space_sequence, header_->producers_waiting);
+
+    return AwakeReason::condition_met;
+}
+
+AwakeReason ShmRingBuffer::wait_empty(
+        const utils::Duration_ms& timeout)
+{
+    return wait_(
+        header_->space_sequence,
+        header_->producers_waiting,
+        deadline(timeout),
+        [this]()
+        {
+            return size() == 0;
+        });
+}
+
+template <typename Ready>
+AwakeReason ShmRingBuffer::wait_(
+        std::atomic<uint32_t>& sequence,
+        std::atomic<uint32_t>& waiting,
+        const utils::Timestamp& deadline,
+        Ready ready)
+{
+    while (true)
+    {
+        if (!enabled_.load())
+        {
+            return AwakeReason::disabled;
+        }
+
+        if (ready())
+        {
+            return AwakeReason::condition_met;
+        }
+
+        if (utils::now() >= deadline)
+        {
+            return AwakeReason::timeout;
+        }
+
+        // Announce the wait before checking again, so the other side either sees it or this thread sees the change
+        local_waiting_++;
+        waiting.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t current_sequence = sequence.load(std::memory_order_seq_cst);
+
+        if (enabled_.load() && !ready())
+        {
+            futex_wait(sequence, current_sequence, deadline);
+        }
+
+        waiting.fetch_sub(1, std::memory_order_seq_cst);
+        local_waiting_--;
+    }
+}
+
+void ShmRingBuffer::notify_(
+        std::atomic<uint32_t>& sequence,
+        const std::atomic<uint32_t>& waiting) noexcept
+{
+    sequence.fetch_add(1, std::memory_order_seq_cst);
+    if (waiting.load(std::memory_order_seq_cst) > 0)
+    {
+        futex_wake_all(sequence);
+    }
+}
+
+uint8_t* ShmRingBuffer::record_(
+        uint64_t index) const noexcept
+{
+    return data_ + (index % header_->capacity) * header_->record_size;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
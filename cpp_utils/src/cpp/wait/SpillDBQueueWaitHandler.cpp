@@ -0,0 +1,53 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SpillDBQueueWaitHandler.cpp
+ *
+ */
+
+#include <cpp_utils/wait/SpillDBQueueWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+namespace {
+
+double bytes_per_second(
+        uint64_t bytes,
+        const std::chrono::nanoseconds& time) noexcept
+{
+    if (time.count() <= 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(bytes) / std::chrono::duration<double>(time).count();
+}
+
+} /* namespace */
+
+double SpillStatistics::spill_throughput() const noexcept
+{
+    return bytes_per_second(spilled_bytes, spill_time);
+}
+
+double SpillStatistics::replay_throughput() const noexcept
+{
+    return bytes_per_second(replayed_bytes, replay_time);
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
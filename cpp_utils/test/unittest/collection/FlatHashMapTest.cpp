@@ -0,0 +1,210 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <cpp_utils/collection/FlatHashMap.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Hash that sends every key to the same group, to force long probe sequences.
+struct ConstantHash
+{
+    std::size_t operator ()(
+            int) const
+    {
+        return 0;
+    }
+
+};
+
+} // namespace test
+
+/**
+ * Check insert, find, at, count and erase, growing the map.
+ */
+TEST(FlatHashMapTest, basic_operations)
+{
+    FlatHashMap<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.capacity(), 0u);
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_EQ(map.begin(), map.end());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto result = map.insert({i, std::to_string(i)});
+        ASSERT_TRUE(result.second);
+        ASSERT_EQ(result.first->first, i);
+    }
+    EXPECT_EQ(map.size(), 1000u);
+    EXPECT_GE(map.capacity() * 7, map.size() * 8);
+
+    auto repeated = map.insert({5, "repeated"});
+    EXPECT_FALSE(repeated.second);
+    EXPECT_EQ(repeated.first->second, "5");
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(map.at(i), std::to_string(i));
+        ASSERT_EQ(map.count(i), 1u);
+    }
+    EXPECT_EQ(map.count(1000), 0u);
+    EXPECT_THROW(map.at(1000), std::out_of_range);
+
+    map.find(3)->second = "three";
+    EXPECT_EQ(map.at(3), "three");
+
+    EXPECT_EQ(map.erase(3), 1u);
+    EXPECT_EQ(map.erase(3), 0u);
+    EXPECT_EQ(map.find(3), map.end());
+    EXPECT_EQ(map.size(), 999u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(4), map.end());
+}
+
+/**
+ * Check iteration, and erasing while iterating.
+ */
+TEST(FlatHashMapTest, iterate)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+    {
+        map.insert({i, i * 10});
+    }
+
+    int count = 0;
+    int sum = 0;
+    for (const auto& it : map)
+    {
+        EXPECT_EQ(it.second, it.first * 10);
+        sum += it.first;
+        count++;
+    }
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(sum, 4950);
+
+    // Erase odd keys while iterating
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (it->first % 2 == 1)
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    EXPECT_EQ(map.size(), 50u);
+    for (const auto& it : map)
+    {
+        EXPECT_EQ(it.first % 2, 0);
+    }
+}
+
+/**
+ * Check random operations against std::map, with a hash that makes every key collide.
+ */
+TEST(FlatHashMapTest, compare_with_map)
+{
+    FlatHashMap<int, int> flat;
+    FlatHashMap<int, int, test::ConstantHash> colliding;
+    std::map<int, int> reference;
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> keys(0, 300);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int key = keys(generator);
+        if (i % 3 == 0)
+        {
+            std::size_t erased = reference.erase(key);
+            ASSERT_EQ(flat.erase(key), erased);
+            ASSERT_EQ(colliding.erase(key), erased);
+        }
+        else
+        {
+            bool inserted = reference.insert({key, i}).second;
+            ASSERT_EQ(flat.insert({key, i}).second, inserted);
+            ASSERT_EQ(colliding.insert({key, i}).second, inserted);
+        }
+        ASSERT_EQ(flat.size(), reference.size());
+        ASSERT_EQ(colliding.size(), reference.size());
+    }
+
+    for (const auto& it : reference)
+    {
+        ASSERT_EQ(flat.at(it.first), it.second);
+        ASSERT_EQ(colliding.at(it.first), it.second);
+    }
+
+    // Copies and moves keep every element
+    FlatHashMap<int, int> copy(flat);
+    FlatHashMap<int, int> moved(std::move(flat));
+    EXPECT_EQ(copy.size(), reference.size());
+    EXPECT_EQ(moved.size(), reference.size());
+    for (const auto& it : reference)
+    {
+        ASSERT_EQ(copy.at(it.first), it.second);
+        ASSERT_EQ(moved.at(it.first), it.second);
+    }
+}
+
+/**
+ * Check that non copyable values are moved when the map grows, and destroyed with the map.
+ */
+TEST(FlatHashMapTest, move_only_values)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        FlatHashMap<std::string, std::shared_ptr<int>> shared;
+        FlatHashMap<int, std::unique_ptr<int>> map(4);
+        for (int i = 0; i < 200; ++i)
+        {
+            map.insert({i, std::make_unique<int>(i)});
+            shared.insert({std::to_string(i), counter});
+        }
+        EXPECT_EQ(counter.use_count(), 201);
+
+        for (int i = 0; i < 200; ++i)
+        {
+            ASSERT_EQ(*map.at(i), i);
+        }
+
+        shared.erase("0");
+        EXPECT_EQ(counter.use_count(), 200);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,312 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/CacheSafeDatabase.hpp>
+#include <cpp_utils/exception/ConfigurationException.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+using Cache = CacheSafeDatabase<int, std::string>;
+
+//! Configuration with a fine grained timing wheel.
+CacheConfiguration configuration(
+        Duration_ms default_ttl = 0,
+        std::size_t wheel_slots = 64)
+{
+    CacheConfiguration configuration;
+    configuration.default_ttl = default_ttl;
+    configuration.wheel_resolution = 10;
+    configuration.wheel_slots = wheel_slots;
+    return configuration;
+}
+
+} /* namespace test */
+
+/**
+ * Check the operations of the cache without expiration nor limits.
+ *
+ * CASES:
+ * - add, add_or_modify and erase
+ * - is does not count as an access
+ * - at and read count hits and misses
+ * - invalid configuration
+ */
+TEST(CacheSafeDatabaseTest, basic_operations)
+{
+    test::Cache cache(test::configuration());
+
+    EXPECT_TRUE(cache.add(1, "one"));
+    EXPECT_FALSE(cache.add(1, "uno"));
+    EXPECT_TRUE(cache.add_or_modify(2, "two"));
+    EXPECT_FALSE(cache.add_or_modify(2, "dos"));
+    EXPECT_EQ(cache.size(), 2u);
+
+    EXPECT_TRUE(cache.is(1));
+    EXPECT_FALSE(cache.is(3));
+    EXPECT_EQ(cache.statistics().hits, 0u);
+
+    EXPECT_EQ(cache.at(1), "one");
+    EXPECT_EQ(cache.at(2), "dos");
+    EXPECT_THROW(cache.at(3), std::out_of_range);
+
+    std::string read;
+    EXPECT_TRUE(cache.read(2, [&read](const std::string& value)
+            {
+                read = value;
+            }));
+    EXPECT_EQ(read, "dos");
+    EXPECT_FALSE(cache.read(3, [](const std::string&)
+            {
+            }));
+
+    EXPECT_TRUE(cache.erase(1));
+    EXPECT_FALSE(cache.erase(1));
+    EXPECT_FALSE(cache.is(1));
+    EXPECT_EQ(cache.size(), 1u);
+
+    CacheStatistics statistics = cache.statistics();
+    EXPECT_EQ(statistics.hits, 3u);
+    EXPECT_EQ(statistics.misses, 2u);
+    EXPECT_EQ(statistics.evictions, 0u);
+    EXPECT_EQ(statistics.expirations, 0u);
+
+    CacheConfiguration invalid = test::configuration();
+    invalid.wheel_slots = 0;
+    EXPECT_THROW(test::Cache{invalid}, ConfigurationException);
+}
+
+/**
+ * Check that entries expire after their time to live, and the timing wheel removes them.
+ *
+ * CASES:
+ * - Default time to live
+ * - Specific time to live, and entries that never expire
+ * - Expired entries are not read, and could be added again
+ */
+TEST(CacheSafeDatabaseTest, expiration)
+{
+    test::Cache cache(test::configuration(50));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        cache.add(i, std::to_string(i));
+    }
+    cache.add(100, "long", 10000);
+    cache.add(101, "forever", 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_FALSE(cache.is(0));
+    EXPECT_THROW(cache.at(5), std::out_of_range);
+    EXPECT_EQ(cache.at(100), "long");
+    EXPECT_EQ(cache.at(101), "forever");
+
+    // Still stored until the wheel advances
+    EXPECT_EQ(cache.size(), 12u);
+    EXPECT_EQ(cache.expire(), 10u);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.statistics().expirations, 10u);
+
+    EXPECT_TRUE(cache.add(0, "again"));
+    EXPECT_EQ(cache.at(0), "again");
+}
+
+/**
+ * Check that entries expiring further than one turn of the wheel are kept until their turn.
+ */
+TEST(CacheSafeDatabaseTest, wheel_turns)
+{
+    // One turn of the wheel is 40ms
+    test::Cache cache(test::configuration(0, 4));
+
+    cache.add(1, "short", 20);
+    cache.add(2, "long", 300);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(cache.expire(), 1u);
+    EXPECT_TRUE(cache.is(2));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_FALSE(cache.is(2));
+    EXPECT_EQ(cache.expire(), 1u);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+/**
+ * Check that the entries read recently are spared when the cache is full.
+ */
+TEST(CacheSafeDatabaseTest, max_entries)
+{
+    CacheConfiguration configuration = test::configuration();
+    configuration.max_entries = 10;
+    test::Cache cache(configuration);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        cache.add(i, std::to_string(i));
+    }
+
+    // Every entry starts referenced, so the first one is evicted after a whole turn
+    cache.add(10, "10");
+    EXPECT_FALSE(cache.is(0));
+    EXPECT_EQ(cache.size(), 10u);
+
+    for (int i = 1; i < 5; ++i)
+    {
+        cache.at(i);
+    }
+    for (int i = 11; i < 15; ++i)
+    {
+        cache.add(i, std::to_string(i));
+    }
+
+    for (int i = 1; i < 5; ++i)
+    {
+        EXPECT_TRUE(cache.is(i));
+    }
+    EXPECT_EQ(cache.size(), 10u);
+    EXPECT_EQ(cache.statistics().evictions, 5u);
+}
+
+/**
+ * Check that entries are evicted to keep the cache under its byte budget.
+ */
+TEST(CacheSafeDatabaseTest, max_bytes)
+{
+    CacheConfiguration configuration = test::configuration();
+    configuration.max_bytes = 100;
+    test::Cache cache(
+        configuration,
+        [](const int&, const std::string& value)
+        {
+            return value.size();
+        });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        cache.add(i, std::string(30, 'a'));
+        EXPECT_LE(cache.bytes(), 100u);
+    }
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_EQ(cache.statistics().evictions, 7u);
+
+    // Larger than the budget: stored alone
+    cache.add(100, std::string(150, 'b'));
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.bytes(), 150u);
+}
+
+/**
+ * Check concurrent readers and writers, with expiration and eviction.
+ */
+TEST(CacheSafeDatabaseTest, concurrent_access)
+{
+    CacheConfiguration configuration = test::configuration(20);
+    configuration.max_entries = 64;
+    test::Cache cache(configuration);
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, &stop, t]()
+                {
+                    int i = 0;
+                    while (!stop.load())
+                    {
+                        cache.add_or_modify((t * 1000 + i) % 128, std::to_string(i));
+                        i++;
+                    }
+                });
+        threads.emplace_back([&cache, &stop]()
+                {
+                    int i = 0;
+                    while (!stop.load())
+                    {
+                        cache.read(i % 128, [](const std::string& value)
+                        {
+                            ASSERT_FALSE(value.empty());
+                        });
+                        i++;
+                    }
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(cache.size(), 64u);
+    CacheStatistics statistics = cache.statistics();
+    EXPECT_GT(statistics.hits + statistics.misses, 0u);
+}
+
+/**
+ * Check that the hits and misses of concurrent readers are all counted.
+ */
+TEST(CacheSafeDatabaseTest, concurrent_statistics)
+{
+    test::Cache cache(test::configuration(0));
+    for (int i = 0; i < 10; ++i)
+    {
+        cache.add(i, std::to_string(i));
+    }
+
+    constexpr int THREADS = 8;
+    constexpr int READS = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&cache]()
+                {
+                    for (int i = 0; i < READS; ++i)
+                    {
+                        // Keys 0..9 hit, 10..19 miss
+                        cache.read(i % 20, [](const std::string&)
+                        {
+                        });
+                    }
+                });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CacheStatistics statistics = cache.statistics();
+    EXPECT_EQ(statistics.hits, THREADS * READS / 2u);
+    EXPECT_EQ(statistics.misses, THREADS * READS / 2u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,305 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/IndexedSafeDatabase.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+struct Endpoint
+{
+    std::string topic;
+    int participant;
+};
+
+using Database = IndexedSafeDatabase<int, Endpoint>;
+
+//! Keys of \c elements , in order.
+std::vector<int> keys(
+        const std::vector<std::pair<int, Endpoint>>& elements)
+{
+    std::vector<int> result;
+    for (const auto& it : elements)
+    {
+        result.push_back(it.first);
+    }
+    return result;
+}
+
+//! Keys of the elements of \c database with topic \c topic , scanning it.
+std::vector<int> scan_topic(
+        const Database& database,
+        const std::string& topic)
+{
+    std::vector<int> result;
+    database.for_each([&result, &topic](const int& key, const Endpoint& endpoint)
+            {
+                if (endpoint.topic == topic)
+                {
+                    result.push_back(key);
+                }
+            });
+    return result;
+}
+
+} /* namespace test */
+
+/**
+ * Check looking for elements by secondary indexes.
+ *
+ * CASES:
+ * - Index declared before and after adding elements
+ * - Index extracted from the key
+ * - find_by, count_by and for_each_by
+ * - Index key not present
+ */
+TEST(IndexedSafeDatabaseTest, find_by_index)
+{
+    test::Database database;
+    auto by_topic = database.add_index<std::string>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.topic;
+                    });
+
+    for (int i = 0; i < 30; ++i)
+    {
+        database.add(i, test::Endpoint{"topic_" + std::to_string(i % 3), i / 10});
+    }
+
+    auto by_participant = database.add_index<int>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.participant;
+                    });
+    auto by_parity = database.add_index<bool>([](const int& key, const test::Endpoint&)
+                    {
+                        return key % 2 == 0;
+                    });
+
+    auto topic_1 = database.find_by(by_topic, "topic_1");
+    EXPECT_EQ(topic_1.size(), 10u);
+    EXPECT_EQ(test::keys(topic_1), test::scan_topic(database, "topic_1"));
+    for (const auto& it : topic_1)
+    {
+        EXPECT_EQ(it.second.topic, "topic_1");
+    }
+
+    EXPECT_EQ(database.count_by(by_participant, 2), 10u);
+    EXPECT_EQ(database.count_by(by_parity, true), 15u);
+    EXPECT_EQ(database.count_by(by_topic, "unknown"), 0u);
+    EXPECT_TRUE(database.find_by(by_participant, 7).empty());
+
+    int visited = 0;
+    database.for_each_by(by_participant, 0, [&visited](const int& key, const test::Endpoint& endpoint)
+            {
+                EXPECT_LT(key, 10);
+                EXPECT_EQ(endpoint.participant, 0);
+                visited++;
+            });
+    EXPECT_EQ(visited, 10);
+}
+
+/**
+ * Check that every write keeps the indexes consistent with the content.
+ */
+TEST(IndexedSafeDatabaseTest, indexes_follow_writes)
+{
+    test::Database database;
+    auto by_topic = database.add_index<std::string>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.topic;
+                    });
+
+    for (int i = 0; i < 20; ++i)
+    {
+        database.add(i, test::Endpoint{"a", i});
+    }
+
+    database.modify(0, test::Endpoint{"b", 0});
+    database.add_or_modify(1, test::Endpoint{"b", 1});
+    database.add_or_modify(100, test::Endpoint{"b", 100});
+    database.erase(2);
+    database.add_batch({{200, test::Endpoint{"c", 200}}, {3, test::Endpoint{"c", 3}}});
+    database.erase_if([](const int& key, const test::Endpoint&)
+            {
+                return key >= 15 && key < 20;
+            });
+    database.modify_if(
+        [](const int& key, const test::Endpoint&)
+        {
+            return key == 4 || key == 5;
+        },
+        [](const int&, test::Endpoint& endpoint)
+        {
+            endpoint.topic = "c";
+        });
+    database.extract_if([](const int& key, const test::Endpoint&)
+            {
+                return key == 6;
+            });
+
+    for (const std::string topic : {"a", "b", "c"})
+    {
+        EXPECT_EQ(test::keys(database.find_by(by_topic, topic)), test::scan_topic(database, topic));
+    }
+    EXPECT_EQ(test::keys(database.find_by(by_topic, "b")), (std::vector<int>{0, 1, 100}));
+    EXPECT_EQ(test::keys(database.find_by(by_topic, "c")), (std::vector<int>{4, 5, 200}));
+    EXPECT_EQ(database.count_by(by_topic, "a"), 9u);
+}
+
+/**
+ * Check range queries over an index.
+ */
+TEST(IndexedSafeDatabaseTest, range_queries)
+{
+    test::Database database;
+    auto by_participant = database.add_index<int>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.participant;
+                    });
+
+    for (int i = 0; i < 50; ++i)
+    {
+        database.add(i, test::Endpoint{"topic", i % 10});
+    }
+
+    auto range = database.find_by(by_participant, 3, 5);
+    EXPECT_EQ(range.size(), 10u);
+    for (std::size_t i = 0; i < range.size(); ++i)
+    {
+        // Sorted by index key, then by key
+        EXPECT_EQ(range[i].second.participant, i < 5 ? 3 : 4);
+    }
+
+    EXPECT_EQ(database.find_by(by_participant, 0, 10).size(), 50u);
+    EXPECT_TRUE(database.find_by(by_participant, 5, 5).empty());
+    EXPECT_TRUE(database.find_by(by_participant, 7, 3).empty());
+}
+
+/**
+ * Check that indexes are updated when writing through the base class, and that foreign indexes are rejected.
+ */
+TEST(IndexedSafeDatabaseTest, base_class_and_foreign_indexes)
+{
+    test::Database database;
+    auto by_topic = database.add_index<std::string>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.topic;
+                    });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        database.add(i, test::Endpoint{"a", i});
+    }
+
+    SafeDatabase<int, test::Endpoint>& base = database;
+    base.erase_if([](const int& key, const test::Endpoint&)
+            {
+                return key < 5;
+            });
+    EXPECT_EQ(test::keys(database.find_by(by_topic, "a")), (std::vector<int>{5, 6, 7, 8, 9}));
+
+    test::Database other;
+    auto foreign = other.add_index<std::string>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.topic;
+                    });
+    other.add(100, test::Endpoint{"a", 100});
+
+    EXPECT_THROW(database.find_by(foreign, "a"), PreconditionNotMet);
+    EXPECT_THROW(database.find_by(foreign, "a", "b"), PreconditionNotMet);
+    EXPECT_THROW(database.count_by(foreign, "a"), PreconditionNotMet);
+    EXPECT_THROW(database.for_each_by(foreign, "a", [](const int&, const test::Endpoint&)
+            {
+            }), PreconditionNotMet);
+}
+
+/**
+ * Check that readers always get consistent results while writers move elements between index keys.
+ */
+TEST(IndexedSafeDatabaseTest, concurrent_access)
+{
+    test::Database database;
+    auto by_topic = database.add_index<std::string>([](const int&, const test::Endpoint& endpoint)
+                    {
+                        return endpoint.topic;
+                    });
+
+    for (int i = 0; i < 100; ++i)
+    {
+        database.add(i, test::Endpoint{"topic_" + std::to_string(i % 4), i});
+    }
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back([&database, &stop, t]()
+                {
+                    int i = 0;
+                    while (!stop.load())
+                    {
+                        int key = (i * 7 + t) % 100;
+                        database.modify(key, test::Endpoint{"topic_" + std::to_string(i % 4), key});
+                        i++;
+                    }
+                });
+    }
+    for (int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back([&database, &stop, &by_topic]()
+                {
+                    int i = 0;
+                    while (!stop.load())
+                    {
+                        std::string topic = "topic_" + std::to_string(i % 4);
+                        for (const auto& it : database.find_by(by_topic, topic))
+                        {
+                            ASSERT_EQ(it.second.topic, topic);
+                        }
+                        i++;
+                    }
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    unsigned int total = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        total += database.count_by(by_topic, "topic_" + std::to_string(i));
+    }
+    EXPECT_EQ(total, 100u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,258 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/MvccSafeDatabase.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+using Database = MvccSafeDatabase<int, std::string>;
+
+//! Elements of \c snapshot , in order.
+std::vector<std::pair<int, std::string>> elements(
+        const MvccSnapshot<int, std::string>& snapshot)
+{
+    std::vector<std::pair<int, std::string>> result;
+    snapshot.for_each([&result](const int& key, const std::string& value)
+            {
+                result.emplace_back(key, value);
+            });
+    return result;
+}
+
+} /* namespace test */
+
+/**
+ * Check the operations on the current version of the database.
+ *
+ * CASES:
+ * - add, modify, add_or_modify and erase
+ * - Add again an erased key
+ * - Versions stored without snapshots
+ */
+TEST(MvccSafeDatabaseTest, basic_operations)
+{
+    test::Database database;
+    EXPECT_EQ(database.version(), 0u);
+
+    EXPECT_TRUE(database.add(1, "one"));
+    EXPECT_FALSE(database.add(1, "uno"));
+    EXPECT_TRUE(database.modify(1, "uno"));
+    EXPECT_FALSE(database.modify(2, "two"));
+    EXPECT_TRUE(database.add_or_modify(2, "two"));
+    EXPECT_FALSE(database.add_or_modify(2, "dos"));
+    EXPECT_EQ(database.size(), 2u);
+    EXPECT_EQ(database.version(), 4u);
+
+    EXPECT_EQ(database.at(1), "uno");
+    EXPECT_EQ(database.at(2), "dos");
+    EXPECT_THROW(database.at(3), std::out_of_range);
+
+    EXPECT_TRUE(database.erase(1));
+    EXPECT_FALSE(database.erase(1));
+    EXPECT_FALSE(database.is(1));
+    EXPECT_THROW(database.at(1), std::out_of_range);
+    EXPECT_TRUE(database.add(1, "one again"));
+    EXPECT_EQ(database.at(1), "one again");
+    EXPECT_EQ(database.size(), 2u);
+
+    // Without snapshots, only the last version of each key is kept
+    EXPECT_TRUE(database.erase(2));
+    EXPECT_EQ(database.version_count(), 1u);
+}
+
+/**
+ * Check that a snapshot always sees the content of the version it was opened at.
+ *
+ * CASES:
+ * - Keys added, modified and erased after the snapshot
+ * - Several snapshots at different versions
+ * - Moved snapshot
+ */
+TEST(MvccSafeDatabaseTest, snapshot_isolation)
+{
+    test::Database database;
+    for (int i = 0; i < 10; ++i)
+    {
+        database.add(i, std::to_string(i));
+    }
+
+    auto first = database.snapshot();
+    auto expected = test::elements(first);
+    EXPECT_EQ(expected.size(), 10u);
+    EXPECT_EQ(first.version(), 10u);
+
+    database.modify(0, "modified");
+    database.erase(1);
+    database.add(100, "new");
+
+    auto second = database.snapshot();
+
+    database.erase(0);
+    database.add(1, "back");
+
+    EXPECT_EQ(test::elements(first), expected);
+    EXPECT_EQ(first.size(), 10u);
+    EXPECT_EQ(first.at(0), "0");
+    EXPECT_EQ(*first.get(1), "1");
+    EXPECT_FALSE(first.is(100));
+    EXPECT_THROW(first.at(100), std::out_of_range);
+
+    EXPECT_EQ(second.at(0), "modified");
+    EXPECT_FALSE(second.is(1));
+    EXPECT_EQ(second.at(100), "new");
+    EXPECT_EQ(second.size(), 10u);
+
+    EXPECT_FALSE(database.is(0));
+    EXPECT_EQ(database.at(1), "back");
+
+    auto moved = std::move(first);
+    EXPECT_EQ(test::elements(moved), expected);
+}
+
+/**
+ * Check that old versions are collected once no snapshot could see them.
+ *
+ * CASES:
+ * - Writes collect the versions of their key
+ * - Releasing a snapshot collects the versions only it needed
+ * - collect_garbage with a snapshot open
+ */
+TEST(MvccSafeDatabaseTest, garbage_collection)
+{
+    test::Database database;
+    for (int i = 0; i < 10; ++i)
+    {
+        database.add(i, std::to_string(i));
+    }
+
+    {
+        auto snapshot = database.snapshot();
+        for (int i = 0; i < 10; ++i)
+        {
+            database.modify(i, "a");
+            database.modify(i, "b");
+        }
+        database.erase(0);
+
+        // The version seen by the snapshot and the last one of each key (the erasure for 0)
+        EXPECT_EQ(database.version_count(), 20u);
+        EXPECT_EQ(database.collect_garbage(), 0u);
+    }
+
+    EXPECT_EQ(database.version_count(), 9u);
+    EXPECT_EQ(database.size(), 9u);
+
+    auto old_snapshot = database.snapshot();
+    database.modify(1, "c");
+    auto new_snapshot = database.snapshot();
+    database.modify(1, "d");
+    database.modify(1, "e");
+
+    // Each snapshot keeps the version it sees
+    EXPECT_EQ(database.version_count(), 11u);
+    EXPECT_EQ(old_snapshot.at(1), "b");
+    EXPECT_EQ(new_snapshot.at(1), "c");
+    EXPECT_EQ(database.at(1), "e");
+}
+
+/**
+ * Check that long scans see a consistent version while writers keep writing, and are not blocked by them.
+ */
+TEST(MvccSafeDatabaseTest, concurrent_scans)
+{
+    test::Database database;
+    constexpr int ELEMENTS = 500;
+    for (int i = 0; i < ELEMENTS; ++i)
+    {
+        database.add(i, "0");
+    }
+
+    std::atomic<bool> stop(false);
+    std::atomic<unsigned int> scans(0);
+    std::atomic<unsigned int> writes(0);
+    std::vector<std::thread> threads;
+
+    // Each write moves a unit from one key to another, so every consistent version has the same total
+    threads.emplace_back([&database, &stop, &writes]()
+            {
+                int i = 0;
+                while (!stop.load())
+                {
+                    int from = (i * 7) % ELEMENTS;
+                    int to = (i * 13 + 1) % ELEMENTS;
+                    database.add_or_modify(from, std::to_string(std::stoi(database.at(from)) - 1));
+                    database.add_or_modify(to, std::to_string(std::stoi(database.at(to)) + 1));
+                    database.erase(ELEMENTS + i % 10);
+                    database.add(ELEMENTS + (i + 1) % 10, "0");
+                    writes++;
+                    i++;
+                }
+            });
+    for (int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back([&database, &stop, &scans]()
+                {
+                    while (!stop.load())
+                    {
+                        auto snapshot = database.snapshot();
+                        int total = 0;
+                        unsigned int count = 0;
+                        snapshot.for_each([&total, &count](const int&, const std::string& value)
+                        {
+                            total += std::stoi(value);
+                            count++;
+                        });
+
+                        // Only the first half of a move could be seen, never a torn version
+                        ASSERT_TRUE(total == 0 || total == -1);
+                        ASSERT_GE(count, static_cast<unsigned int>(ELEMENTS));
+                        ASSERT_LE(count, static_cast<unsigned int>(ELEMENTS + 1));
+                        scans++;
+                    }
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    stop.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_GT(scans.load(), 0u);
+    EXPECT_GT(writes.load(), 0u);
+
+    // Every snapshot is released, so only the last version of each key is kept
+    database.collect_garbage();
+    EXPECT_EQ(database.version_count(), database.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,264 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/ObservableSafeDatabase.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+using Change = DatabaseChange<int, std::string>;
+
+//! Listener that stores every batch received.
+struct Recorder
+{
+    void operator ()(
+            const std::vector<Change>& changes)
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        batches.push_back(changes);
+    }
+
+    //! Every change received, in order.
+    std::vector<Change> changes()
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        std::vector<Change> result;
+        for (const auto& batch : batches)
+        {
+            result.insert(result.end(), batch.begin(), batch.end());
+        }
+        return result;
+    }
+
+    std::mutex mutex;
+    std::vector<std::vector<Change>> batches;
+};
+
+//! Wait until \c recorder has received \c count changes, or 5 seconds.
+void wait_changes(
+        Recorder& recorder,
+        std::size_t count)
+{
+    for (int i = 0; i < 500 && recorder.changes().size() < count; ++i)
+    {
+        sleep_for(10);
+    }
+}
+
+} // namespace test
+
+/**
+ * Check that every kind of write is notified synchronously, and batch operations in one batch.
+ */
+TEST(ObservableSafeDatabaseTest, synchronous_notifications)
+{
+    ObservableSafeDatabase<int, std::string> db;
+    test::Recorder recorder;
+
+    // Changes before subscribing are not notified
+    db.add(0, std::string("zero"));
+
+    auto id = db.subscribe([&recorder](const std::vector<test::Change>& changes)
+                    {
+                        recorder(changes);
+                    });
+
+    ASSERT_TRUE(db.add(1, std::string("one")));
+    ASSERT_FALSE(db.add(1, std::string("repeated")));
+    ASSERT_TRUE(db.modify(1, "uno"));
+    ASSERT_FALSE(db.add_or_modify(1, std::string("one")));
+    ASSERT_TRUE(db.add_or_modify(2, std::string("two")));
+    ASSERT_TRUE(db.erase(2));
+    ASSERT_FALSE(db.erase(2));
+
+    // Delivered before returning, one batch per write
+    auto changes = recorder.changes();
+    ASSERT_EQ(recorder.batches.size(), 5u);
+    ASSERT_EQ(changes.size(), 5u);
+    EXPECT_EQ(changes[0].kind, DatabaseChangeKind::added);
+    EXPECT_EQ(changes[0].value, "one");
+    EXPECT_EQ(changes[1].kind, DatabaseChangeKind::modified);
+    EXPECT_EQ(changes[1].value, "uno");
+    EXPECT_EQ(changes[2].kind, DatabaseChangeKind::modified);
+    EXPECT_EQ(changes[3].kind, DatabaseChangeKind::added);
+    EXPECT_EQ(changes[3].key, 2);
+    EXPECT_EQ(changes[4].kind, DatabaseChangeKind::erased);
+    EXPECT_EQ(changes[4].key, 2);
+    EXPECT_EQ(changes[4].value, "two");
+
+    // Batch operations
+    std::vector<std::pair<int, std::string>> values;
+    for (int i = 10; i < 20; ++i)
+    {
+        values.emplace_back(i, std::to_string(i));
+    }
+    ASSERT_EQ(db.add_batch(std::move(values)), 10u);
+    ASSERT_EQ(recorder.batches.back().size(), 10u);
+
+    db.modify_if(
+        [](const int& key, const std::string&)
+        {
+            return key >= 15;
+        },
+        [](const int&, std::string& value)
+        {
+            value = "big";
+        });
+    ASSERT_EQ(recorder.batches.back().size(), 5u);
+    EXPECT_EQ(recorder.batches.back()[0].kind, DatabaseChangeKind::modified);
+    EXPECT_EQ(recorder.batches.back()[0].value, "big");
+
+    // Also notified when called through the base class
+    SafeDatabase<int, std::string>& base = db;
+    base.erase_if(
+        [](const int& key, const std::string&)
+        {
+            return key >= 10;
+        });
+    ASSERT_EQ(recorder.batches.back().size(), 10u);
+    EXPECT_EQ(recorder.batches.back()[0].kind, DatabaseChangeKind::erased);
+
+    // Unsubscribed listeners are not notified
+    std::size_t batches = recorder.batches.size();
+    EXPECT_TRUE(db.unsubscribe(id));
+    EXPECT_FALSE(db.unsubscribe(id));
+    db.add(3, std::string("three"));
+    EXPECT_EQ(recorder.batches.size(), batches);
+}
+
+/**
+ * Check that listeners could read the database while being notified.
+ */
+TEST(ObservableSafeDatabaseTest, read_from_listener)
+{
+    ObservableSafeDatabase<int, std::string> db;
+    unsigned int size_seen = 0;
+
+    db.subscribe([&db, &size_seen](const std::vector<test::Change>& changes)
+            {
+                ASSERT_TRUE(db.is(changes.back().key));
+                size_seen = db.size();
+            });
+
+    db.add(1, std::string("one"));
+    EXPECT_EQ(size_seen, 1u);
+}
+
+/**
+ * Check that asynchronous notifications deliver every change in order, with a slow listener that fills the queue.
+ */
+TEST(ObservableSafeDatabaseTest, asynchronous_notifications)
+{
+    constexpr int WRITES = 200;
+
+    ObservableSafeDatabase<int, std::string> db(DatabaseNotificationMode::asynchronous, 2);
+    test::Recorder recorder;
+    std::thread::id listener_thread;
+
+    db.subscribe([&recorder, &listener_thread](const std::vector<test::Change>& changes)
+            {
+                listener_thread = std::this_thread::get_id();
+                sleep_for(1);
+                recorder(changes);
+            });
+
+    for (int i = 0; i < WRITES; ++i)
+    {
+        ASSERT_TRUE(db.add(i, std::to_string(i)));
+    }
+
+    test::wait_changes(recorder, WRITES);
+    auto changes = recorder.changes();
+    ASSERT_EQ(changes.size(), static_cast<std::size_t>(WRITES));
+    for (int i = 0; i < WRITES; ++i)
+    {
+        ASSERT_EQ(changes[i].key, i);
+    }
+
+    // Writers are not blocked by the slow listener, so changes are merged in fewer batches
+    EXPECT_LT(recorder.batches.size(), static_cast<std::size_t>(WRITES));
+    EXPECT_NE(listener_thread, std::this_thread::get_id());
+}
+
+/**
+ * Check that changes from concurrent writers are delivered once each.
+ */
+TEST(ObservableSafeDatabaseTest, concurrent_writers)
+{
+    constexpr int THREADS = 4;
+    constexpr int KEYS = 200;
+
+    for (auto mode : {DatabaseNotificationMode::synchronous, DatabaseNotificationMode::asynchronous})
+    {
+        ObservableSafeDatabase<int, std::string> db(mode);
+        test::Recorder recorder;
+        db.subscribe([&recorder](const std::vector<test::Change>& changes)
+                {
+                    recorder(changes);
+                });
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&db, t]()
+                    {
+                        for (int i = 0; i < KEYS; ++i)
+                        {
+                            db.add(t * KEYS + i, std::string("value"));
+                            db.erase(t * KEYS + i);
+                        }
+                    });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        test::wait_changes(recorder, 2 * THREADS * KEYS);
+        auto changes = recorder.changes();
+        ASSERT_EQ(changes.size(), static_cast<std::size_t>(2 * THREADS * KEYS));
+
+        // Each key is added before it is erased
+        std::vector<int> state(THREADS * KEYS, 0);
+        for (const auto& change : changes)
+        {
+            if (change.kind == DatabaseChangeKind::added)
+            {
+                ASSERT_EQ(state[change.key]++, 0);
+            }
+            else
+            {
+                ASSERT_EQ(state[change.key]++, 1);
+            }
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,368 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/PersistentSafeDatabase.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+using Database = PersistentSafeDatabase<int, std::string>;
+
+Codec<int> int_codec()
+{
+    Codec<int> codec;
+    codec.serialize = [](const int& value, std::vector<uint8_t>& buffer)
+            {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+            };
+    codec.deserialize = [](const uint8_t* data, std::size_t)
+            {
+                int value;
+                std::memcpy(&value, data, sizeof(value));
+                return value;
+            };
+    return codec;
+}
+
+Codec<std::string> string_codec()
+{
+    Codec<std::string> codec;
+    codec.serialize = [](const std::string& value, std::vector<uint8_t>& buffer)
+            {
+                buffer.insert(buffer.end(), value.begin(), value.end());
+            };
+    codec.deserialize = [](const uint8_t* data, std::size_t size)
+            {
+                return std::string(reinterpret_cast<const char*>(data), size);
+            };
+    return codec;
+}
+
+//! Configuration over an empty directory for \c test_name .
+PersistenceConfiguration configuration(
+        const std::string& test_name,
+        uint64_t compaction_threshold = 0)
+{
+    PersistenceConfiguration configuration;
+    configuration.directory = "PersistentSafeDatabaseTest_" + test_name;
+    configuration.compaction_threshold = compaction_threshold;
+    std::filesystem::remove_all(configuration.directory);
+    return configuration;
+}
+
+//! Content of \c database .
+std::map<int, std::string> content(
+        const Database& database)
+{
+    std::map<int, std::string> result;
+    database.for_each([&result](const int& key, const std::string& value)
+            {
+                result.emplace(key, value);
+            });
+    return result;
+}
+
+//! Number of log files in \c directory .
+unsigned int log_files(
+        const std::string& directory)
+{
+    unsigned int count = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.path().filename().string().rfind("log.", 0) == 0)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+} /* namespace test */
+
+/**
+ * Check that every kind of write is recovered after restarting.
+ *
+ * CASES:
+ * - add, modify, add_or_modify and erase
+ * - Batch and predicate operations
+ * - Writes that do not change anything are not logged
+ */
+TEST(PersistentSafeDatabaseTest, restart_recovers_content)
+{
+    PersistenceConfiguration configuration = test::configuration("restart");
+    std::map<int, std::string> expected;
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        EXPECT_EQ(database.size(), 0u);
+
+        for (int i = 0; i < 20; ++i)
+        {
+            database.add(i, std::to_string(i));
+        }
+        database.modify(3, "three");
+        database.add_or_modify(4, "four");
+        database.add_or_modify(40, "forty");
+        database.erase(5);
+        EXPECT_FALSE(database.add(6, "repeated"));
+        EXPECT_FALSE(database.erase(100));
+
+        database.add_batch({{50, "a"}, {51, "b"}, {6, "repeated"}});
+        database.erase_if([](const int& key, const std::string&)
+                {
+                    return key >= 10 && key < 15;
+                });
+        database.modify_if(
+            [](const int& key, const std::string&)
+            {
+                return key == 16 || key == 17;
+            },
+            [](const int&, std::string& value)
+            {
+                value += "!";
+            });
+        database.extract_if([](const int& key, const std::string&)
+                {
+                    return key == 18;
+                });
+
+        expected = test::content(database);
+
+        // 20 + modify + 2 add_or_modify + erase + 2 batch + 5 erase_if + 2 modify_if + extract_if
+        EXPECT_EQ(database.statistics().logged_records, 34u);
+    }
+
+    test::Database database(configuration, test::int_codec(), test::string_codec());
+    EXPECT_EQ(test::content(database), expected);
+    EXPECT_EQ(database.at(3), "three");
+    EXPECT_EQ(database.at(16), "16!");
+    EXPECT_FALSE(database.is(5));
+
+    PersistenceStatistics statistics = database.statistics();
+    EXPECT_EQ(statistics.recovered_entries, 0u);
+    EXPECT_EQ(statistics.replayed_records, 34u);
+    EXPECT_EQ(statistics.discarded_bytes, 0u);
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+/**
+ * Check that a compaction writes a snapshot and removes the log, and only the tail is replayed at restart.
+ */
+TEST(PersistentSafeDatabaseTest, compaction)
+{
+    PersistenceConfiguration configuration = test::configuration("compaction");
+    std::map<int, std::string> expected;
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        for (int i = 0; i < 100; ++i)
+        {
+            database.add(i, std::to_string(i));
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            database.modify(i, std::to_string(i * 2));
+        }
+
+        database.compact();
+        EXPECT_EQ(test::log_files(configuration.directory), 1u);
+        EXPECT_TRUE(std::filesystem::exists(configuration.directory + "/snapshot"));
+
+        // Tail after the snapshot
+        database.erase(0);
+        database.add(1000, "tail");
+
+        PersistenceStatistics statistics = database.statistics();
+        EXPECT_EQ(statistics.snapshots, 1u);
+        EXPECT_GT(statistics.snapshot_bytes, 0u);
+        EXPECT_GT(statistics.write_amplification(), 1.0);
+
+        expected = test::content(database);
+    }
+
+    test::Database database(configuration, test::int_codec(), test::string_codec());
+    EXPECT_EQ(test::content(database), expected);
+
+    PersistenceStatistics statistics = database.statistics();
+    EXPECT_EQ(statistics.recovered_entries, 100u);
+    EXPECT_EQ(statistics.replayed_records, 2u);
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+/**
+ * Check that the log is compacted in background when it grows over the threshold.
+ */
+TEST(PersistentSafeDatabaseTest, automatic_compaction)
+{
+    PersistenceConfiguration configuration = test::configuration("automatic", 4096);
+    configuration.sync = false;
+    std::map<int, std::string> expected;
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        for (int i = 0; i < 1000; ++i)
+        {
+            database.add_or_modify(i % 50, std::string(32, 'a' + i % 26));
+        }
+
+        // Wait for the compaction thread
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (database.statistics().snapshots == 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        EXPECT_GT(database.statistics().snapshots, 0u);
+
+        expected = test::content(database);
+    }
+
+    test::Database database(configuration, test::int_codec(), test::string_codec());
+    EXPECT_EQ(test::content(database), expected);
+    EXPECT_LT(database.statistics().replayed_records, 1000u);
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+/**
+ * Check that a torn record at the end of the log is discarded, and the database keeps working after it.
+ */
+TEST(PersistentSafeDatabaseTest, torn_tail)
+{
+    PersistenceConfiguration configuration = test::configuration("torn");
+    std::string log_path = configuration.directory + "/log.0";
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        for (int i = 0; i < 10; ++i)
+        {
+            database.add(i, "value_" + std::to_string(i));
+        }
+    }
+
+    // Crash while writing the last record
+    std::filesystem::resize_file(log_path, std::filesystem::file_size(log_path) - 3);
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        EXPECT_EQ(database.size(), 9u);
+        EXPECT_FALSE(database.is(9));
+        EXPECT_GT(database.statistics().discarded_bytes, 0u);
+
+        database.add(9, "again");
+    }
+
+    // Corrupt one byte of the last record
+    {
+        std::fstream file(log_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('X');
+    }
+
+    test::Database database(configuration, test::int_codec(), test::string_codec());
+    EXPECT_EQ(database.size(), 9u);
+    EXPECT_EQ(database.at(8), "value_8");
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+/**
+ * Check that a corrupt record in a log older than the last one is not discarded, but fails the recovery.
+ */
+TEST(PersistentSafeDatabaseTest, corrupt_older_log)
+{
+    PersistenceConfiguration configuration = test::configuration("corrupt_older");
+    std::string log_path = configuration.directory + "/log.0";
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+        for (int i = 0; i < 10; ++i)
+        {
+            database.add(i, "value_" + std::to_string(i));
+        }
+    }
+
+    // Corrupt the first log, and start a newer one as a rotation would
+    std::filesystem::resize_file(log_path, std::filesystem::file_size(log_path) - 3);
+    std::ofstream(configuration.directory + "/log.1", std::ios::binary);
+
+    EXPECT_THROW(
+        test::Database(configuration, test::int_codec(), test::string_codec()),
+        InitializationException);
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+/**
+ * Check that concurrent writers share commits, and every write is recovered.
+ */
+TEST(PersistentSafeDatabaseTest, concurrent_writers)
+{
+    PersistenceConfiguration configuration = test::configuration("concurrent");
+    constexpr int THREADS = 8;
+    constexpr int WRITES = 100;
+
+    {
+        test::Database database(configuration, test::int_codec(), test::string_codec());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&database, t]()
+                    {
+                        for (int i = 0; i < WRITES; ++i)
+                        {
+                            database.add(t * WRITES + i, std::to_string(t));
+                        }
+                    });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        PersistenceStatistics statistics = database.statistics();
+        EXPECT_EQ(statistics.logged_records, static_cast<uint64_t>(THREADS * WRITES));
+        EXPECT_LE(statistics.commits, statistics.logged_records);
+    }
+
+    test::Database database(configuration, test::int_codec(), test::string_codec());
+    EXPECT_EQ(database.size(), static_cast<unsigned int>(THREADS * WRITES));
+    EXPECT_EQ(database.at(3 * WRITES + 7), "3");
+
+    std::filesystem::remove_all(configuration.directory);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
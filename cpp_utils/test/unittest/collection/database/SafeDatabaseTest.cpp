@@ -17,6 +17,7 @@
 
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <cpp_utils/collection/database/SafeDatabase.hpp>
 #include <cpp_utils/time/time_utils.hpp>
@@ -751,6 +752,19 @@ TEST(SafeDatabaseTest, test_unique_ptrs)
         ASSERT_EQ(sum1, 30);
         ASSERT_EQ(sum1, sum2);
     }
+
+    // extract values, moving their keys
+    {
+        auto extracted = db.extract_if(
+            [](const test::NonCopyable& key, const std::unique_ptr<test::A>&)
+            {
+                return key.name() == "value_plus";
+            });
+        ASSERT_EQ(extracted.size(), 1u);
+        ASSERT_EQ(extracted[0].first.name(), "value_plus");
+        ASSERT_EQ(extracted[0].second->get(), 15);
+        ASSERT_EQ(db.size(), 2u);
+    }
 }
 
 /**
@@ -986,6 +1000,302 @@ TEST(SafeDatabaseTest, parallel_loop)
     iteration_test2.join();
 }
 
+/**
+ * Test database functions using a FlatHashMap as internal container.
+ *
+ * STEPS:
+ * - add values with move-only values, enough to make the container grow
+ * - get, modify and remove values
+ * - iterate over values
+ */
+TEST(SafeDatabaseTest, flat_hash_map_backend)
+{
+    FlatSafeDatabase<int, std::unique_ptr<test::A>> db;
+
+    // add values
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(db.add(int(i), std::make_unique<test::A>(i)));
+    }
+    ASSERT_FALSE(db.add(7, std::make_unique<test::A>(0)));
+    ASSERT_EQ(db.size(), 1000u);
+
+    // get, modify and remove values
+    {
+        ASSERT_TRUE(db.is(999));
+        ASSERT_FALSE(db.is(1000));
+        {
+            auto it = db.find(500);
+            ASSERT_NE(it, db.end());
+            ASSERT_EQ(it->second->get(), 500);
+        }
+
+        ASSERT_TRUE(db.modify(500, std::make_unique<test::Aplus5>(500)));
+        ASSERT_EQ(db.find(500)->second->get(), 505);
+        ASSERT_FALSE(db.add_or_modify(500, std::make_unique<test::A>(5)));
+
+        for (int i = 0; i < 1000; i += 2)
+        {
+            ASSERT_TRUE(db.erase(i));
+        }
+        ASSERT_FALSE(db.erase(0));
+        ASSERT_EQ(db.size(), 500u);
+    }
+
+    // iterate over values
+    {
+        int count = 0;
+        int sum = 0;
+        for (const auto& kv : db)
+        {
+            ASSERT_EQ(kv.first % 2, 1);
+            sum += kv.second->get();
+            count++;
+        }
+        ASSERT_EQ(count, 500);
+        ASSERT_EQ(sum, 500 * 500);
+    }
+}
+
+/**
+ * Test batch and predicate operations, over std::map and FlatHashMap containers.
+ *
+ * STEPS:
+ * - add values in batch, with repeated keys
+ * - modify values that fulfill a predicate
+ * - extract values that fulfill a predicate
+ * - erase values that fulfill a predicate
+ */
+template <typename Database>
+void test_batch_operations()
+{
+    Database db;
+    ASSERT_TRUE(db.add(0, std::string("existing")));
+
+    // add values in batch, with repeated keys
+    {
+        std::vector<std::pair<int, std::string>> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            values.emplace_back(i, std::to_string(i));
+        }
+        values.emplace_back(50, "repeated");
+
+        ASSERT_EQ(db.add_batch(std::move(values)), 99u);
+        ASSERT_EQ(db.size(), 100u);
+        ASSERT_EQ(db.at(0), "existing");
+        ASSERT_EQ(db.at(50), "50");
+    }
+
+    // modify values that fulfill a predicate
+    {
+        unsigned int modified = db.modify_if(
+            [](const int& key, const std::string&)
+            {
+                return key % 10 == 0;
+            },
+            [](const int&, std::string& value)
+            {
+                value += "_tens";
+            });
+        ASSERT_EQ(modified, 10u);
+        ASSERT_EQ(db.at(20), "20_tens");
+        ASSERT_EQ(db.at(21), "21");
+    }
+
+    // extract values that fulfill a predicate
+    {
+        auto extracted = db.extract_if(
+            [](const int&, const std::string& value)
+            {
+                return value.find("_tens") != std::string::npos;
+            });
+        ASSERT_EQ(extracted.size(), 10u);
+        for (const auto& it : extracted)
+        {
+            ASSERT_EQ(it.first % 10, 0);
+            ASSERT_FALSE(db.is(it.first));
+        }
+        ASSERT_EQ(db.size(), 90u);
+    }
+
+    // erase values that fulfill a predicate
+    {
+        unsigned int erased = db.erase_if(
+            [](const int& key, const std::string&)
+            {
+                return key < 50;
+            });
+        ASSERT_EQ(erased, 45u);
+        ASSERT_EQ(db.size(), 45u);
+        for (const auto& it : db)
+        {
+            ASSERT_GE(it.first, 50);
+        }
+        ASSERT_EQ(db.erase_if(
+                    [](const int&, const std::string&)
+                    {
+                        return false;
+                    }), 0u);
+    }
+}
+
+TEST(SafeDatabaseTest, batch_operations)
+{
+    test_batch_operations<SafeDatabase<int, std::string>>();
+    test_batch_operations<FlatSafeDatabase<int, std::string>>();
+}
+
+/**
+ * Test read and for_each access values without copying them.
+ *
+ * STEPS:
+ * - read existing and non existing keys
+ * - visit every element
+ * - check visitors could be used with non copyable values
+ */
+TEST(SafeDatabaseTest, read_and_for_each)
+{
+    SafeDatabase<int, std::unique_ptr<test::A>> db;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(db.add(int(i), std::make_unique<test::A>(i)));
+    }
+
+    // read existing and non existing keys
+    {
+        const test::A* address = nullptr;
+        ASSERT_TRUE(db.read(3, [&address](const std::unique_ptr<test::A>& value)
+                {
+                    address = value.get();
+                }));
+        ASSERT_EQ(address->get(), 3);
+        ASSERT_EQ(address, db.find(3)->second.get());
+
+        bool called = false;
+        ASSERT_FALSE(db.read(10, [&called](const std::unique_ptr<test::A>&)
+                {
+                    called = true;
+                }));
+        ASSERT_FALSE(called);
+    }
+
+    // visit every element
+    {
+        int sum = 0;
+        int count = 0;
+        db.for_each([&sum, &count](const int& key, const std::unique_ptr<test::A>& value)
+                {
+                    ASSERT_EQ(key, value->get());
+                    sum += value->get();
+                    count++;
+                });
+        ASSERT_EQ(count, 10);
+        ASSERT_EQ(sum, 45);
+    }
+
+    // the database could be read from the visitor, and is not locked afterwards
+    {
+        db.for_each([&db](const int& key, const std::unique_ptr<test::A>&)
+                {
+                    ASSERT_TRUE(db.is(key));
+                });
+        ASSERT_TRUE(db.erase(0));
+    }
+}
+
+/**
+ * Test copies of an iterator share the same lock, released when the last copy is destroyed.
+ *
+ * STEPS:
+ * - copy and assign iterators
+ * - destroy the original and check the copy still blocks writers
+ * - destroy the copy and check writers are not blocked
+ */
+TEST(SafeDatabaseTest, iterator_copies)
+{
+    SafeDatabase<int, int> db;
+    db.add(1, 10);
+    db.add(2, 20);
+
+    event::BooleanWaitHandler written(false, true);
+    std::thread writer;
+    {
+        auto copy = db.end();
+        {
+            // copy and assign iterators
+            auto it = db.find(1);
+            copy = it;
+            auto other(it);
+            ASSERT_EQ(other->second, 10);
+
+            writer = std::thread([&db, &written]()
+                            {
+                                db.add(3, 30);
+                                written.open();
+                            });
+        }
+
+        // destroy the original and check the copy still blocks writers
+        ASSERT_EQ(written.wait(50), event::AwakeReason::timeout);
+        ASSERT_EQ(copy->second, 10);
+    }
+
+    // destroy the copy and check writers are not blocked
+    writer.join();
+    ASSERT_TRUE(db.is(3));
+}
+
+/**
+ * Test end() does not lock the database, so it could be called in every iteration while a writer waits.
+ *
+ * STEPS:
+ * - start iterating and launch a writer that blocks on the iterator lock
+ * - iterate calling end() in every iteration: it does not lock again
+ * - every iterator at the end is equal to end()
+ * - writer finishes once the iterator is destroyed
+ */
+TEST(SafeDatabaseTest, end_while_writer_waits)
+{
+    SafeDatabase<int, int> db;
+    db.add(1, 10);
+    db.add(2, 20);
+    db.add(3, 30);
+
+    event::BooleanWaitHandler written(false, true);
+    std::thread writer;
+    {
+        // start iterating and launch a writer that blocks on the iterator lock
+        auto it = db.begin();
+        writer = std::thread([&db, &written]()
+                        {
+                            db.add(4, 40);
+                            written.open();
+                        });
+        ASSERT_EQ(written.wait(50), event::AwakeReason::timeout);
+
+        // iterate calling end() in every iteration: it does not lock again
+        int sum = 0;
+        for (; it != db.end(); ++it)
+        {
+            sum += it->second;
+        }
+        ASSERT_EQ(sum, 60);
+
+        // every iterator at the end is equal to end()
+        ASSERT_TRUE(it == db.end());
+        ASSERT_TRUE(db.end() == it);
+        ASSERT_TRUE(db.end() == db.end());
+        ASSERT_FALSE(written.is_open());
+    }
+
+    // writer finishes once the iterator is destroyed
+    writer.join();
+    ASSERT_TRUE(db.is(4));
+    ASSERT_EQ(db.find(5), db.end());
+    ASSERT_NE(db.find(4), db.end());
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,215 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/ShardedSafeDatabase.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Hash that sends every key to the same shard.
+struct ConstantHash
+{
+    std::size_t operator ()(
+            int) const
+    {
+        return 3;
+    }
+
+};
+
+} // namespace test
+
+/**
+ * Check add, is, at, find, modify, add_or_modify and erase over several shards.
+ */
+TEST(ShardedSafeDatabaseTest, basic_operations)
+{
+    ShardedSafeDatabase<int, std::string> db(4);
+    EXPECT_EQ(db.shard_count(), 4u);
+    EXPECT_EQ(db.size(), 0u);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_TRUE(db.add(i, std::to_string(i)));
+    }
+    EXPECT_FALSE(db.add(3, std::string("repeated")));
+    EXPECT_EQ(db.size(), 20u);
+
+    EXPECT_TRUE(db.is(7));
+    EXPECT_FALSE(db.is(20));
+    EXPECT_EQ(db.at(7), "7");
+    EXPECT_THROW(db.at(20), std::out_of_range);
+
+    {
+        auto it = db.find(7);
+        ASSERT_NE(it, db.end());
+        EXPECT_EQ(it->first, 7);
+        EXPECT_EQ(it->second, "7");
+        EXPECT_EQ(db.find(20), db.end());
+    }
+
+    EXPECT_TRUE(db.modify(7, "seven"));
+    EXPECT_FALSE(db.modify(20, "twenty"));
+    EXPECT_EQ(db.at(7), "seven");
+
+    EXPECT_FALSE(db.add_or_modify(8, std::string("eight")));
+    EXPECT_TRUE(db.add_or_modify(20, std::string("twenty")));
+    EXPECT_EQ(db.at(8), "eight");
+    EXPECT_EQ(db.size(), 21u);
+
+    EXPECT_TRUE(db.erase(20));
+    EXPECT_FALSE(db.erase(20));
+    EXPECT_EQ(db.size(), 20u);
+
+    ShardedSafeDatabase<int, int> single(0);
+    EXPECT_EQ(single.shard_count(), 1u);
+}
+
+/**
+ * Check that iteration visits every element once, skipping empty shards.
+ */
+TEST(ShardedSafeDatabaseTest, iterate)
+{
+    ShardedSafeDatabase<int, int> db(8);
+    EXPECT_EQ(db.begin(), db.end());
+
+    // Only some shards have elements
+    db.add(1, 10);
+    db.add(9, 90);
+    db.add(4, 40);
+
+    std::set<int> keys;
+    int sum = 0;
+    for (const auto& it : db)
+    {
+        EXPECT_TRUE(keys.insert(it.first).second);
+        sum += it.second;
+    }
+    EXPECT_EQ(keys, std::set<int>({1, 4, 9}));
+    EXPECT_EQ(sum, 140);
+
+    // Iterator from find stops at the end of its shard
+    ShardedSafeDatabase<int, int, test::ConstantHash> same_shard(4);
+    same_shard.add(1, 1);
+    same_shard.add(2, 2);
+    auto it = same_shard.find(1);
+    ASSERT_NE(it, same_shard.end());
+    ++it;
+    ASSERT_NE(it, same_shard.end());
+    EXPECT_EQ(it->first, 2);
+    it++;
+    EXPECT_EQ(it, same_shard.end());
+}
+
+/**
+ * Check that an iterator blocks writers of its shards until every copy of it is destroyed,
+ * while writers of other shards are not blocked by a find iterator.
+ */
+TEST(ShardedSafeDatabaseTest, iterator_locks)
+{
+    ShardedSafeDatabase<int, int> db(2);
+    db.add(0, 0);
+    db.add(1, 1);
+
+    std::atomic<bool> written(false);
+    std::thread writer;
+    {
+        auto it = db.begin();
+        auto copy = it;
+
+        writer = std::thread([&db, &written]()
+                        {
+                            db.add(2, 2);
+                            written.store(true);
+                        });
+
+        sleep_for(50);
+        EXPECT_FALSE(written.load());
+        EXPECT_TRUE(db.is(0));
+    }
+    writer.join();
+    EXPECT_TRUE(written.load());
+
+    // Key 0 and 1 are in different shards
+    {
+        auto it = db.find(0);
+        EXPECT_TRUE(db.modify(1, 10));
+        EXPECT_EQ(it->second, 0);
+    }
+}
+
+/**
+ * Check several threads reading and writing keys of every shard.
+ */
+TEST(ShardedSafeDatabaseTest, many_threads)
+{
+    constexpr int THREADS = 8;
+    constexpr int KEYS = 500;
+
+    ShardedSafeDatabase<int, int> db;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&db, t]()
+                {
+                    for (int i = 0; i < KEYS; ++i)
+                    {
+                        int key = t * KEYS + i;
+                        ASSERT_TRUE(db.add(key, i));
+                        ASSERT_TRUE(db.is(key));
+                        ASSERT_TRUE(db.modify(key, i + 1));
+                        ASSERT_EQ(db.at(key), i + 1);
+                        if (i % 2 == 0)
+                        {
+                            ASSERT_TRUE(db.erase(key));
+                        }
+                    }
+
+                    // Iterate while others write
+                    int count = 0;
+                    for (const auto& it : db)
+                    {
+                        (void)it;
+                        count++;
+                    }
+                    ASSERT_LE(count, THREADS * KEYS);
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(db.size(), static_cast<unsigned int>(THREADS * KEYS / 2));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,260 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/SnapshotSafeDatabase.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Database that gives access to its current snapshot pointer, to protect it as readers do.
+class InspectableDatabase : public SnapshotSafeDatabase<int, int>
+{
+public:
+
+    const std::atomic<const DatabaseSnapshot<int, int>*>& current() const
+    {
+        return current_;
+    }
+
+};
+
+} // namespace test
+
+/**
+ * Check add, is, at, find, modify, add_or_modify and erase.
+ */
+TEST(SnapshotSafeDatabaseTest, basic_operations)
+{
+    SnapshotSafeDatabase<int, std::string> db;
+    EXPECT_EQ(db.size(), 0u);
+    EXPECT_EQ(db.begin(), db.end());
+
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_TRUE(db.add(i, std::to_string(i)));
+    }
+    EXPECT_FALSE(db.add(3, std::string("repeated")));
+    EXPECT_EQ(db.size(), 20u);
+
+    EXPECT_TRUE(db.is(7));
+    EXPECT_FALSE(db.is(20));
+    EXPECT_EQ(db.at(7), "7");
+    EXPECT_THROW(db.at(20), std::out_of_range);
+
+    {
+        auto it = db.find(7);
+        ASSERT_NE(it, db.end());
+        EXPECT_EQ(it->first, 7);
+        EXPECT_EQ(it->second, "7");
+        EXPECT_EQ(db.find(20), db.end());
+    }
+
+    EXPECT_TRUE(db.modify(7, "seven"));
+    EXPECT_FALSE(db.modify(20, "twenty"));
+    EXPECT_EQ(db.at(7), "seven");
+
+    EXPECT_FALSE(db.add_or_modify(8, std::string("eight")));
+    EXPECT_TRUE(db.add_or_modify(20, std::string("twenty")));
+    EXPECT_EQ(db.at(8), "eight");
+    EXPECT_EQ(db.size(), 21u);
+
+    EXPECT_TRUE(db.erase(20));
+    EXPECT_FALSE(db.erase(20));
+    EXPECT_EQ(db.size(), 20u);
+
+    // Without readers, old snapshots are destroyed as soon as they are replaced
+    EXPECT_EQ(db.retired_count(), 0u);
+}
+
+/**
+ * Check that iterators and snapshots keep the data of the moment they were taken, without blocking writers.
+ */
+TEST(SnapshotSafeDatabaseTest, snapshot_isolation)
+{
+    SnapshotSafeDatabase<int, int> db;
+    db.add(1, 10);
+    db.add(2, 20);
+
+    auto it = db.begin();
+    auto snapshot = db.snapshot();
+
+    // Writers are not blocked by the iterator
+    std::thread writer([&db]()
+            {
+                db.add(3, 30);
+                db.modify(1, 11);
+                db.erase(2);
+            });
+    writer.join();
+
+    EXPECT_EQ(db.size(), 2u);
+    EXPECT_EQ(db.at(1), 11);
+
+    // Old version is still iterated
+    std::vector<std::pair<int, int>> values;
+    for (; it != db.end(); ++it)
+    {
+        values.push_back(*it);
+    }
+    EXPECT_EQ(values, (std::vector<std::pair<int, int>>({{1, 10}, {2, 20}})));
+
+    ASSERT_EQ(snapshot->size(), 2u);
+    EXPECT_EQ(snapshot->at(2), 20);
+}
+
+/**
+ * Check that a snapshot protected by a hazard pointer is not destroyed until it is released.
+ */
+TEST(SnapshotSafeDatabaseTest, deferred_reclamation)
+{
+    test::InspectableDatabase db;
+    db.add(1, 1);
+
+    {
+        // Protect the current snapshot as readers do
+        HazardPointer hazard;
+        const DatabaseSnapshot<int, int>* snapshot = hazard.protect(db.current());
+
+        // Replaced snapshot is retired but not destroyed
+        db.modify(1, 2);
+        EXPECT_EQ(db.retired_count(), 1u);
+        EXPECT_EQ(snapshot->data.at(1), 1);
+
+        // Once released, it is destroyed by next write
+        hazard.reset();
+        db.modify(1, 1);
+        EXPECT_EQ(db.retired_count(), 0u);
+    }
+
+    // A reader in other thread keeps its snapshot protected while writers publish new ones
+    std::atomic<bool> reading(false);
+    std::atomic<bool> release(false);
+    std::thread reader([&db, &reading, &release]()
+            {
+                auto it = db.find(1);
+                reading.store(true);
+                while (!release.load())
+                {
+                    std::this_thread::yield();
+                }
+                EXPECT_EQ(it->second, 1);
+            });
+
+    while (!reading.load())
+    {
+        std::this_thread::yield();
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        db.modify(1, i + 2);
+    }
+    EXPECT_EQ(db.at(1), 11);
+
+    release.store(true);
+    reader.join();
+}
+
+/**
+ * Check many readers concurrently with writers, under lock-free reads.
+ */
+TEST(SnapshotSafeDatabaseTest, many_threads)
+{
+    constexpr int READERS = 6;
+    constexpr int WRITERS = 2;
+    constexpr int KEYS = 200;
+
+    SnapshotSafeDatabase<int, int> db;
+    std::atomic<bool> stop(false);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < READERS; ++t)
+    {
+        readers.emplace_back([&db, &stop]()
+                {
+                    while (!stop.load())
+                    {
+                        for (int key = 0; key < KEYS * WRITERS; ++key)
+                        {
+                            if (db.is(key))
+                            {
+                                // Values are only increased, and never erased
+                                ASSERT_GE(db.at(key), key);
+                            }
+                        }
+
+                        // Every snapshot is consistent: its size is the number of elements iterated
+                        auto snapshot = db.snapshot();
+                        unsigned int count = 0;
+                        for (const auto& it : *snapshot)
+                        {
+                            ASSERT_GE(it.second, it.first);
+                            count++;
+                        }
+                        ASSERT_EQ(count, snapshot->size());
+                    }
+                });
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < WRITERS; ++t)
+    {
+        writers.emplace_back([&db, t]()
+                {
+                    for (int i = 0; i < KEYS; ++i)
+                    {
+                        int key = t * KEYS + i;
+                        ASSERT_TRUE(db.add(key, key));
+                        ASSERT_TRUE(db.modify(key, key + 1));
+                    }
+                });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(db.size(), static_cast<unsigned int>(KEYS * WRITERS));
+    for (int key = 0; key < KEYS * WRITERS; ++key)
+    {
+        EXPECT_EQ(db.at(key), key + 1);
+    }
+
+    // Readers have finished, so next write reclaims every retired snapshot
+    db.erase(0);
+    EXPECT_EQ(db.retired_count(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
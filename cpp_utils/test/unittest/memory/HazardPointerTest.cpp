@@ -0,0 +1,196 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/memory/HazardPointer.hpp>
+
+using namespace eprosima::utils;
+
+/**
+ * Check that a pointer is protected from protect until reset or destruction.
+ */
+TEST(HazardPointerTest, protect_and_reset)
+{
+    int value = 42;
+    std::atomic<int*> source(&value);
+    HazardPointerDomain& domain = HazardPointerDomain::global();
+
+    EXPECT_FALSE(domain.is_protected(&value));
+    {
+        HazardPointer hazard;
+        EXPECT_EQ(hazard.protect(source), &value);
+        EXPECT_TRUE(domain.is_protected(&value));
+
+        hazard.reset();
+        EXPECT_FALSE(domain.is_protected(&value));
+
+        hazard.protect(source);
+        EXPECT_TRUE(domain.is_protected(&value));
+    }
+    EXPECT_FALSE(domain.is_protected(&value));
+}
+
+/**
+ * Check that slots released are reused, by the same thread and by others once the thread finishes.
+ */
+TEST(HazardPointerTest, slots_reused)
+{
+    int values[2] = {1, 2};
+    std::atomic<int*> first(&values[0]);
+    std::atomic<int*> second(&values[1]);
+
+    {
+        HazardPointer hazard_1;
+        HazardPointer hazard_2;
+        hazard_1.protect(first);
+        hazard_2.protect(second);
+
+        std::vector<const void*> pointers = HazardPointerDomain::global().protected_pointers();
+        ASSERT_EQ(pointers.size(), 2u);
+        EXPECT_TRUE(pointers[0] < pointers[1]);
+    }
+    EXPECT_TRUE(HazardPointerDomain::global().protected_pointers().empty());
+
+    // Threads return their slots when finished, so slots do not grow with the number of threads
+    HazardSlot* slot = nullptr;
+    std::thread([&slot]()
+            {
+                slot = HazardPointerDomain::global().acquire_slot();
+                HazardPointerDomain::global().release_slot(slot);
+            }).join();
+    for (int i = 0; i < 10; ++i)
+    {
+        std::thread([]()
+                {
+                    HazardPointer hazard;
+                }).join();
+    }
+    HazardSlot* reused = HazardPointerDomain::global().acquire_slot();
+    EXPECT_EQ(reused, slot);
+    EXPECT_EQ(reused->pointer.load(), nullptr);
+    HazardPointerDomain::global().release_slot(reused);
+}
+
+/**
+ * Check that a writer never destroys an object while a reader protects it.
+ */
+TEST(HazardPointerTest, concurrent_retire)
+{
+    constexpr int READERS = 4;
+    constexpr int WRITES = 2000;
+
+    std::atomic<int*> source(new int(0));
+    std::atomic<bool> stop(false);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < READERS; ++t)
+    {
+        readers.emplace_back([&source, &stop]()
+                {
+                    int last = 0;
+                    while (!stop.load())
+                    {
+                        HazardPointer hazard;
+                        int* value = hazard.protect(source);
+
+                        // Values only increase, and the object is alive while protected
+                        ASSERT_GE(*value, last);
+                        last = *value;
+                    }
+                });
+    }
+
+    std::vector<int*> retired;
+    for (int i = 1; i <= WRITES; ++i)
+    {
+        retired.push_back(source.exchange(new int(i)));
+
+        std::vector<int*> still_protected;
+        for (int* old : retired)
+        {
+            if (HazardPointerDomain::global().is_protected(old))
+            {
+                still_protected.push_back(old);
+            }
+            else
+            {
+                *old = -1;
+                delete old;
+            }
+        }
+        retired.swap(still_protected);
+    }
+
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    for (int* old : retired)
+    {
+        delete old;
+    }
+    delete source.load();
+}
+
+/**
+ * Check that hazard pointers could be used from a thread local destroyed after the slot cache of its thread.
+ */
+TEST(HazardPointerTest, use_after_thread_cache_destroyed)
+{
+    int value = 42;
+    std::atomic<int*> source(&value);
+    std::atomic<bool> protected_at_exit(false);
+
+    struct LateUser
+    {
+        ~LateUser()
+        {
+            HazardPointer hazard;
+            protected_at_exit->store(
+                hazard.protect(*source) == source->load() &&
+                HazardPointerDomain::global().is_protected(source->load()));
+        }
+
+        std::atomic<int*>* source;
+        std::atomic<bool>* protected_at_exit;
+    };
+
+    std::thread thread([&]()
+            {
+                // Constructed before the cache, so it is destroyed after it
+                static thread_local LateUser late_user{&source, &protected_at_exit};
+                HazardPointer hazard;
+                hazard.protect(source);
+            });
+    thread.join();
+
+    EXPECT_TRUE(protected_at_exit.load());
+    EXPECT_FALSE(HazardPointerDomain::global().is_protected(&value));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,10 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <condition_variable>
 #include <cstring>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
@@ -177,6 +179,71 @@ TEST(LesseePtrTest, lessee_ptr_string_access_lock_before_destroy)
     ASSERT_FALSE(lessee.lock());
 }
 
+/**
+ * Lock a lessee from several threads while the owner is reset, and check the data is never destroyed
+ * while a \c GuardedPtr to it exists.
+ *
+ * CASES:
+ * - Many threads locking concurrently
+ * - GuardedPtr moved while locked
+ * - Reset waits for every GuardedPtr to be destroyed
+ */
+TEST(LesseePtrTest, lessee_ptr_concurrent_lock_reset)
+{
+    std::atomic<bool> deleted(false);
+    std::atomic<unsigned int> locks(0);
+
+    OwnerPtr<std::string> owner(
+        new std::string("StringTest"),
+        [&deleted](std::string* value)
+        {
+            deleted.store(true);
+            delete value;
+        });
+    LesseePtr<std::string> lessee = owner.lease();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&lessee, &deleted, &locks]()
+                {
+                    while (true)
+                    {
+                        auto guarded = lessee.lock();
+                        if (!guarded)
+                        {
+                            break;
+                        }
+
+                        // Moved guard keeps the data protected
+                        auto moved = std::move(guarded);
+                        ASSERT_FALSE(guarded);
+                        ASSERT_EQ(*moved, "StringTest");
+                        std::this_thread::yield();
+                        ASSERT_FALSE(deleted.load());
+                        ASSERT_EQ(moved->size(), 10u);
+                        locks++;
+                    }
+                });
+    }
+
+    // Let every thread lock a few times
+    while (locks.load() < 1000)
+    {
+        std::this_thread::yield();
+    }
+
+    owner.reset();
+    ASSERT_TRUE(deleted.load());
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(lessee.lock());
+}
+
 int main(
         int argc,
         char** argv)
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <climits>
+#include <stdexcept>
 
 #include <cpp_utils/memory/owner_ptr.hpp>
 
@@ -56,6 +57,31 @@ struct TestClass
     std::vector<char> vector_value;
 };
 
+//! Class that counts its living instances, and throws if constructed with a negative value.
+struct CountedClass
+{
+    CountedClass(
+            int value,
+            int& instances)
+        : value(value)
+        , instances(instances)
+    {
+        if (value < 0)
+        {
+            throw std::invalid_argument("negative value");
+        }
+        instances++;
+    }
+
+    ~CountedClass()
+    {
+        instances--;
+    }
+
+    int value;
+    int& instances;
+};
+
 } /* namespace test */
 } /* namespace utils */
 } /* namespace eprosima */
@@ -211,6 +237,59 @@ TEST(OwnerPtrTest, owner_ptr_reset)
     ASSERT_EQ(deleter_calls, 1);
 }
 
+/**
+ * Create an owner ptr with make_owned
+ *
+ * STEPS:
+ * - Create an object with arguments
+ * - Lease and lock it
+ * - Reset the owner and check the object is destroyed but the lessee is still safe to use
+ * - Constructor throwing
+ */
+TEST(OwnerPtrTest, owner_ptr_make_owned)
+{
+    int instances = 0;
+
+    // Create an object with arguments
+    OwnerPtr<test::CountedClass> ptr = make_owned<test::CountedClass>(42, instances);
+    ASSERT_TRUE(ptr);
+    ASSERT_EQ(ptr->value, 42);
+    ASSERT_EQ(instances, 1);
+
+    // Lease and lock it
+    LesseePtr<test::CountedClass> lessee = ptr.lease();
+    {
+        auto guarded = lessee.lock();
+        ASSERT_TRUE(guarded);
+        ASSERT_EQ(guarded.get(), ptr.get());
+        guarded->value++;
+    }
+    ASSERT_EQ((*ptr).value, 43);
+
+    // Move it
+    OwnerPtr<test::CountedClass> moved = std::move(ptr);
+    ASSERT_FALSE(ptr);
+    ASSERT_EQ(moved->value, 43);
+
+    // Reset the owner, the lessee keeps the memory until destroyed
+    moved.reset();
+    ASSERT_FALSE(moved);
+    ASSERT_EQ(instances, 0);
+    ASSERT_FALSE(lessee);
+    ASSERT_FALSE(lessee.lock());
+
+    // Constructor throwing
+    ASSERT_THROW(make_owned<test::CountedClass>(-1, instances), std::invalid_argument);
+    ASSERT_EQ(instances, 0);
+
+    // Destroyed by the owner destructor
+    {
+        auto scoped = make_owned<test::CountedClass>(1, instances);
+        ASSERT_EQ(instances, 1);
+    }
+    ASSERT_EQ(instances, 0);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,164 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/pool/ArenaMemoryResource.hpp>
+#include <cpp_utils/pool/PoolMemoryResource.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Resource that counts the allocations forwarded to the default one.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+
+    unsigned int allocations = 0;
+    unsigned int deallocations = 0;
+
+protected:
+
+    void* do_allocate(
+            std::size_t bytes,
+            std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+            void* p,
+            std::size_t bytes,
+            std::size_t alignment) override
+    {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} /* namespace test */
+
+/**
+ * Check that allocations are consecutive and aligned, and that release gives back every chunk.
+ */
+TEST(ArenaMemoryResourceTest, allocate_release)
+{
+    test::CountingResource upstream;
+    {
+        ArenaMemoryResource arena(&upstream, 256);
+
+        char* first = static_cast<char*>(arena.allocate(10, 1));
+        char* second = static_cast<char*>(arena.allocate(10, 1));
+        EXPECT_EQ(first + 10, second);
+
+        void* aligned = arena.allocate(8, 32);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 32, 0u);
+        EXPECT_EQ(arena.chunks(), 1u);
+        EXPECT_EQ(arena.bytes_allocated(), 28u);
+
+        // Deallocation does not give memory back
+        arena.deallocate(first, 10, 1);
+        EXPECT_NE(arena.allocate(10, 1), first);
+
+        // Fill more chunks
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_NE(arena.allocate(100), nullptr);
+        }
+        EXPECT_GT(arena.chunks(), 1u);
+        EXPECT_EQ(upstream.allocations, arena.chunks());
+
+        arena.release();
+        EXPECT_EQ(arena.chunks(), 0u);
+        EXPECT_EQ(arena.bytes_allocated(), 0u);
+        EXPECT_EQ(upstream.deallocations, upstream.allocations);
+
+        // Could be used again after release
+        EXPECT_NE(arena.allocate(100), nullptr);
+        EXPECT_EQ(arena.chunks(), 1u);
+    }
+
+    // Destruction releases the rest
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+/**
+ * Check allocations bigger than a chunk.
+ */
+TEST(ArenaMemoryResourceTest, big_allocation)
+{
+    test::CountingResource upstream;
+    ArenaMemoryResource arena(&upstream, 256);
+
+    char* small = static_cast<char*>(arena.allocate(16));
+    void* big = arena.allocate(1000, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 64, 0u);
+    EXPECT_EQ(arena.chunks(), 2u);
+
+    // Current chunk is kept for small allocations
+    char* next = static_cast<char*>(arena.allocate(16));
+    EXPECT_EQ(small + 16, next);
+
+    arena.release();
+    EXPECT_EQ(upstream.deallocations, 2u);
+
+    EXPECT_THROW(ArenaMemoryResource(&upstream, 8), InitializationException);
+}
+
+/**
+ * Build a message with pmr containers in an arena over a pool resource, reusing the chunks for each message.
+ */
+TEST(ArenaMemoryResourceTest, message_over_pool)
+{
+    test::CountingResource upstream;
+    PoolMemoryResource pool(PoolConfiguration(0, 0, 4), &upstream);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ArenaMemoryResource arena(&pool);
+
+        std::pmr::vector<std::pmr::string> fields(&arena);
+        for (int j = 0; j < 10; ++j)
+        {
+            fields.emplace_back("Field of a message that does not fit in small string optimization");
+        }
+        ASSERT_EQ(fields.back().get_allocator().resource(), &arena);
+        ASSERT_GE(arena.chunks(), 1u);
+    }
+
+    // Chunks come from the pool and nothing reaches upstream
+    EXPECT_EQ(upstream.allocations, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/pool/HugePageMemoryResource.hpp>
+#include <cpp_utils/pool/UnboundedPool.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+constexpr std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+
+//! Sample buffer big enough to fill huge pages with few elements.
+struct Sample
+{
+    char data[64 * 1024];
+};
+
+} /* namespace test */
+
+/**
+ * Check that big allocations are mapped aligned to the huge page size, with hugetlb or regular pages.
+ */
+TEST(HugePageMemoryResourceTest, map_big_allocations)
+{
+    if (!HugePageMemoryResource::is_supported())
+    {
+        GTEST_SKIP();
+    }
+
+    HugePageMemoryResource resource;
+
+    std::size_t size = 3 * test::HUGE_PAGE + 100;
+    void* memory = resource.allocate(size, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(memory) % test::HUGE_PAGE, 0u);
+    EXPECT_EQ(resource.hugetlb_allocations() + resource.regular_allocations(), 1u);
+
+    // Memory is usable
+    std::memset(memory, 0x5A, size);
+    EXPECT_EQ(static_cast<unsigned char*>(memory)[size - 1], 0x5A);
+
+    resource.deallocate(memory, size, 64);
+}
+
+/**
+ * Check that small allocations are forwarded to upstream.
+ */
+TEST(HugePageMemoryResourceTest, small_allocations)
+{
+    HugePageMemoryResource resource;
+
+    void* memory = resource.allocate(100);
+    EXPECT_EQ(resource.hugetlb_allocations() + resource.regular_allocations(), 0u);
+    resource.deallocate(memory, 100);
+
+    HugePageConfiguration configuration;
+    configuration.huge_page_size = 3000;
+    EXPECT_THROW(HugePageMemoryResource invalid(configuration), InitializationException);
+}
+
+/**
+ * Check that regular pages are used when hugetlb is disabled, and are bound to the local node if possible.
+ */
+TEST(HugePageMemoryResourceTest, regular_pages)
+{
+    if (!HugePageMemoryResource::is_supported())
+    {
+        GTEST_SKIP();
+    }
+
+    HugePageConfiguration configuration;
+    configuration.use_hugetlb = false;
+    HugePageMemoryResource resource(configuration);
+
+    void* memory = resource.allocate(test::HUGE_PAGE);
+    EXPECT_EQ(resource.regular_allocations(), 1u);
+    EXPECT_EQ(resource.hugetlb_allocations(), 0u);
+    EXPECT_LE(resource.numa_bound_allocations(), 1u);
+    std::memset(memory, 0, test::HUGE_PAGE);
+    resource.deallocate(memory, test::HUGE_PAGE);
+}
+
+/**
+ * Check a pool whose slabs are allocated from the resource.
+ */
+TEST(HugePageMemoryResourceTest, pool_backing)
+{
+    HugePageMemoryResource resource;
+
+    PoolConfiguration configuration(64, 0, 64);
+    configuration.memory_resource = &resource;
+    {
+        UnboundedPool<test::Sample> pool(configuration);
+
+        test::Sample* sample;
+        ASSERT_TRUE(pool.loan(sample));
+        std::memset(sample->data, 1, sizeof(sample->data));
+        pool.return_loan(sample);
+
+        if (HugePageMemoryResource::is_supported())
+        {
+            EXPECT_EQ(resource.hugetlb_allocations() + resource.regular_allocations(), 1u);
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,278 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/pool/IPool.hpp>
+#include <cpp_utils/pool/LimitedPool.hpp>
+#include <cpp_utils/pool/UnboundedPool.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+constexpr unsigned int POOL_SIZE = 4;
+constexpr Duration_ms RESIDUAL_TIME_TEST = 10u;
+
+PoolConfiguration configuration(
+        PoolExhaustionPolicy policy,
+        Duration_ms timeout = 0)
+{
+    PoolConfiguration configuration(0, POOL_SIZE, 1);
+    configuration.exhaustion_policy = policy;
+    configuration.exhaustion_timeout = timeout;
+    return configuration;
+}
+
+//! Loan every element of the pool.
+std::vector<int*> loan_all(
+        IPool<int>& pool)
+{
+    std::vector<int*> elements(POOL_SIZE);
+    for (auto& element : elements)
+    {
+        EXPECT_TRUE(pool.loan(element));
+    }
+    return elements;
+}
+
+} /* namespace test */
+
+/**
+ * Check that every element is preallocated and different.
+ */
+TEST(LimitedPoolTest, preallocated_elements)
+{
+    LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::fail));
+    EXPECT_EQ(pool.free_elements(), test::POOL_SIZE);
+
+    auto elements = test::loan_all(pool);
+    EXPECT_EQ(std::set<int*>(elements.begin(), elements.end()).size(), test::POOL_SIZE);
+    EXPECT_EQ(pool.free_elements(), 0u);
+
+    for (auto& element : elements)
+    {
+        EXPECT_TRUE(pool.return_loan(element));
+    }
+    EXPECT_EQ(pool.free_elements(), test::POOL_SIZE);
+
+    // Returning more elements than loaned
+    EXPECT_THROW(pool.return_loan(elements[0]), InconsistencyException);
+}
+
+/**
+ * Check that loan fails when the pool is exhausted with fail policy.
+ */
+TEST(LimitedPoolTest, fail_policy)
+{
+    LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::fail));
+    auto elements = test::loan_all(pool);
+
+    int* element;
+    EXPECT_FALSE(pool.loan(element));
+
+    pool.return_loan(elements.back());
+    EXPECT_TRUE(pool.loan(element));
+    EXPECT_EQ(element, elements.back());
+
+    for (auto& loaned : elements)
+    {
+        pool.return_loan(loaned);
+    }
+}
+
+/**
+ * Check that loan waits until an element is returned with wait policy.
+ *
+ * CASES:
+ * - Timeout reached
+ * - Element returned by other thread while waiting
+ */
+TEST(LimitedPoolTest, wait_policy)
+{
+    LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::wait, 1000u));
+    auto elements = test::loan_all(pool);
+
+    {
+        LimitedPool<int> short_pool(test::configuration(PoolExhaustionPolicy::wait, test::RESIDUAL_TIME_TEST));
+        auto short_elements = test::loan_all(short_pool);
+        int* element;
+        EXPECT_FALSE(short_pool.loan(element));
+        for (auto& loaned : short_elements)
+        {
+            short_pool.return_loan(loaned);
+        }
+    }
+
+    int* returned = elements.back();
+    elements.pop_back();
+    std::thread returner([&pool, returned]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+                pool.return_loan(returned);
+            });
+
+    int* element;
+    EXPECT_TRUE(pool.loan(element));
+    EXPECT_EQ(element, returned);
+    returner.join();
+
+    pool.return_loan(element);
+    for (auto& loaned : elements)
+    {
+        pool.return_loan(loaned);
+    }
+}
+
+/**
+ * Check that loan allocates out of the pool with heap fallback policy, and those elements are freed.
+ */
+TEST(LimitedPoolTest, heap_fallback_policy)
+{
+    LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::heap_fallback));
+    auto elements = test::loan_all(pool);
+
+    int* extra_1;
+    int* extra_2;
+    EXPECT_TRUE(pool.loan(extra_1));
+    EXPECT_TRUE(pool.loan(extra_2));
+    EXPECT_EQ(pool.heap_allocations(), 2u);
+    EXPECT_EQ(pool.heap_elements_in_use(), 2u);
+
+    pool.return_loan(extra_1);
+    pool.return_loan(extra_2);
+    EXPECT_EQ(pool.heap_allocations(), 2u);
+    EXPECT_EQ(pool.heap_elements_in_use(), 0u);
+    EXPECT_EQ(pool.free_elements(), 0u);
+
+    for (auto& loaned : elements)
+    {
+        pool.return_loan(loaned);
+    }
+    EXPECT_EQ(pool.free_elements(), test::POOL_SIZE);
+}
+
+/**
+ * Check that several threads share the elements of a pool with wait policy.
+ */
+TEST(LimitedPoolTest, many_threads)
+{
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 2000;
+
+    LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::wait));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&pool, t]()
+                {
+                    for (int i = 0; i < ITERATIONS; ++i)
+                    {
+                        int* element;
+                        ASSERT_TRUE(pool.loan(element));
+                        *element = t;
+                        std::this_thread::yield();
+                        ASSERT_EQ(*element, t);
+                        pool.return_loan(element);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(pool.free_elements(), test::POOL_SIZE);
+}
+
+/**
+ * Check that create_pool creates the pool that matches the configuration.
+ */
+TEST(LimitedPoolTest, create_pool)
+{
+    std::unique_ptr<IPool<int>> unbounded(create_pool<int>(PoolConfiguration(0, 0, 1)));
+    EXPECT_NE(dynamic_cast<UnboundedPool<int>*>(unbounded.get()), nullptr);
+
+    std::unique_ptr<IPool<int>> limited(create_pool<int>(PoolConfiguration(0, 4, 1)));
+    EXPECT_NE(dynamic_cast<LimitedPool<int>*>(limited.get()), nullptr);
+
+    EXPECT_THROW(LimitedPool<int>(PoolConfiguration(0, 0, 1)), InitializationException);
+}
+
+/**
+ * Check the statistics of the pool with failed loans and heap allocations.
+ */
+TEST(LimitedPoolTest, statistics)
+{
+    {
+        LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::fail));
+        auto elements = test::loan_all(pool);
+
+        int* extra;
+        EXPECT_FALSE(pool.loan(extra));
+        EXPECT_FALSE(pool.loan(extra));
+
+        PoolStatistics statistics = pool.statistics();
+        EXPECT_EQ(statistics.in_use, test::POOL_SIZE);
+        EXPECT_EQ(statistics.free, 0u);
+        EXPECT_EQ(statistics.high_water_mark, test::POOL_SIZE);
+        EXPECT_EQ(statistics.allocations, test::POOL_SIZE);
+        EXPECT_EQ(statistics.failed_loans, 2u);
+
+        for (auto& loaned : elements)
+        {
+            pool.return_loan(loaned);
+        }
+        EXPECT_EQ(pool.statistics().in_use, 0u);
+        EXPECT_EQ(pool.statistics().high_water_mark, test::POOL_SIZE);
+    }
+
+    {
+        LimitedPool<int> pool(test::configuration(PoolExhaustionPolicy::heap_fallback));
+        auto elements = test::loan_all(pool);
+
+        int* extra;
+        EXPECT_TRUE(pool.loan(extra));
+
+        PoolStatistics statistics = pool.statistics();
+        EXPECT_EQ(statistics.in_use, test::POOL_SIZE + 1);
+        EXPECT_EQ(statistics.high_water_mark, test::POOL_SIZE + 1);
+        EXPECT_EQ(statistics.allocations, test::POOL_SIZE + 1);
+        EXPECT_EQ(statistics.failed_loans, 0u);
+
+        pool.return_loan(extra);
+        for (auto& loaned : elements)
+        {
+            pool.return_loan(loaned);
+        }
+        EXPECT_EQ(pool.statistics().in_use, 0u);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,280 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/pool/MagazinePool.hpp>
+#include <cpp_utils/wait/DBQueueWaitHandler.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Pool that counts how many times an element has been reset.
+class CountingPool : public MagazinePool<std::string>
+{
+public:
+
+    using MagazinePool<std::string>::MagazinePool;
+
+    std::atomic<unsigned int> resets {0};
+
+protected:
+
+    void reset_element_(
+            std::string* element) override
+    {
+        element->clear();
+        resets++;
+    }
+
+};
+
+} /* namespace test */
+
+/**
+ * Check that elements are reused once returned in the same thread.
+ *
+ * CASES:
+ * - Initial elements are loaned without allocating
+ * - Loaned elements are different
+ * - Returned elements are reused
+ */
+TEST(MagazinePoolTest, loan_return_same_thread)
+{
+    MagazinePool<std::string> pool(PoolConfiguration(10, 0, 5), 4);
+    EXPECT_EQ(pool.reserved(), 10u);
+
+    std::set<std::string*> loaned;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::string* element;
+        ASSERT_TRUE(pool.loan(element));
+        loaned.insert(element);
+    }
+    EXPECT_EQ(loaned.size(), 10u);
+    EXPECT_EQ(pool.reserved(), 10u);
+
+    // Next loan allocates a new batch
+    std::string* element;
+    ASSERT_TRUE(pool.loan(element));
+    loaned.insert(element);
+    EXPECT_EQ(pool.reserved(), 15u);
+
+    for (auto* loaned_element : loaned)
+    {
+        ASSERT_TRUE(pool.return_loan(loaned_element));
+    }
+
+    for (int i = 0; i < 15; ++i)
+    {
+        ASSERT_TRUE(pool.loan(element));
+        EXPECT_NE(loaned.find(element), loaned.end());
+        pool.return_loan(element);
+    }
+    EXPECT_EQ(pool.reserved(), 15u);
+}
+
+/**
+ * Check that elements are reset when returned.
+ */
+TEST(MagazinePoolTest, reset_element)
+{
+    test::CountingPool pool(PoolConfiguration(0, 0, 1), 2);
+
+    std::string* element;
+    pool.loan(element);
+    *element = "value";
+    pool.return_loan(element);
+
+    EXPECT_EQ(pool.resets.load(), 1u);
+    pool.loan(element);
+    EXPECT_EQ(*element, "");
+    pool.return_loan(element);
+}
+
+/**
+ * Check that elements loaned in a thread and returned in other are reused, without allocating new ones.
+ */
+TEST(MagazinePoolTest, cross_thread)
+{
+    constexpr unsigned int ELEMENTS = 100000;
+    constexpr unsigned int MAGAZINE_SIZE = 32;
+
+    MagazinePool<std::string> pool(PoolConfiguration(0, 0, MAGAZINE_SIZE), MAGAZINE_SIZE);
+    event::DBQueueWaitHandler<std::string*> in_flight(0, true);
+
+    std::thread returner([&]()
+            {
+                for (unsigned int i = 0; i < ELEMENTS; ++i)
+                {
+                    std::string* element = in_flight.consume();
+                    ASSERT_EQ(*element, std::to_string(i));
+                    pool.return_loan(element);
+                }
+            });
+
+    for (unsigned int i = 0; i < ELEMENTS; ++i)
+    {
+        std::string* element;
+        pool.loan(element);
+        *element = std::to_string(i);
+        in_flight.produce(element);
+
+        // Do not let the returner fall too behind, so elements could be reused
+        while (in_flight.elements_ready_to_consume() > MAGAZINE_SIZE * 4)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    returner.join();
+
+    // Elements are reused through the depot
+    EXPECT_LT(pool.reserved(), ELEMENTS / 10);
+}
+
+/**
+ * Check that several threads loaning and returning keep elements exclusive.
+ */
+TEST(MagazinePoolTest, many_threads)
+{
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 10000;
+
+    MagazinePool<int> pool(PoolConfiguration(0, 0, 8), 8);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&pool, t]()
+                {
+                    std::vector<int*> elements(4);
+                    for (int i = 0; i < ITERATIONS; ++i)
+                    {
+                        for (auto& element : elements)
+                        {
+                            pool.loan(element);
+                            *element = t;
+                        }
+                        for (auto& element : elements)
+                        {
+                            // No other thread could have written this element
+                            ASSERT_EQ(*element, t);
+                            pool.return_loan(element);
+                        }
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * Check that elements cached by a finished thread are returned to the pool.
+ */
+TEST(MagazinePoolTest, thread_exit_returns_elements)
+{
+    MagazinePool<int> pool(PoolConfiguration(0, 0, 16), 16);
+
+    std::thread worker([&pool]()
+            {
+                std::vector<int*> elements(16);
+                for (auto& element : elements)
+                {
+                    pool.loan(element);
+                }
+                for (auto& element : elements)
+                {
+                    pool.return_loan(element);
+                }
+            });
+    worker.join();
+    EXPECT_EQ(pool.reserved(), 16u);
+
+    // Elements of the worker magazines are now in the depot
+    std::vector<int*> elements(16);
+    for (auto& element : elements)
+    {
+        pool.loan(element);
+    }
+    EXPECT_EQ(pool.reserved(), 16u);
+
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+}
+
+/**
+ * Check that statistics add the loans and returns of every thread, also of finished ones.
+ */
+TEST(MagazinePoolTest, statistics)
+{
+    MagazinePool<int> pool(PoolConfiguration(8, 0, 4), 4);
+
+    PoolStatistics statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 0u);
+    EXPECT_EQ(statistics.free, 8u);
+    EXPECT_EQ(statistics.allocations, 1u);
+
+    // Loan in another thread that finishes, and return them in this one
+    std::vector<int*> elements(10);
+    std::thread thread([&pool, &elements]()
+            {
+                for (auto& element : elements)
+                {
+                    pool.loan(element);
+                }
+            });
+    thread.join();
+
+    statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 10u);
+    EXPECT_EQ(statistics.free, 2u);
+    EXPECT_EQ(statistics.allocations, 2u);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        pool.return_loan(elements[i]);
+    }
+    statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 4u);
+    EXPECT_EQ(statistics.free, 8u);
+    EXPECT_EQ(statistics.high_water_mark, 0u);
+
+    for (int i = 6; i < 10; ++i)
+    {
+        pool.return_loan(elements[i]);
+    }
+    EXPECT_EQ(pool.statistics().in_use, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/pool/PoolMemoryResource.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Resource that counts the allocations forwarded to the default one.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+
+    unsigned int allocations = 0;
+    unsigned int deallocations = 0;
+
+protected:
+
+    void* do_allocate(
+            std::size_t bytes,
+            std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+            void* p,
+            std::size_t bytes,
+            std::size_t alignment) override
+    {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} /* namespace test */
+
+/**
+ * Check the size class chosen for each allocation.
+ */
+TEST(PoolMemoryResourceTest, size_classes)
+{
+    EXPECT_EQ(PoolMemoryResource::block_size(1), 16u);
+    EXPECT_EQ(PoolMemoryResource::block_size(16), 16u);
+    EXPECT_EQ(PoolMemoryResource::block_size(17), 32u);
+    EXPECT_EQ(PoolMemoryResource::block_size(1000), 1024u);
+    EXPECT_EQ(PoolMemoryResource::block_size(4096), 4096u);
+    EXPECT_EQ(PoolMemoryResource::block_size(4097), 0u);
+    EXPECT_EQ(PoolMemoryResource::block_size(8, 64), 0u);
+
+    PoolMemoryResource resource;
+    for (std::size_t bytes : {1, 16, 100, 4096})
+    {
+        void* p = resource.allocate(bytes);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t), 0u);
+        resource.deallocate(p, bytes);
+    }
+}
+
+/**
+ * Check that deallocated blocks are reused for new allocations of the same size class.
+ */
+TEST(PoolMemoryResourceTest, reuse_blocks)
+{
+    test::CountingResource upstream;
+    PoolMemoryResource resource(PoolConfiguration(0, 0, 1), &upstream);
+
+    void* first = resource.allocate(100);
+    resource.deallocate(first, 100);
+    void* second = resource.allocate(120);
+    EXPECT_EQ(first, second);
+    resource.deallocate(second, 120);
+
+    // Big and over-aligned allocations go to upstream
+    void* big = resource.allocate(10000);
+    void* aligned = resource.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0u);
+    EXPECT_EQ(upstream.allocations, 2u);
+    resource.deallocate(big, 10000);
+    resource.deallocate(aligned, 8, 64);
+    EXPECT_EQ(upstream.deallocations, 2u);
+}
+
+/**
+ * Build pmr strings and vectors of log entry size repeatedly, checking that they do not reach upstream.
+ */
+TEST(PoolMemoryResourceTest, pmr_containers)
+{
+    test::CountingResource upstream;
+    PoolMemoryResource resource(PoolConfiguration(0, 0, 16), &upstream);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::pmr::string category("POOL_MEMORY_RESOURCE_CATEGORY", &resource);
+        std::pmr::string message(&resource);
+        for (int j = 0; j < 10; ++j)
+        {
+            message += "Log entry message content ";
+        }
+
+        std::pmr::vector<std::pmr::string> entries(&resource);
+        for (int j = 0; j < 20; ++j)
+        {
+            entries.push_back(message);
+        }
+
+        ASSERT_EQ(entries.back(), message);
+        ASSERT_EQ(entries.get_allocator().resource(), &resource);
+        ASSERT_EQ(entries.back().get_allocator().resource(), &resource);
+    }
+
+    EXPECT_EQ(upstream.allocations, 0u);
+}
+
+/**
+ * Allocate in some threads and deallocate in others.
+ */
+TEST(PoolMemoryResourceTest, many_threads)
+{
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 1000;
+
+    PoolMemoryResource resource;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&resource, t]()
+                {
+                    std::pmr::vector<std::pmr::string> values(&resource);
+                    for (int i = 0; i < ITERATIONS; ++i)
+                    {
+                        values.emplace_back(std::string(16 + (i + t) % 200, 'a'));
+                    }
+
+                    // Deallocated in another thread
+                    std::thread([values = std::move(values)]() mutable
+                    {
+                        ASSERT_EQ(values.size(), static_cast<std::size_t>(ITERATIONS));
+                        values.clear();
+                        values.shrink_to_fit();
+                    }).join();
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/pool/LimitedPool.hpp>
+#include <cpp_utils/pool/MagazinePool.hpp>
+#include <cpp_utils/pool/PoolPtr.hpp>
+#include <cpp_utils/pool/SharedPoolPtr.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+PoolConfiguration limited_configuration(
+        unsigned int size)
+{
+    return PoolConfiguration(0, size, 1);
+}
+
+} /* namespace test */
+
+/**
+ * Check that a PoolPtr returns its element to the pool when destroyed.
+ */
+TEST(PoolPtrTest, return_on_destruction)
+{
+    LimitedPool<std::string> pool(test::limited_configuration(2));
+    {
+        PoolPtr<std::string> ptr = loan_ptr(pool);
+        ASSERT_TRUE(ptr);
+        *ptr = "value";
+        EXPECT_EQ(ptr->size(), 5u);
+        EXPECT_EQ(pool.free_elements(), 1u);
+    }
+    EXPECT_EQ(pool.free_elements(), 2u);
+
+    // Empty handle when pool is exhausted
+    PoolPtr<std::string> ptr_1 = loan_ptr(pool);
+    PoolPtr<std::string> ptr_2 = loan_ptr(pool);
+    PoolPtr<std::string> ptr_3 = loan_ptr(pool);
+    EXPECT_TRUE(ptr_2);
+    EXPECT_FALSE(ptr_3);
+    EXPECT_EQ(ptr_3.get(), nullptr);
+}
+
+/**
+ * Check moving, resetting and releasing a PoolPtr.
+ */
+TEST(PoolPtrTest, move_reset_release)
+{
+    LimitedPool<int> pool(test::limited_configuration(2));
+
+    PoolPtr<int> ptr = loan_ptr(pool);
+    int* element = ptr.get();
+
+    PoolPtr<int> moved(std::move(ptr));
+    EXPECT_FALSE(ptr);
+    EXPECT_EQ(moved.get(), element);
+
+    PoolPtr<int> assigned = loan_ptr(pool);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.get(), element);
+    EXPECT_EQ(pool.free_elements(), 1u);
+
+    assigned.reset();
+    EXPECT_FALSE(assigned);
+    EXPECT_EQ(pool.free_elements(), 2u);
+
+    PoolPtr<int> released = loan_ptr(pool);
+    int* raw = released.release();
+    EXPECT_FALSE(released);
+    EXPECT_EQ(pool.free_elements(), 1u);
+    pool.return_loan(raw);
+}
+
+/**
+ * Check that the slot of a SharedPoolPtr is returned with the last reference.
+ */
+TEST(PoolPtrTest, shared_last_reference)
+{
+    LimitedPool<PoolSlot<std::string>> pool(test::limited_configuration(1));
+
+    SharedPoolPtr<std::string> ptr = loan_shared_ptr(pool);
+    ASSERT_TRUE(ptr);
+    *ptr = "shared";
+    EXPECT_EQ(ptr.use_count(), 1u);
+    EXPECT_EQ(pool.free_elements(), 0u);
+
+    {
+        SharedPoolPtr<std::string> copy = ptr;
+        EXPECT_EQ(ptr.use_count(), 2u);
+        EXPECT_EQ(*copy, "shared");
+
+        SharedPoolPtr<std::string> assigned;
+        assigned = copy;
+        EXPECT_EQ(ptr.use_count(), 3u);
+
+        SharedPoolPtr<std::string> moved(std::move(assigned));
+        EXPECT_FALSE(assigned);
+        EXPECT_EQ(ptr.use_count(), 3u);
+    }
+    EXPECT_EQ(ptr.use_count(), 1u);
+    EXPECT_EQ(pool.free_elements(), 0u);
+
+    ptr.reset();
+    EXPECT_EQ(ptr.use_count(), 0u);
+    EXPECT_EQ(pool.free_elements(), 1u);
+
+    // The slot is reused
+    SharedPoolPtr<std::string> reused = loan_shared_ptr(pool);
+    EXPECT_EQ(reused.use_count(), 1u);
+    EXPECT_FALSE(loan_shared_ptr(pool));
+}
+
+/**
+ * Check that references released from several threads return the slot exactly once.
+ */
+TEST(PoolPtrTest, shared_many_threads)
+{
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 1000;
+
+    MagazinePool<PoolSlot<int>> pool(PoolConfiguration(0, 0, 8), 8);
+
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        SharedPoolPtr<int> ptr = loan_shared_ptr(pool);
+        *ptr = i;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([copy = ptr, i]() mutable
+                    {
+                        ASSERT_EQ(*copy, i);
+                        copy.reset();
+                    });
+        }
+        ptr.reset();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Slots are reused, so only one batch has been needed
+    EXPECT_EQ(pool.reserved(), 8u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
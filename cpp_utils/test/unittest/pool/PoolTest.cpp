@@ -0,0 +1,182 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/pool/Pool.hpp>
+#include <cpp_utils/pool/PoolAdapter.hpp>
+#include <cpp_utils/pool/PoolPtr.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Type without default constructor.
+struct Buffer
+{
+    Buffer(
+            std::size_t capacity,
+            const std::string& tag)
+        : tag(tag)
+    {
+        data.reserve(capacity);
+    }
+
+    std::vector<char> data;
+    std::string tag;
+};
+
+//! Resetter that clears the buffer keeping its capacity.
+struct ClearResetter
+{
+    void operator ()(
+            Buffer& buffer) noexcept
+    {
+        buffer.data.clear();
+        resets++;
+    }
+
+    int resets = 0;
+};
+
+} /* namespace test */
+
+/**
+ * Check loaning and returning elements with default policies.
+ */
+TEST(PoolTest, default_policies)
+{
+    Pool<int> pool(PoolConfiguration(4, 0, 4));
+    EXPECT_EQ(pool.statistics().free, 4u);
+
+    std::vector<int*> elements(6);
+    for (auto& element : elements)
+    {
+        ASSERT_TRUE(pool.loan(element));
+    }
+
+    // Elements of the same batch are consecutive
+    EXPECT_EQ(elements[1], elements[0] + 1);
+
+    PoolStatistics statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 6u);
+    EXPECT_EQ(statistics.free, 2u);
+    EXPECT_EQ(statistics.allocations, 2u);
+
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+    EXPECT_EQ(pool.statistics().in_use, 0u);
+    EXPECT_THROW(pool.return_loan(elements[0]), InconsistencyException);
+}
+
+/**
+ * Check a pool of elements constructed with arguments and reset by a custom policy.
+ */
+TEST(PoolTest, custom_policies)
+{
+    using BufferPool = Pool<test::Buffer, ArgumentsFactory<test::Buffer, std::size_t, std::string>,
+                    test::ClearResetter>;
+
+    BufferPool pool(PoolConfiguration(2, 0, 2), make_factory<test::Buffer>(std::size_t(128), std::string("tag")));
+
+    test::Buffer* buffer;
+    ASSERT_TRUE(pool.loan(buffer));
+    EXPECT_EQ(buffer->tag, "tag");
+    EXPECT_GE(buffer->data.capacity(), 128u);
+
+    buffer->data.assign(100, 'x');
+    pool.return_loan(buffer);
+
+    // Same element reset, with its capacity kept
+    test::Buffer* reused;
+    ASSERT_TRUE(pool.loan(reused));
+    EXPECT_EQ(reused, buffer);
+    EXPECT_TRUE(reused->data.empty());
+    EXPECT_GE(reused->data.capacity(), 128u);
+    pool.return_loan(reused);
+}
+
+/**
+ * Check that the pool does not exceed its maximum size.
+ */
+TEST(PoolTest, maximum_size)
+{
+    Pool<int> pool(PoolConfiguration(0, 5, 2));
+
+    std::vector<int*> elements(5);
+    for (auto& element : elements)
+    {
+        ASSERT_TRUE(pool.loan(element));
+    }
+
+    int* extra;
+    EXPECT_FALSE(pool.loan(extra));
+    EXPECT_EQ(pool.statistics().failed_loans, 1u);
+    EXPECT_EQ(pool.statistics().allocations, 3u);
+
+    pool.return_loan(elements[0]);
+    EXPECT_TRUE(pool.loan(extra));
+    EXPECT_EQ(extra, elements[0]);
+
+    elements[0] = extra;
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+
+    EXPECT_THROW(Pool<int>(PoolConfiguration(0, 0, 0)), InitializationException);
+    EXPECT_THROW(Pool<int>(PoolConfiguration(4, 2, 1)), InitializationException);
+}
+
+/**
+ * Check the IPool adapter, used with a PoolPtr.
+ */
+TEST(PoolTest, adapter)
+{
+    PoolAdapter<Pool<std::string>> adapter(PoolConfiguration(1, 0, 1));
+    IPool<std::string>& pool = adapter;
+
+    {
+        PoolPtr<std::string> ptr = loan_ptr(pool);
+        ASSERT_TRUE(ptr);
+        *ptr = "value";
+        EXPECT_EQ(pool.statistics().in_use, 1u);
+    }
+
+    EXPECT_EQ(pool.statistics().in_use, 0u);
+    EXPECT_EQ(adapter.pool().statistics().free, 1u);
+
+    // The forwarding constructor is not used to copy adapters, nor to convert arguments implicitly
+    using Adapter = PoolAdapter<Pool<std::string>>;
+    static_assert(!std::is_copy_constructible<Adapter>::value, "Adapter must not be copied");
+    static_assert(!std::is_convertible<PoolConfiguration, Adapter>::value, "Adapter must be explicit");
+    static_assert(std::is_constructible<Adapter, PoolConfiguration>::value, "Adapter must forward arguments");
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,332 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/pool/UnboundedPool.hpp>
+
+using namespace eprosima::utils;
+
+namespace test {
+
+//! Type that counts its constructions and destructions.
+struct Counted
+{
+    Counted()
+    {
+        constructed++;
+    }
+
+    ~Counted()
+    {
+        destroyed++;
+    }
+
+    static int constructed;
+    static int destroyed;
+
+    std::string value;
+};
+
+int Counted::constructed = 0;
+int Counted::destroyed = 0;
+
+//! Pool that fails constructing the element number \c fail_at .
+class FailingPool : public UnboundedPool<Counted>
+{
+public:
+
+    FailingPool(
+            PoolConfiguration configuration,
+            int fail_at)
+        : UnboundedPool<Counted>(configuration)
+        , fail_at_(fail_at)
+    {
+    }
+
+protected:
+
+    Counted* construct_element_(
+            void* memory) override
+    {
+        if (constructions_++ == fail_at_)
+        {
+            throw std::runtime_error("construction failed");
+        }
+        return UnboundedPool<Counted>::construct_element_(memory);
+    }
+
+    int fail_at_;
+    int constructions_ = 0;
+};
+
+} /* namespace test */
+
+/**
+ * Check that elements of the same batch are contiguous, aligned and loaned in memory order.
+ */
+TEST(UnboundedPoolTest, contiguous_batch)
+{
+    UnboundedPool<uint64_t> pool(PoolConfiguration(0, 0, 16));
+
+    std::vector<uint64_t*> elements(16);
+    for (auto& element : elements)
+    {
+        ASSERT_TRUE(pool.loan(element));
+    }
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(elements[0]) % 64, 0u);
+    for (unsigned int i = 1; i < elements.size(); ++i)
+    {
+        EXPECT_EQ(elements[i], elements[0] + i);
+    }
+
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+}
+
+/**
+ * Check that every element is constructed once when allocated and destroyed once with the pool.
+ */
+TEST(UnboundedPoolTest, construct_destroy)
+{
+    test::Counted::constructed = 0;
+    test::Counted::destroyed = 0;
+    {
+        UnboundedPool<test::Counted> pool(PoolConfiguration(0, 0, 10));
+
+        std::vector<test::Counted*> elements(25);
+        for (auto& element : elements)
+        {
+            pool.loan(element);
+            element->value = "value";
+        }
+        EXPECT_EQ(test::Counted::constructed, 30);
+
+        for (auto& element : elements)
+        {
+            pool.return_loan(element);
+        }
+
+        // Reuse without constructing again
+        for (auto& element : elements)
+        {
+            pool.loan(element);
+        }
+        for (auto& element : elements)
+        {
+            pool.return_loan(element);
+        }
+        EXPECT_EQ(test::Counted::constructed, 30);
+        EXPECT_EQ(test::Counted::destroyed, 0);
+    }
+    EXPECT_EQ(test::Counted::destroyed, 30);
+}
+
+/**
+ * Check that elements already constructed are destroyed if a construction fails.
+ */
+TEST(UnboundedPoolTest, construction_failure)
+{
+    test::Counted::constructed = 0;
+    test::Counted::destroyed = 0;
+    {
+        test::FailingPool pool(PoolConfiguration(0, 0, 10), 4);
+
+        test::Counted* element;
+        EXPECT_THROW(pool.loan(element), std::runtime_error);
+        EXPECT_EQ(test::Counted::constructed, 4);
+        EXPECT_EQ(test::Counted::destroyed, 4);
+
+        // Next batch is constructed normally
+        EXPECT_TRUE(pool.loan(element));
+        pool.return_loan(element);
+    }
+    EXPECT_EQ(test::Counted::destroyed, 14);
+}
+
+/**
+ * Check the statistics of the pool while loaning and returning elements.
+ */
+TEST(UnboundedPoolTest, statistics)
+{
+    UnboundedPool<int> pool(PoolConfiguration(0, 0, 4));
+
+    std::vector<int*> elements(6);
+    for (auto& element : elements)
+    {
+        pool.loan(element);
+    }
+
+    PoolStatistics statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 6u);
+    EXPECT_EQ(statistics.free, 2u);
+    EXPECT_EQ(statistics.high_water_mark, 6u);
+    EXPECT_EQ(statistics.allocations, 2u);
+    EXPECT_EQ(statistics.failed_loans, 0u);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        pool.return_loan(elements[i]);
+    }
+
+    statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 3u);
+    EXPECT_EQ(statistics.free, 5u);
+    EXPECT_EQ(statistics.high_water_mark, 6u);
+
+    for (unsigned int i = 3; i < elements.size(); ++i)
+    {
+        pool.return_loan(elements[i]);
+    }
+}
+
+/**
+ * Check that only slabs with every element free are trimmed.
+ */
+TEST(UnboundedPoolTest, trim)
+{
+    test::Counted::constructed = 0;
+    test::Counted::destroyed = 0;
+
+    UnboundedPool<test::Counted> pool(PoolConfiguration(0, 0, 4));
+
+    std::vector<test::Counted*> elements(12);
+    for (auto& element : elements)
+    {
+        pool.loan(element);
+    }
+
+    // Keep one element of the second slab loaned
+    for (unsigned int i = 0; i < elements.size(); ++i)
+    {
+        if (i != 5)
+        {
+            pool.return_loan(elements[i]);
+        }
+    }
+
+    EXPECT_EQ(pool.trim(), 8u);
+    EXPECT_EQ(test::Counted::destroyed, 8);
+
+    PoolStatistics statistics = pool.statistics();
+    EXPECT_EQ(statistics.in_use, 1u);
+    EXPECT_EQ(statistics.free, 3u);
+    EXPECT_EQ(statistics.trimmed, 8u);
+
+    // Nothing else could be freed
+    pool.return_loan(elements[5]);
+    EXPECT_EQ(pool.trim(4), 0u);
+    EXPECT_EQ(pool.trim(), 4u);
+
+    // The pool grows again when required
+    test::Counted* element;
+    ASSERT_TRUE(pool.loan(element));
+    EXPECT_EQ(pool.statistics().free, 3u);
+    EXPECT_EQ(pool.statistics().allocations, 4u);
+    pool.return_loan(element);
+}
+
+/**
+ * Check that the pool is trimmed automatically after being idle for the configured time.
+ */
+TEST(UnboundedPoolTest, idle_trim)
+{
+    PoolConfiguration configuration(2, 0, 2);
+    configuration.trim_idle_time = 50;
+    configuration.trim_threshold = 0.5f;
+    UnboundedPool<int> pool(configuration);
+
+    // Traffic spike
+    std::vector<int*> elements(20);
+    for (auto& element : elements)
+    {
+        pool.loan(element);
+    }
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+    EXPECT_EQ(pool.statistics().free, 20u);
+
+    // Low traffic during more than the idle time, after the spike period
+    int* element;
+    for (int i = 0; i < 3; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        pool.loan(element);
+        pool.return_loan(element);
+    }
+
+    PoolStatistics statistics = pool.statistics();
+    EXPECT_LT(statistics.free, 20u);
+    EXPECT_GE(statistics.free, 2u);
+    EXPECT_EQ(statistics.free + statistics.trimmed, 20u);
+    EXPECT_EQ(statistics.high_water_mark, 20u);
+}
+
+/**
+ * Check that a pool without any traffic is trimmed by trim_if_idle.
+ */
+TEST(UnboundedPoolTest, trim_if_idle)
+{
+    PoolConfiguration configuration(2, 0, 2);
+    configuration.trim_idle_time = 50;
+    configuration.trim_threshold = 0.5f;
+    UnboundedPool<int> pool(configuration);
+
+    // Traffic spike, and then nothing
+    std::vector<int*> elements(20);
+    for (auto& element : elements)
+    {
+        pool.loan(element);
+    }
+    for (auto& element : elements)
+    {
+        pool.return_loan(element);
+    }
+
+    // Not idle until a whole period passes
+    EXPECT_EQ(pool.trim_if_idle(), 0u);
+
+    // Period of the spike
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_EQ(pool.trim_if_idle(), 0u);
+
+    // Idle period
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_EQ(pool.trim_if_idle(), 18u);
+    EXPECT_EQ(pool.statistics().free, 2u);
+
+    // Never trimmed without idle time configured
+    UnboundedPool<int> untrimmed(PoolConfiguration(2, 0, 2));
+    EXPECT_EQ(untrimmed.trim_if_idle(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
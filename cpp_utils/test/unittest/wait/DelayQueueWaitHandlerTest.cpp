@@ -0,0 +1,215 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/wait/DelayQueueWaitHandler.hpp>
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+
+namespace test {
+
+eprosima::utils::Duration_ms RESIDUAL_TIME_TEST = 10u;
+eprosima::utils::Duration_ms DELAY_TIME_TEST = 100u;
+
+eprosima::utils::Timestamp in_ms(
+        eprosima::utils::Duration_ms ms)
+{
+    return eprosima::utils::now() + eprosima::utils::duration_to_ms(ms);
+}
+
+} /* namespace test */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Check that values already ready are consumed in timestamp order, and in FIFO order for the same timestamp.
+ */
+TEST(DelayQueueWaitHandlerTest, consume_in_time_order)
+{
+    DelayQueueWaitHandler<std::string> handler;
+
+    auto base = eprosima::utils::now();
+    handler.produce("c", base - std::chrono::milliseconds(1));
+    handler.produce("a", base - std::chrono::milliseconds(3));
+    handler.produce("b_1", base - std::chrono::milliseconds(2));
+    handler.produce("b_2", base - std::chrono::milliseconds(2));
+
+    EXPECT_EQ(handler.elements_pending(), 4u);
+    EXPECT_EQ(handler.next_ready_time(), base - std::chrono::milliseconds(3));
+
+    EXPECT_EQ(handler.consume(), "a");
+    EXPECT_EQ(handler.consume(), "b_1");
+    EXPECT_EQ(handler.consume(), "b_2");
+    EXPECT_EQ(handler.consume(), "c");
+
+    EXPECT_EQ(handler.elements_pending(), 0u);
+    EXPECT_EQ(handler.next_ready_time(), eprosima::utils::the_end_of_time());
+}
+
+/**
+ * Check that a value is not consumed before its timestamp.
+ *
+ * CASES:
+ * - Consume with a timeout shorter than the delay throws timeout
+ * - Consume without timeout returns once the delay has elapsed
+ */
+TEST(DelayQueueWaitHandlerTest, not_ready_before_time)
+{
+    DelayQueueWaitHandler<int> handler;
+
+    auto ready_at = test::in_ms(test::DELAY_TIME_TEST);
+    handler.produce(1, ready_at);
+
+    EXPECT_THROW(handler.consume(test::RESIDUAL_TIME_TEST), eprosima::utils::TimeoutException);
+    EXPECT_EQ(handler.elements_pending(), 1u);
+
+    EXPECT_EQ(handler.consume(), 1);
+    EXPECT_GE(eprosima::utils::now(), ready_at);
+}
+
+/**
+ * Check that a consumer sleeping until a late value is awaken when an earlier value is produced.
+ */
+TEST(DelayQueueWaitHandlerTest, earlier_value_awakes_consumer)
+{
+    DelayQueueWaitHandler<int> handler;
+
+    // Value far in the future
+    handler.produce(2, test::in_ms(60000u));
+
+    std::atomic<int> consumed(0);
+    std::thread consumer([&handler, &consumed]()
+            {
+                consumed.store(handler.consume());
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+    auto ready_at = test::in_ms(test::RESIDUAL_TIME_TEST);
+    handler.produce(1, ready_at);
+
+    consumer.join();
+    EXPECT_EQ(consumed.load(), 1);
+    EXPECT_EQ(handler.elements_pending(), 1u);
+}
+
+/**
+ * Check that several consumers retrieve every value exactly once when their time arrive.
+ */
+TEST(DelayQueueWaitHandlerTest, many_consumers)
+{
+    constexpr int CONSUMERS = 4;
+    constexpr int VALUES = 200;
+
+    DelayQueueWaitHandler<int> handler;
+    std::vector<std::atomic<int>> consumed_count(VALUES);
+    for (auto& count : consumed_count)
+    {
+        count.store(0);
+    }
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; ++c)
+    {
+        consumers.emplace_back([&]()
+                {
+                    for (int i = 0; i < VALUES / CONSUMERS; ++i)
+                    {
+                        consumed_count[handler.consume()]++;
+                    }
+                });
+    }
+
+    // Produce values with different delays in reverse order
+    for (int i = VALUES - 1; i >= 0; --i)
+    {
+        handler.produce(i, test::in_ms(static_cast<eprosima::utils::Duration_ms>(i % 20)));
+    }
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (const auto& count : consumed_count)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+/**
+ * Check that a large number of pending values could be stored and consumed in order.
+ */
+TEST(DelayQueueWaitHandlerTest, many_pending_values)
+{
+    constexpr int VALUES = 100000;
+
+    DelayQueueWaitHandler<int> handler;
+
+    auto base = eprosima::utils::now() - std::chrono::seconds(1);
+    for (int i = 0; i < VALUES; ++i)
+    {
+        // Spread values so they are not produced in timestamp order
+        int position = (i * 7919) % VALUES;
+        handler.produce(position, base + std::chrono::microseconds(position));
+    }
+
+    ASSERT_EQ(handler.elements_pending(), static_cast<CounterType>(VALUES));
+    for (int i = 0; i < VALUES; ++i)
+    {
+        ASSERT_EQ(handler.consume(), i);
+    }
+}
+
+/**
+ * Check that disabling the handler awakes every consumer, waiting for values or not.
+ */
+TEST(DelayQueueWaitHandlerTest, disable)
+{
+    DelayQueueWaitHandler<int> handler;
+    handler.produce(1, test::in_ms(60000u));
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 3; ++c)
+    {
+        consumers.emplace_back([&handler]()
+                {
+                    EXPECT_THROW(handler.consume(), eprosima::utils::DisabledException);
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+    handler.blocking_disable();
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_THROW(handler.consume(), eprosima::utils::DisabledException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
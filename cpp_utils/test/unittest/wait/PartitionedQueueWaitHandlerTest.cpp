@@ -0,0 +1,263 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cpp_utils/wait/PartitionedQueueWaitHandler.hpp>
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+
+namespace test {
+
+eprosima::utils::Duration_ms RESIDUAL_TIME_TEST = 10u;
+
+//! Sample of a topic with its sequence number inside the topic
+using Sample = std::pair<std::string, int>;
+
+} /* namespace test */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Check the construction and the partition selection.
+ *
+ * CASES:
+ * - 0 partitions is not allowed
+ * - Same key always goes to the same partition
+ * - Consuming from a non existent partition throws
+ */
+TEST(PartitionedQueueWaitHandlerTest, partition_selection)
+{
+    // 0 partitions is not allowed
+    {
+        using HandlerType = PartitionedQueueWaitHandler<std::string, int>;
+        EXPECT_THROW(HandlerType(0), eprosima::utils::InitializationException);
+    }
+
+    // Same key always goes to the same partition
+    {
+        PartitionedQueueWaitHandler<std::string, int> handler(4);
+        ASSERT_EQ(handler.partitions(), 4u);
+
+        unsigned int partition = handler.partition("topic");
+        ASSERT_LT(partition, 4u);
+
+        handler.produce("topic", 1);
+        handler.produce("topic", 2);
+
+        EXPECT_EQ(handler.elements_ready_to_consume(partition), 2u);
+        EXPECT_EQ(handler.elements_ready_to_consume(), 2u);
+        EXPECT_EQ(handler.consume(partition), 1);
+        EXPECT_EQ(handler.consume(partition), 2);
+    }
+
+    // Consuming from a non existent partition throws
+    {
+        PartitionedQueueWaitHandler<std::string, int> handler(2);
+        EXPECT_THROW(handler.consume(2), eprosima::utils::PreconditionNotMet);
+    }
+}
+
+/**
+ * Produce samples of several topics from several threads, and consume each partition from a different thread,
+ * checking that every sample of each topic is consumed in order.
+ */
+TEST(PartitionedQueueWaitHandlerTest, order_per_key)
+{
+    constexpr unsigned int PARTITIONS = 4;
+    constexpr int TOPICS = 16;
+    constexpr int SAMPLES_PER_TOPIC = 500;
+
+    PartitionedQueueWaitHandler<std::string, test::Sample> handler(PARTITIONS);
+
+    // Number of samples expected per partition
+    std::vector<int> expected(PARTITIONS, 0);
+    for (int t = 0; t < TOPICS; ++t)
+    {
+        expected[handler.partition("topic_" + std::to_string(t))] += SAMPLES_PER_TOPIC;
+    }
+
+    // One producer per topic
+    std::vector<std::thread> producers;
+    for (int t = 0; t < TOPICS; ++t)
+    {
+        producers.emplace_back([&handler, t]()
+                {
+                    std::string topic = "topic_" + std::to_string(t);
+                    for (int i = 0; i < SAMPLES_PER_TOPIC; ++i)
+                    {
+                        handler.produce(topic, test::Sample(topic, i));
+                    }
+                });
+    }
+
+    // One consumer per partition
+    std::vector<std::thread> consumers;
+    for (unsigned int p = 0; p < PARTITIONS; ++p)
+    {
+        consumers.emplace_back([&handler, &expected, p]()
+                {
+                    std::map<std::string, int> last_received;
+                    for (int i = 0; i < expected[p]; ++i)
+                    {
+                        test::Sample sample = handler.consume(p);
+
+                        EXPECT_EQ(handler.partition(sample.first), p);
+
+                        auto it = last_received.find(sample.first);
+                        if (it == last_received.end())
+                        {
+                            EXPECT_EQ(sample.second, 0);
+                            last_received[sample.first] = sample.second;
+                        }
+                        else
+                        {
+                            EXPECT_EQ(sample.second, it->second + 1);
+                            it->second = sample.second;
+                        }
+                    }
+                });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(handler.elements_ready_to_consume(), 0u);
+}
+
+/**
+ * Check that adding partitions waits for every value to be consumed before changing the partitions.
+ *
+ * STEPS:
+ * - Produce values in a 1 partition handler
+ * - Rebalance with timeout while nobody consumes: it fails and nothing changes
+ * - Consume values from other thread while rebalancing: it succeeds
+ * - New partitions could be consumed
+ */
+TEST(PartitionedQueueWaitHandlerTest, add_partitions)
+{
+    PartitionedQueueWaitHandler<int, int> handler(1);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        handler.produce(i, i);
+    }
+
+    // Nobody consumes, so rebalance times out
+    EXPECT_THROW(handler.add_partitions(1, test::RESIDUAL_TIME_TEST), eprosima::utils::TimeoutException);
+    EXPECT_EQ(handler.partitions(), 1u);
+
+    // Consume from other thread while rebalancing
+    std::thread consumer([&handler]()
+            {
+                for (int i = 0; i < 10; ++i)
+                {
+                    EXPECT_EQ(handler.consume(0), i);
+                }
+            });
+
+    EXPECT_EQ(handler.add_partitions(3), 4u);
+    consumer.join();
+
+    // Every key is stored in its new partition
+    for (int i = 0; i < 8; ++i)
+    {
+        handler.produce(i, i);
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(handler.consume(handler.partition(i)), i);
+    }
+}
+
+/**
+ * Check that the timeout of wait_all_consumed applies to every partition together, not to each one.
+ */
+TEST(PartitionedQueueWaitHandlerTest, wait_all_consumed_timeout)
+{
+    constexpr unsigned int PARTITIONS = 8;
+    constexpr eprosima::utils::Duration_ms TIMEOUT = 50u;
+
+    PartitionedQueueWaitHandler<int, int> handler(PARTITIONS);
+
+    // A value in every partition, and nobody consumes
+    for (int key = 0; handler.elements_ready_to_consume() < PARTITIONS; ++key)
+    {
+        if (handler.partition(key) == handler.elements_ready_to_consume())
+        {
+            handler.produce(key, key);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(handler.wait_all_consumed(TIMEOUT), AwakeReason::timeout);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    // Waiting the timeout in each partition would take PARTITIONS times longer
+    EXPECT_GE(elapsed.count(), TIMEOUT);
+    EXPECT_LT(elapsed.count(), 3 * TIMEOUT);
+}
+
+/**
+ * Check that disabling the handler awakes consumers of every partition.
+ */
+TEST(PartitionedQueueWaitHandlerTest, disable)
+{
+    PartitionedQueueWaitHandler<int, int> handler(2);
+
+    std::vector<std::thread> consumers;
+    for (unsigned int p = 0; p < 2; ++p)
+    {
+        consumers.emplace_back([&handler, p]()
+                {
+                    EXPECT_THROW(handler.consume(p), eprosima::utils::DisabledException);
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+    handler.disable();
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    // Partitions added while disabled are disabled as well
+    handler.add_partitions(1);
+    EXPECT_THROW(handler.consume(2), eprosima::utils::DisabledException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,213 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/wait/PriorityQueueWaitHandler.hpp>
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+
+namespace test {
+
+eprosima::utils::Duration_ms RESIDUAL_TIME_TEST = 10u;
+
+//! Message with a priority and a payload, sorted only by priority
+struct Message
+{
+    int priority;
+    std::string payload;
+};
+
+struct MessagePriority
+{
+    bool operator ()(
+            const Message& lhs,
+            const Message& rhs) const
+    {
+        return lhs.priority < rhs.priority;
+    }
+
+};
+
+} /* namespace test */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Check that values are consumed from highest to lowest priority.
+ *
+ * CASES:
+ * - Default comparator (greatest first)
+ * - Inverse comparator (lowest first)
+ */
+TEST(PriorityQueueWaitHandlerTest, consume_by_priority)
+{
+    // Default comparator
+    {
+        PriorityQueueWaitHandler<int> handler;
+
+        handler.produce(3);
+        handler.produce(1);
+        handler.produce(5);
+        handler.produce(2);
+
+        EXPECT_EQ(handler.consume(), 5);
+        EXPECT_EQ(handler.consume(), 3);
+
+        handler.produce(4);
+
+        EXPECT_EQ(handler.consume(), 4);
+        EXPECT_EQ(handler.consume(), 2);
+        EXPECT_EQ(handler.consume(), 1);
+    }
+
+    // Inverse comparator
+    {
+        PriorityQueueWaitHandler<int, std::greater<int>> handler;
+
+        handler.produce(3);
+        handler.produce(1);
+        handler.produce(2);
+
+        EXPECT_EQ(handler.consume(), 1);
+        EXPECT_EQ(handler.consume(), 2);
+        EXPECT_EQ(handler.consume(), 3);
+    }
+}
+
+/**
+ * Check that values with the same priority are consumed in the order they were produced,
+ * and that a higher priority value overtakes them.
+ */
+TEST(PriorityQueueWaitHandlerTest, fifo_same_priority)
+{
+    PriorityQueueWaitHandler<test::Message, test::MessagePriority> handler;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        handler.produce(test::Message{0, "bulk_" + std::to_string(i)});
+    }
+    handler.produce(test::Message{1, "control"});
+
+    EXPECT_EQ(handler.consume().payload, "control");
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(handler.consume().payload, "bulk_" + std::to_string(i));
+    }
+}
+
+/**
+ * Check that values moved into the handler are moved out of it in priority order.
+ */
+TEST(PriorityQueueWaitHandlerTest, move_values)
+{
+    PriorityQueueWaitHandler<std::string> handler;
+
+    std::string low("a_low_priority_value");
+    std::string high("z_high_priority_value");
+
+    handler.produce(std::move(low));
+    handler.produce(std::move(high));
+
+    EXPECT_EQ(handler.consume(), "z_high_priority_value");
+    EXPECT_EQ(handler.consume(), "a_low_priority_value");
+}
+
+/**
+ * Check that a consumer times out if there is no data, and that it is awaken when disabled.
+ */
+TEST(PriorityQueueWaitHandlerTest, timeout_and_disable)
+{
+    PriorityQueueWaitHandler<int> handler;
+
+    EXPECT_THROW(handler.consume(test::RESIDUAL_TIME_TEST), eprosima::utils::TimeoutException);
+
+    std::thread consumer([&handler]()
+            {
+                EXPECT_THROW(handler.consume(), eprosima::utils::DisabledException);
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+    handler.disable();
+    consumer.join();
+}
+
+/**
+ * Produce from several threads and consume from several threads, checking that every value is
+ * consumed exactly once.
+ */
+TEST(PriorityQueueWaitHandlerTest, many_producers_many_consumers)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    constexpr int VALUES_PER_PRODUCER = 1000;
+
+    PriorityQueueWaitHandler<int> handler;
+    std::vector<int> consumed_count(PRODUCERS * VALUES_PER_PRODUCER, 0);
+    std::mutex consumed_mutex;
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < CONSUMERS; ++c)
+    {
+        consumers.emplace_back([&]()
+                {
+                    for (int i = 0; i < (PRODUCERS * VALUES_PER_PRODUCER) / CONSUMERS; ++i)
+                    {
+                        int value = handler.consume();
+                        std::lock_guard<std::mutex> lock(consumed_mutex);
+                        consumed_count[value]++;
+                    }
+                });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&handler, p]()
+                {
+                    for (int i = 0; i < VALUES_PER_PRODUCER; ++i)
+                    {
+                        handler.produce(p * VALUES_PER_PRODUCER + i);
+                    }
+                });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (const auto& count : consumed_count)
+    {
+        EXPECT_EQ(count, 1);
+    }
+    EXPECT_EQ(handler.elements_ready_to_consume(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,271 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+
+#include <cpp_utils/wait/ShmQueueWaitHandler.hpp>
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/TimeoutException.hpp>
+
+namespace test {
+
+eprosima::utils::Duration_ms RESIDUAL_TIME_TEST = 10u;
+
+struct Record
+{
+    uint64_t sequence;
+    double payload;
+};
+
+std::string segment_name(
+        const std::string& test_name)
+{
+    return "/cpp_utils_ShmQueueWaitHandlerTest_" + test_name + "_" + std::to_string(getpid());
+}
+
+//! Wait for a child process and return whether it finished correctly.
+bool child_succeeded(
+        pid_t child)
+{
+    int status;
+    waitpid(child, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+} /* namespace test */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Check produce, consume and consume_batch in a single process.
+ */
+TEST(ShmQueueWaitHandlerTest, produce_consume)
+{
+    std::string name = test::segment_name("produce_consume");
+    ShmQueueWaitHandler<test::Record>::remove(name);
+    {
+        ShmQueueWaitHandler<test::Record> handler(name, 8);
+        EXPECT_EQ(handler.capacity(), 8u);
+
+        // Several rounds so the indices wrap around the ring
+        uint64_t produced = 0;
+        uint64_t consumed = 0;
+        for (int round = 0; round < 5; ++round)
+        {
+            for (int i = 0; i < 6; ++i, ++produced)
+            {
+                handler.produce({produced, 0.5 * produced});
+            }
+            EXPECT_EQ(handler.elements_ready_to_consume(), 6u);
+
+            EXPECT_EQ(handler.consume().sequence, consumed++);
+
+            auto batch = handler.consume_batch(10);
+            ASSERT_EQ(batch.size(), 5u);
+            for (const auto& record : batch)
+            {
+                EXPECT_EQ(record.sequence, consumed);
+                EXPECT_EQ(record.payload, 0.5 * consumed);
+                consumed++;
+            }
+        }
+
+        EXPECT_EQ(handler.elements_ready_to_consume(), 0u);
+        EXPECT_EQ(handler.wait_all_consumed(test::RESIDUAL_TIME_TEST), AwakeReason::condition_met);
+    }
+    ShmQueueWaitHandler<test::Record>::remove(name);
+}
+
+/**
+ * Check that producers wait while the queue is full, and consumers while it is empty.
+ */
+TEST(ShmQueueWaitHandlerTest, full_and_empty)
+{
+    std::string name = test::segment_name("full_and_empty");
+    ShmQueueWaitHandler<int>::remove(name);
+    {
+        ShmQueueWaitHandler<int> handler(name, 4);
+
+        EXPECT_THROW(handler.consume(test::RESIDUAL_TIME_TEST), eprosima::utils::TimeoutException);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            handler.produce(i);
+        }
+        EXPECT_THROW(handler.produce(4, test::RESIDUAL_TIME_TEST), eprosima::utils::TimeoutException);
+        EXPECT_EQ(handler.wait_all_consumed(test::RESIDUAL_TIME_TEST), AwakeReason::timeout);
+
+        // A producer waiting for space is awaken when a value is consumed
+        std::thread producer([&handler]()
+                {
+                    handler.produce(4);
+                });
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+        EXPECT_EQ(handler.consume(), 0);
+        producer.join();
+
+        for (int i = 1; i < 5; ++i)
+        {
+            EXPECT_EQ(handler.consume(), i);
+        }
+    }
+    ShmQueueWaitHandler<int>::remove(name);
+}
+
+/**
+ * Check that values produced in a process are consumed in order in other process.
+ */
+TEST(ShmQueueWaitHandlerTest, inter_process)
+{
+    constexpr uint64_t VALUES = 100000;
+
+    std::string name = test::segment_name("inter_process");
+    ShmQueueWaitHandler<test::Record>::remove(name);
+    {
+        ShmQueueWaitHandler<test::Record> handler(name, 64);
+
+        pid_t child = fork();
+        ASSERT_GE(child, 0);
+        if (child == 0)
+        {
+            // Producer process attaches the same segment
+            ShmQueueWaitHandler<test::Record> producer(name, 64);
+            for (uint64_t i = 0; i < VALUES; ++i)
+            {
+                producer.produce({i, 2.0 * i});
+            }
+            _exit(0);
+        }
+
+        uint64_t consumed = 0;
+        while (consumed < VALUES)
+        {
+            for (const auto& record : handler.consume_batch(32))
+            {
+                ASSERT_EQ(record.sequence, consumed);
+                ASSERT_EQ(record.payload, 2.0 * consumed);
+                consumed++;
+            }
+        }
+
+        EXPECT_TRUE(test::child_succeeded(child));
+        EXPECT_EQ(handler.elements_ready_to_consume(), 0u);
+    }
+    ShmQueueWaitHandler<test::Record>::remove(name);
+}
+
+/**
+ * Check that a process attaching the segment after other process crashed resumes from its indices.
+ */
+TEST(ShmQueueWaitHandlerTest, recover_after_crash)
+{
+    std::string name = test::segment_name("recover_after_crash");
+    ShmQueueWaitHandler<int>::remove(name);
+
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        // Produce and consume some values and finish without destroying anything
+        ShmQueueWaitHandler<int> handler(name, 16);
+        for (int i = 0; i < 10; ++i)
+        {
+            handler.produce(i);
+        }
+        for (int i = 0; i < 3; ++i)
+        {
+            if (handler.consume() != i)
+            {
+                _exit(1);
+            }
+        }
+        _exit(0);
+    }
+    ASSERT_TRUE(test::child_succeeded(child));
+
+    {
+        ShmQueueWaitHandler<int> handler(name, 16);
+        EXPECT_EQ(handler.elements_ready_to_consume(), 7u);
+        for (int i = 3; i < 10; ++i)
+        {
+            EXPECT_EQ(handler.consume(), i);
+        }
+    }
+    ShmQueueWaitHandler<int>::remove(name);
+}
+
+/**
+ * Check that a segment could not be attached with a different type or capacity.
+ */
+TEST(ShmQueueWaitHandlerTest, incompatible_segment)
+{
+    std::string name = test::segment_name("incompatible_segment");
+    ShmQueueWaitHandler<int>::remove(name);
+    {
+        ShmQueueWaitHandler<int> handler(name, 8);
+
+        EXPECT_THROW(ShmQueueWaitHandler<int>(name, 16), eprosima::utils::InitializationException);
+        EXPECT_THROW(ShmQueueWaitHandler<test::Record>(name, 8), eprosima::utils::InitializationException);
+    }
+    ShmQueueWaitHandler<int>::remove(name);
+}
+
+/**
+ * Check that disabling the handler awakes consumers and producers waiting.
+ */
+TEST(ShmQueueWaitHandlerTest, disable)
+{
+    std::string name = test::segment_name("disable");
+    ShmQueueWaitHandler<int>::remove(name);
+    {
+        ShmQueueWaitHandler<int> handler(name, 1);
+
+        std::thread consumer([&handler]()
+                {
+                    EXPECT_THROW(handler.consume(), eprosima::utils::DisabledException);
+                });
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+        handler.blocking_disable();
+        consumer.join();
+
+        handler.enable();
+        handler.produce(1);
+        std::thread producer([&handler]()
+                {
+                    EXPECT_THROW(handler.produce(2), eprosima::utils::DisabledException);
+                });
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+        handler.disable();
+        producer.join();
+
+        EXPECT_THROW(handler.consume(), eprosima::utils::DisabledException);
+    }
+    ShmQueueWaitHandler<int>::remove(name);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,236 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/wait/SpillDBQueueWaitHandler.hpp>
+#include <cpp_utils/exception/ConfigurationException.hpp>
+
+namespace test {
+
+eprosima::utils::event::SpillCodec<std::string> string_codec()
+{
+    eprosima::utils::event::SpillCodec<std::string> codec;
+    codec.serialize = [](const std::string& value, std::vector<uint8_t>& buffer)
+            {
+                buffer.insert(buffer.end(), value.begin(), value.end());
+            };
+    codec.deserialize = [](const uint8_t* data, std::size_t size)
+            {
+                return std::string(reinterpret_cast<const char*>(data), size);
+            };
+    return codec;
+}
+
+eprosima::utils::event::SpillConfiguration configuration(
+        const std::string& test_name,
+        unsigned int memory_threshold,
+        unsigned int batch_size)
+{
+    eprosima::utils::event::SpillConfiguration configuration;
+    configuration.file_path = "SpillDBQueueWaitHandlerTest_" + test_name + ".spill";
+    configuration.memory_threshold = memory_threshold;
+    configuration.batch_size = batch_size;
+    return configuration;
+}
+
+std::streamoff file_size(
+        const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+    return file.tellg();
+}
+
+} /* namespace test */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Check that no value is spilled while under the memory threshold.
+ */
+TEST(SpillDBQueueWaitHandlerTest, no_spill_under_threshold)
+{
+    SpillDBQueueWaitHandler<std::string> handler(test::configuration("no_spill", 10, 4), test::string_codec());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        handler.produce(std::to_string(i));
+    }
+
+    EXPECT_EQ(handler.elements_in_memory(), 10u);
+    EXPECT_EQ(handler.elements_spilled(), 0u);
+    EXPECT_EQ(handler.statistics().spilled_values, 0u);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(handler.consume(), std::to_string(i));
+    }
+}
+
+/**
+ * Check that values over the threshold are spilled and consumed in the same order they were produced.
+ *
+ * CASES:
+ * - Values are moved to disk in batches
+ * - Values keep going to disk until every spilled value is back in memory
+ * - Produce while consuming spilled values
+ */
+TEST(SpillDBQueueWaitHandlerTest, fifo_with_spill)
+{
+    SpillDBQueueWaitHandler<std::string> handler(test::configuration("fifo", 8, 5), test::string_codec());
+
+    int produced = 0;
+    int consumed = 0;
+    for (; produced < 100; ++produced)
+    {
+        handler.produce(std::to_string(produced));
+    }
+
+    EXPECT_EQ(handler.elements_in_memory(), 8u);
+    EXPECT_EQ(handler.elements_spilled(), 92u);
+    EXPECT_EQ(handler.statistics().write_operations, 18u);
+
+    // Consume half of them and produce some more
+    for (; consumed < 50; ++consumed)
+    {
+        ASSERT_EQ(handler.consume(), std::to_string(consumed));
+    }
+    for (; produced < 130; ++produced)
+    {
+        handler.produce(std::to_string(produced));
+    }
+
+    for (; consumed < 130; ++consumed)
+    {
+        ASSERT_EQ(handler.consume(), std::to_string(consumed));
+    }
+
+    EXPECT_EQ(handler.elements_ready_to_consume(), 0u);
+    EXPECT_EQ(handler.elements_in_memory(), 0u);
+    EXPECT_EQ(handler.elements_spilled(), 0u);
+
+    SpillStatistics statistics = handler.statistics();
+    EXPECT_EQ(statistics.spilled_values, statistics.replayed_values);
+    EXPECT_EQ(statistics.spilled_bytes, statistics.replayed_bytes);
+    EXPECT_GT(statistics.read_operations, 0u);
+}
+
+/**
+ * Check that the segment file is truncated once every spilled value has been consumed, and removed at the end.
+ */
+TEST(SpillDBQueueWaitHandlerTest, segment_truncated)
+{
+    SpillConfiguration configuration = test::configuration("truncated", 2, 2);
+    {
+        SpillDBQueueWaitHandler<std::string> handler(configuration, test::string_codec());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            handler.produce(std::string(100, 'a' + i));
+        }
+        EXPECT_GT(test::file_size(configuration.file_path), 0);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            ASSERT_EQ(handler.consume(), std::string(100, 'a' + i));
+        }
+        EXPECT_EQ(test::file_size(configuration.file_path), 0);
+
+        // The segment could be used again after truncated
+        for (int i = 0; i < 10; ++i)
+        {
+            handler.produce(std::to_string(i));
+        }
+        for (int i = 0; i < 10; ++i)
+        {
+            ASSERT_EQ(handler.consume(), std::to_string(i));
+        }
+    }
+
+    EXPECT_FALSE(std::ifstream(configuration.file_path).good());
+}
+
+/**
+ * Check that several producers and one consumer keep the order of each producer while values are spilled.
+ */
+TEST(SpillDBQueueWaitHandlerTest, concurrent_producers)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int VALUES = 2000;
+
+    SpillDBQueueWaitHandler<std::string> handler(test::configuration("concurrent", 50, 16), test::string_codec());
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&handler, p]()
+                {
+                    for (int i = 0; i < VALUES; ++i)
+                    {
+                        handler.produce(std::to_string(p) + "_" + std::to_string(i));
+                    }
+                });
+    }
+
+    std::vector<int> next_expected(PRODUCERS, 0);
+    for (int i = 0; i < PRODUCERS * VALUES; ++i)
+    {
+        std::string value = handler.consume();
+        std::size_t separator = value.find('_');
+        int producer = std::stoi(value.substr(0, separator));
+        int index = std::stoi(value.substr(separator + 1));
+        ASSERT_EQ(index, next_expected[producer]);
+        next_expected[producer]++;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(handler.elements_spilled(), 0u);
+}
+
+/**
+ * Check that an invalid configuration is rejected.
+ */
+TEST(SpillDBQueueWaitHandlerTest, invalid_configuration)
+{
+    EXPECT_THROW(
+        SpillDBQueueWaitHandler<std::string>(test::configuration("invalid", 10, 0), test::string_codec()),
+        eprosima::utils::ConfigurationException);
+
+    SpillConfiguration no_path = test::configuration("invalid", 10, 1);
+    no_path.file_path = "";
+    EXPECT_THROW(
+        SpillDBQueueWaitHandler<std::string>(no_path, test::string_codec()),
+        eprosima::utils::ConfigurationException);
+
+    EXPECT_THROW(
+        SpillDBQueueWaitHandler<std::string>(test::configuration("invalid", 10, 1), SpillCodec<std::string>()),
+        eprosima::utils::ConfigurationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}